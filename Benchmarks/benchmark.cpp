@@ -0,0 +1,534 @@
+﻿#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Math/math.hpp"
+
+namespace
+{
+    constexpr size_t Count = 1024;
+    constexpr size_t Iterations = 10000;
+
+    /// @brief The scalar Matrix product, as evaluated when SIMD instructions aren't available.
+    Matrix ScalarMultiply(const Matrix& m1, const Matrix& m2) noexcept
+    {
+        Matrix result;
+
+        for (size_t col = 0; col < 4; col++)
+        {
+            for (size_t row = 0; row < 4; row++)
+            {
+                float_t value = 0.f;
+                for (size_t i = 0; i < 4; i++)
+                    value += m1.Data()[i * 4 + row] * m2.Data()[col * 4 + i];
+                result.Data()[col * 4 + row] = value;
+            }
+        }
+
+        return result;
+    }
+
+    /// @brief The scalar Matrix by Vector4 product, as evaluated when SIMD instructions aren't available.
+    Vector4 ScalarMultiply(const Matrix& m, const Vector4& v) noexcept
+    {
+        Vector4 result;
+
+        for (size_t row = 0; row < 4; row++)
+        {
+            float_t value = 0.f;
+            for (size_t i = 0; i < 4; i++)
+                value += m.Data()[i * 4 + row] * v.Data()[i];
+            result.Data()[row] = value;
+        }
+
+        return result;
+    }
+
+    /// @brief Runs @p function @c Iterations times and returns the average duration of a single run, in nanoseconds.
+    template <typename FunctionT>
+    double Measure(FunctionT&& function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < Iterations; i++)
+            function();
+
+        const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+        return duration.count() / Iterations;
+    }
+
+    void Report(const char* name, const char* baselineName, const double baseline, const char* optimizedName, const double optimized)
+    {
+        std::cout << name << ": " << baselineName << ' ' << baseline << " ns, " << optimizedName << ' ' << optimized << " ns, speedup x" << baseline / optimized << '\n';
+    }
+}
+
+int main()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution distribution(-10.f, 10.f);
+
+    std::vector<Matrix> matrices(Count);
+    std::vector<Vector4> vectors(Count);
+    for (Matrix& m : matrices)
+    {
+        for (size_t i = 0; i < 16; i++)
+            m.Data()[i] = distribution(generator);
+    }
+    for (Vector4& v : vectors)
+        v = Vector4(distribution(generator), distribution(generator), distribution(generator), distribution(generator));
+
+    std::vector<Matrix> matrixResults(Count);
+    std::vector<Vector4> vectorResults(Count);
+
+    const double scalarMatrix = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = ScalarMultiply(matrices[i], matrices[Count - 1 - i]);
+        }
+    );
+    const double simdMatrix = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = matrices[i] * matrices[Count - 1 - i];
+        }
+    );
+
+    const double scalarVector = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vectorResults[i] = ScalarMultiply(matrices[i], vectors[i]);
+        }
+    );
+    const double simdVector = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vectorResults[i] = matrices[i] * vectors[i];
+        }
+    );
+
+    const double inverted = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrices[i].Inverted(&matrixResults[i]);
+        }
+    );
+    const double invertedAffine = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrices[i].InvertedAffine(&matrixResults[i]);
+        }
+    );
+
+    std::vector<Vector3> directions(Count);
+    for (Vector3& d : directions)
+        d = Vector3(distribution(generator), distribution(generator), distribution(generator));
+    std::vector<Quaternion> rotations(Count);
+    for (size_t i = 0; i < Count; i++)
+        rotations[i] = Quaternion::FromAxisAngle(directions[i].Normalized(), distribution(generator));
+
+    std::vector<Vector3> directionResults(Count);
+    std::vector<Quaternion> rotationResults(Count);
+
+    const double preciseNormalize = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                directionResults[i] = directions[i].Normalized();
+        }
+    );
+    const double fastNormalize = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                directionResults[i] = directions[i].Normalized(Calc::FastMath);
+        }
+    );
+    const double batchNormalize = Measure([&] { Vector3::Normalize(directions, directionResults); });
+    const double scalarQuaternionNormalize = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                rotationResults[i] = rotations[i].Normalized();
+        }
+    );
+    const double batchQuaternionNormalize = Measure([&] { Quaternion::Normalize(rotations, rotationResults); });
+
+    const double preciseSlerp = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                rotationResults[i] = Quaternion::Slerp(rotations[i], rotations[Count - 1 - i], 0.3f);
+        }
+    );
+    const double fastSlerp = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                rotationResults[i] = Quaternion::Slerp(rotations[i], rotations[Count - 1 - i], 0.3f, Calc::FastMath);
+        }
+    );
+
+    std::vector<float_t> angles(Count);
+    for (float_t& a : angles)
+        a = distribution(generator);
+    std::vector<float_t> sines(Count), cosines(Count);
+
+    const double separateRotation = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = Matrix::RotationZ(std::cos(angles[i]), std::sin(angles[i]));
+        }
+    );
+    const double sinCosRotation = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = Matrix::RotationZ(angles[i]);
+        }
+    );
+
+    const double separateSinCos = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+            {
+                sines[i] = std::sin(angles[i]);
+                cosines[i] = std::cos(angles[i]);
+            }
+        }
+    );
+    const double batchSinCos = Measure([&] { Calc::SinCos(angles, sines, cosines); });
+
+    std::vector<Vector3> eulerAngles(Count);
+    for (Vector3& e : eulerAngles)
+        e = Vector3(distribution(generator), distribution(generator), distribution(generator));
+
+    const double productEuler = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = Matrix::Trs(directions[i], Matrix::RotationZ(eulerAngles[i].z) * Matrix::RotationY(eulerAngles[i].y) * Matrix::RotationX(eulerAngles[i].x), Vector3(2.f));
+        }
+    );
+    const double closedFormEuler = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = Matrix::Trs(directions[i], eulerAngles[i], Vector3(2.f));
+        }
+    );
+
+    const double scalarBatchEuler = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                Matrix::Rotation(eulerAngles[i], &matrixResults[i]);
+        }
+    );
+    const double batchEuler = Measure([&] { Matrix::Rotation(eulerAngles, matrixResults); });
+
+    const double evaluatedChain = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vectorResults[i] = matrices[i] * matrices[Count - 1 - i] * matrices[i / 2] * vectors[i];
+        }
+    );
+    const double lazyChain = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vectorResults[i] = LazyProduct(matrices[i], matrices[Count - 1 - i], matrices[i / 2]) * vectors[i];
+        }
+    );
+
+    std::vector<Matrix> affineMatrices(Count);
+    std::vector<AffineTransform> affineTransforms(Count);
+    for (size_t i = 0; i < Count; i++)
+    {
+        affineMatrices[i] = Matrix::Trs(directions[i], eulerAngles[i], Vector3(2.f));
+        affineTransforms[i] = AffineTransform(affineMatrices[i]);
+    }
+    std::vector<AffineTransform> affineResults(Count);
+
+    const double matrixAffineProduct = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = affineMatrices[i] * affineMatrices[Count - 1 - i];
+        }
+    );
+    const double affineProduct = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                affineResults[i] = affineTransforms[i] * affineTransforms[Count - 1 - i];
+        }
+    );
+
+    const double matrixAffineInverse = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                affineMatrices[i].InvertedAffine(&matrixResults[i]);
+        }
+    );
+    const double affineInverse = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                affineTransforms[i].Inverted(&affineResults[i]);
+        }
+    );
+
+    std::vector<Matrix3> matrices3(Count);
+    std::vector<Matrix3A> matrices3A(Count);
+    for (size_t i = 0; i < Count; i++)
+    {
+        matrices3[i] = Matrix3::Rotation(eulerAngles[i]) * Matrix3::Scaling(Vector3(2.f));
+        matrices3A[i] = Matrix3A(matrices3[i]);
+    }
+    std::vector<Matrix3> matrix3Results(Count);
+    std::vector<Matrix3A> matrix3AResults(Count);
+    std::vector<Vector3> vector3Results(Count);
+
+    const double matrix3Product = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrix3Results[i] = matrices3[i] * matrices3[Count - 1 - i];
+        }
+    );
+    const double matrix3AProduct = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrix3AResults[i] = matrices3A[i] * matrices3A[Count - 1 - i];
+        }
+    );
+
+    const double matrix3Inverse = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrices3[i].Inverted(&matrix3Results[i]);
+        }
+    );
+    const double matrix3AInverse = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrices3A[i].Inverted(&matrix3AResults[i]);
+        }
+    );
+
+    const double matrix3Vector = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vector3Results[i] = matrices3[i] * directions[i];
+        }
+    );
+    const double matrix3AVector = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vector3Results[i] = matrices3A[i] * directions[i];
+        }
+    );
+
+    const double scalarPacketNormalize = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                directionResults[i] = directions[i].Normalized();
+        }
+    );
+    const double packetNormalize = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i += Floatx8::Size)
+                Vector3x8::Load(&directions[i]).Normalized().Store(&directionResults[i]);
+        }
+    );
+
+    const double scalarPacketRotate = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vector3Results[i] = Quaternion::Rotate(directions[i], rotations[i]);
+        }
+    );
+    const double packetRotate = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i += Floatx8::Size)
+                Quaternionx8::Rotate(Vector3x8::Load(&directions[i]), Quaternionx8::Load(&rotations[i])).Store(&vector3Results[i]);
+        }
+    );
+
+    const double scalarTransformPoints = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                vector3Results[i] = matrices[0] * directions[i];
+        }
+    );
+    const double batchTransformPoints = Measure([&] { matrices[0].TransformPoints(directions, vector3Results); });
+
+    const Matrix& viewProjection = matrices[0];
+    const double scalarSharedProduct = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = viewProjection * matrices[i];
+        }
+    );
+    const double batchSharedProduct = Measure([&] { Matrix::Multiply(viewProjection, matrices, matrixResults); });
+
+    // Enough matrices for each hardware thread to be given a chunk
+    std::vector<Matrix> manyModels(16 * Count, matrices[1]), manyResults(manyModels.size());
+    const double singleThreadedProduct = Measure([&] { Matrix::Multiply(viewProjection, manyModels, manyResults); });
+    const double multiThreadedProduct = Measure([&] { Matrix::Multiply(viewProjection, manyModels, manyResults, 0); });
+
+    const double scalarBatchTrs = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                Matrix::Trs(directions[i], rotations[i], eulerAngles[i], &matrixResults[i]);
+        }
+    );
+    const double batchTrs = Measure([&] { Matrix::Trs(directions, rotations, eulerAngles, matrixResults); });
+    const double scalarBatchAffineTrs = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                AffineTransform::Trs(directions[i], rotations[i], eulerAngles[i], &affineResults[i]);
+        }
+    );
+    const double batchAffineTrs = Measure([&] { AffineTransform::Trs(directions, rotations, eulerAngles, affineResults); });
+
+    const double invertedTrs = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                matrixResults[i] = Matrix::Trs(directions[i], rotations[i], eulerAngles[i]).Inverted();
+        }
+    );
+    const double closedFormInvertedTrs = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                Matrix::InvertedTrs(directions[i], rotations[i], eulerAngles[i], &matrixResults[i]);
+        }
+    );
+    const double batchInvertedTrs = Measure([&] { Matrix::InvertedTrs(directions, rotations, eulerAngles, matrixResults); });
+    std::vector<Matrix> rigids(Count);
+    for (size_t i = 0; i < Count; i++)
+        rigids[i] = Matrix::Trs(directions[i], rotations[i], Vector3(1.f));
+    const double invertedRigid = Measure(
+        [&]
+        {
+            for (size_t i = 0; i < Count; i++)
+                rigids[i].Inverted(&matrixResults[i]);
+        }
+    );
+    const double closedFormInvertedRigid = Measure([&] { Matrix::InvertedRigid(rigids, matrixResults); });
+
+    // Easing values decaying toward zero, most of the products being denormals
+    std::vector<float_t> decaying(Count), decayed(Count);
+    for (size_t i = 0; i < Count; i++)
+        decaying[i] = 1e-36f / static_cast<float_t>(i + 1);
+    const auto decay = [&]
+    {
+        for (size_t i = 0; i < Count; i++)
+            decayed[i] = Calc::Lerp(decaying[i], 0.f, 0.5f);
+    };
+    const double denormalDecay = Measure(decay);
+    double flushedDecay;
+    {
+        Calc::FlushDenormalsScope flushDenormals;
+        flushedDecay = Measure(decay);
+    }
+
+    std::cout << "Timings for " << Count << " operations:\n";
+    Report("Matrix * Matrix", "scalar", scalarMatrix, "SIMD", simdMatrix);
+    Report("Matrix * Vector4", "scalar", scalarVector, "SIMD", simdVector);
+    Report("Matrix inverse", "Inverted", inverted, "InvertedAffine", invertedAffine);
+    Report("Vector3 normalization", "precise", preciseNormalize, "fast", fastNormalize);
+    Report("Batch Vector3 normalization", "one by one", preciseNormalize, "Vector3::Normalize", batchNormalize);
+    Report("Batch Quaternion normalization", "one by one", scalarQuaternionNormalize, "Quaternion::Normalize", batchQuaternionNormalize);
+    Report("Quaternion slerp", "precise", preciseSlerp, "fast", fastSlerp);
+    Report("Matrix::RotationZ", "std::sin + std::cos", separateRotation, "Calc::SinCos", sinCosRotation);
+    Report("Batch sine and cosine", "std::sin + std::cos", separateSinCos, "Calc::SinCos", batchSinCos);
+    Report("Euler Matrix::Trs", "three rotation matrices", productEuler, "closed form", closedFormEuler);
+    Report("Batch Euler rotation", "one by one", scalarBatchEuler, "batch", batchEuler);
+    Report("Matrix * Matrix * Matrix * Vector4", "evaluated", evaluatedChain, "LazyProduct", lazyChain);
+    Report("Affine product", "Matrix", matrixAffineProduct, "AffineTransform", affineProduct);
+    Report("Affine inverse", "Matrix::InvertedAffine", matrixAffineInverse, "AffineTransform", affineInverse);
+    Report("3x3 product", "Matrix3", matrix3Product, "Matrix3A", matrix3AProduct);
+    Report("3x3 inverse", "Matrix3", matrix3Inverse, "Matrix3A", matrix3AInverse);
+    Report("3x3 * Vector3", "Matrix3", matrix3Vector, "Matrix3A", matrix3AVector);
+    Report("Vector3 normalization", "one by one", scalarPacketNormalize, "Vector3x8", packetNormalize);
+    Report("Quaternion rotation", "one by one", scalarPacketRotate, "Quaternionx8", packetRotate);
+    Report("Batch Vector3 point transformation", "one by one", scalarTransformPoints, "Matrix::TransformPoints", batchTransformPoints);
+    Report("Shared Matrix * Matrix", "one by one", scalarSharedProduct, "Matrix::Multiply", batchSharedProduct);
+    Report("Shared Matrix * Matrix, 16x more", "one thread", singleThreadedProduct, "all threads", multiThreadedProduct);
+    Report("Batch quaternion Matrix::Trs", "one by one", scalarBatchTrs, "batch", batchTrs);
+    Report("Batch quaternion AffineTransform::Trs", "one by one", scalarBatchAffineTrs, "batch", batchAffineTrs);
+    Report("Matrix::Trs inverse", "Inverted", invertedTrs, "InvertedTrs", closedFormInvertedTrs);
+    Report("Batch Matrix::InvertedTrs", "one by one", closedFormInvertedTrs, "batch", batchInvertedTrs);
+    Report("Rigid Matrix inverse", "Inverted", invertedRigid, "InvertedRigid", closedFormInvertedRigid);
+    Report("Denormal Lerp", "denormals", denormalDecay, "FlushDenormalsScope", flushedDecay);
+
+    // Compares the kernels of every supported instruction set with the scalar ones
+    const Dispatch::InstructionSet defaultInstructionSet = Dispatch::CurrentInstructionSet();
+    double scalarKernels[5] = {};
+    for (const Dispatch::InstructionSet instructionSet : { Dispatch::InstructionSet::Scalar, Dispatch::InstructionSet::Sse41, Dispatch::InstructionSet::Avx2, Dispatch::InstructionSet::Avx512 })
+    {
+        if (Dispatch::SetInstructionSet(instructionSet) != instructionSet)
+            break;
+
+        const Dispatch::Kernels& kernels = Dispatch::GetKernels();
+        const double timings[5] = {
+            Measure([&] { kernels.multiplyMatrices(matrices[0].Data(), matrices[0].Data(), matrixResults[0].Data(), Count); }),
+            Measure([&] { kernels.transformVectors4(matrices[0].Data(), vectors[0].Data(), vectorResults[0].Data(), Count); }),
+            Measure([&] { kernels.normalizeVectors4(vectors[0].Data(), vectorResults[0].Data(), Count); }),
+            Measure([&] { kernels.floorValues(vectors[0].Data(), vectorResults[0].Data(), Count * 4); }),
+            Measure([&] { kernels.transformPoints3(matrices[0].Data(), directions[0].Data(), vector3Results[0].Data(), Count); })
+        };
+
+        if (instructionSet == Dispatch::InstructionSet::Scalar)
+        {
+            std::ranges::copy(timings, scalarKernels);
+            continue;
+        }
+
+        const char* name = Dispatch::ToString(instructionSet);
+        Report("Batch Matrix * Matrix", "scalar", scalarKernels[0], name, timings[0]);
+        Report("Batch Matrix * Vector4", "scalar", scalarKernels[1], name, timings[1]);
+        Report("Batch Vector4 normalization", "scalar", scalarKernels[2], name, timings[2]);
+        Report("Batch Vector4 floor", "scalar", scalarKernels[3], name, timings[3]);
+        Report("Batch Vector3 point transformation", "scalar", scalarKernels[4], name, timings[4]);
+    }
+    Dispatch::SetInstructionSet(defaultInstructionSet);
+
+    // Prevents the compiler from discarding the results
+    float_t checksum = 0.f;
+    for (size_t i = 0; i < Count; i++)
+        checksum += matrixResults[i].m00 + manyResults[i].m00 + vectorResults[i].x + directionResults[i].x + rotationResults[i].W() + sines[i] + cosines[i] + affineResults[i].m03
+            + matrix3Results[i].m00 + matrix3AResults[i].m00 + vector3Results[i].x + decayed[i];
+    std::cout << "Checksum: " << checksum << '\n';
+
+    return 0;
+}
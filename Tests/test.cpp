@@ -35,6 +35,293 @@ namespace TestCalc
         EXPECT_TRUE(Calc::Equals(1.f, 1.00000075f));
         EXPECT_FALSE(Calc::Equals(1.f, 1.0000075f));
     }
+
+    TEST(calc, SinCos)
+    {
+        constexpr auto SinCos = [](const float_t angle) { float_t sin, cos; Calc::SinCos(angle, &sin, &cos); return std::pair(sin, cos); };
+        static_assert(SinCos(0.f).first == 0.f && SinCos(0.f).second == 1.f);
+        static_assert(Calc::Abs(SinCos(Calc::PiOver2).first - 1.f) < 1e-7f);
+
+        for (float_t angle = -1000.f; angle < 1000.f; angle += 0.0137f)
+        {
+            const auto [sin, cos] = SinCos(angle);
+            EXPECT_NEAR(sin, std::sin(static_cast<double_t>(angle)), 2e-7);
+            EXPECT_NEAR(cos, std::cos(static_cast<double_t>(angle)), 2e-7);
+        }
+        EXPECT_EQ(SinCos(3e7f).first, std::sin(3e7f));
+
+        std::vector<float_t> angles;
+        for (float_t angle = -8192.f; angle < 8192.f; angle += 7.9f)
+            angles.push_back(angle);
+        angles[5] = 1e7f;
+        std::vector<float_t> sines(angles.size()), cosines(angles.size());
+        Calc::SinCos(angles, sines, cosines);
+        for (size_t i = 0; i < angles.size(); i++)
+        {
+            EXPECT_NEAR(sines[i], std::sin(static_cast<double_t>(angles[i])), 2e-7);
+            EXPECT_NEAR(cosines[i], std::cos(static_cast<double_t>(angles[i])), 2e-7);
+        }
+
+        // In place
+        std::vector<float_t> inPlace = angles;
+        Calc::SinCos(inPlace, inPlace, cosines);
+        EXPECT_EQ(inPlace, sines);
+
+        EXPECT_THROW(Calc::SinCos(angles, std::span(sines).first(3), cosines), std::invalid_argument);
+    }
+
+    TEST(calc, Rounding)
+    {
+        static_assert(Calc::Round(2.5f) == 3.f && Calc::Round(-2.5f) == -3.f && Calc::Round(-2.4f) == -2.f);
+        static_assert(Calc::Floor(-0.5f) == -1.f && Calc::Floor(3e9f) == 3e9f && Calc::Floor(-7.) == -7.);
+        static_assert(Calc::Ceil(-1.5f) == -1.f && Calc::Ceil(0.1f) == 1.f && Calc::Ceil(1e300) == 1e300);
+        static_assert(Calc::Trunc(-8388607.5f) == -8388607.f);
+        static_assert(Calc::Modulo(-7.5f, 2.f) == -1.5f && Calc::Modulo(5e9, 3.) == 2.);
+
+        // Compares the bits to also check the sign of zeros
+        constexpr auto Bits = [](const float_t value) { return std::bit_cast<uint32_t>(value); };
+
+        std::vector<float_t> values;
+        for (float_t x = -10.f; x <= 10.f; x += 0.25f)
+            values.push_back(x);
+        for (const float_t x : { -0.f, 0.49999997f, -0.49999997f, 8388607.5f, -8388607.5f, 8388609.f, 3e9f, -3e9f, 1e38f,
+            std::numeric_limits<float_t>::infinity(), -std::numeric_limits<float_t>::infinity(), std::numeric_limits<float_t>::denorm_min() })
+            values.push_back(x);
+
+        for (const float_t x : values)
+        {
+            SCOPED_TRACE(x);
+            EXPECT_EQ(Bits(Calc::Round(x)), Bits(std::round(x)));
+            EXPECT_EQ(Bits(Calc::Floor(x)), Bits(std::floor(x)));
+            EXPECT_EQ(Bits(Calc::Ceil(x)), Bits(std::ceil(x)));
+            EXPECT_EQ(Bits(Calc::Trunc(x)), Bits(std::trunc(x)));
+        }
+        EXPECT_TRUE(std::isnan(Calc::Round(std::numeric_limits<float_t>::quiet_NaN())));
+        EXPECT_EQ(Calc::Modulo(-7.5f, 2.f), -1.5f);
+        EXPECT_EQ(Calc::Modulo(3e9f, 7.f), std::fmod(3e9f, 7.f));
+
+        const Dispatch::InstructionSet previous = Dispatch::CurrentInstructionSet();
+        for (const Dispatch::InstructionSet instructionSet : { Dispatch::InstructionSet::Scalar, Dispatch::InstructionSet::Sse41, Dispatch::InstructionSet::Avx2, Dispatch::InstructionSet::Avx512 })
+        {
+            if (Dispatch::SetInstructionSet(instructionSet) != instructionSet)
+                break;
+
+            SCOPED_TRACE(Dispatch::ToString(instructionSet));
+            std::vector<float_t> rounded(values.size()), floored(values.size()), ceiled(values.size());
+            Calc::Round(values, rounded);
+            Calc::Floor(values, floored);
+            Calc::Ceil(values, ceiled);
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                EXPECT_EQ(Bits(rounded[i]), Bits(std::round(values[i])));
+                EXPECT_EQ(Bits(floored[i]), Bits(std::floor(values[i])));
+                EXPECT_EQ(Bits(ceiled[i]), Bits(std::ceil(values[i])));
+            }
+
+            // In place, and with an odd number of components to go through the remainder of the wide kernels
+            std::vector<Vector3> vectors = { Vector3(0.5f, -1.5f, 2.7f), Vector3(-0.2f, 3.5f, -4.5f), Vector3(9.9f, -9.9f, 0.f) };
+            Calc::Round(vectors, vectors);
+            EXPECT_EQ(vectors[0], Vector3(1.f, -2.f, 3.f));
+            EXPECT_EQ(vectors[1], Vector3(-0.f, 4.f, -5.f));
+            EXPECT_EQ(vectors[2], Vector3(10.f, -10.f, 0.f));
+
+            const Vector2 vectors2[] = { Vector2(0.5f, -1.5f) };
+            Vector2 floored2[1];
+            Calc::Floor(vectors2, floored2);
+            EXPECT_EQ(floored2[0], Calc::Floor(vectors2[0]));
+
+            const Vector4 vectors4[] = { Vector4(0.5f, -1.5f, 2.7f, -0.2f), Vector4(1.f, 1.1f, -1.1f, 100.5f) };
+            Vector4 ceiled4[2];
+            Calc::Ceil(vectors4, ceiled4);
+            EXPECT_EQ(ceiled4[0], Calc::Ceil(vectors4[0]));
+            EXPECT_EQ(ceiled4[1], Calc::Ceil(vectors4[1]));
+        }
+        Dispatch::SetInstructionSet(previous);
+
+        EXPECT_THROW(Calc::Round(values, std::span(values).first(3)), std::invalid_argument);
+    }
+
+    TEST(calc, Denormals)
+    {
+        static_assert(Calc::IsDenormal(std::numeric_limits<float_t>::denorm_min()) && Calc::IsDenormal(-1e-40f));
+        static_assert(!Calc::IsDenormal(0.f) && !Calc::IsDenormal(-0.f) && !Calc::IsDenormal(std::numeric_limits<float_t>::min()));
+        static_assert(Calc::IsDenormal(1e-310) && !Calc::IsDenormal(std::numeric_limits<double_t>::quiet_NaN()));
+
+        // Volatile so that the products are computed at run-time
+        volatile float_t small = 1e-30f;
+        const bool_t previous = Calc::AreDenormalsFlushed();
+        {
+            Calc::FlushDenormalsScope flushDenormals;
+#ifdef MATH_SIMD_SSE
+            EXPECT_TRUE(Calc::AreDenormalsFlushed());
+            EXPECT_EQ(small * 1e-10f, 0.f);
+#endif
+        }
+        EXPECT_EQ(Calc::AreDenormalsFlushed(), previous);
+        if (!previous)
+            EXPECT_TRUE(Calc::IsDenormal(small * 1e-10f));
+
+        Calc::ResetDenormalCounts();
+        volatile float_t value = 2e-38f;
+        EXPECT_TRUE(Calc::IsDenormal(Calc::Lerp(value, 0.f, 0.5f)));
+        EXPECT_FALSE(Calc::IsDenormal(Easing::ExpoOut(1.f)));
+
+        const std::vector<Calc::DenormalCount> counts = Calc::GetDenormalCounts();
+#ifdef MATH_COUNT_DENORMALS
+        const auto lerp = std::ranges::find_if(counts, [](const Calc::DenormalCount& count) { return std::string_view(count.function).find("Lerp") != std::string_view::npos; });
+        ASSERT_NE(lerp, counts.end());
+        EXPECT_EQ(lerp->calls, 1u);
+        EXPECT_EQ(lerp->inputs, 0u);
+        EXPECT_EQ(lerp->outputs, 1u);
+
+        Calc::ResetDenormalCounts();
+        EXPECT_TRUE(Calc::GetDenormalCounts().empty());
+#else
+        EXPECT_TRUE(counts.empty());
+#endif
+    }
+
+    TEST(calc, FastMath)
+    {
+        static_assert(Calc::Abs(Calc::FastRsqrt(4.f) - 0.5f) < 1e-5f);
+        static_assert(Calc::Abs(Calc::FastExp2(3.f) - 8.f) < 1e-5f);
+
+        for (float_t x = 1e-3f; x < 1e3f; x *= 1.01f)
+            EXPECT_NEAR(Calc::FastRsqrt(x) * std::sqrt(x), 1.f, 5e-6f);
+
+        for (float_t angle = -100.f; angle < 100.f; angle += 0.01f)
+        {
+            float_t sin, cos;
+            Calc::FastSinCos(angle, &sin, &cos);
+            EXPECT_NEAR(sin, std::sin(angle), 5e-6f);
+            EXPECT_NEAR(cos, std::cos(angle), 5e-6f);
+        }
+
+        for (float_t x = -1.f; x <= 1.f; x += 0.001f)
+            EXPECT_NEAR(Calc::FastAcos(x), std::acos(x), 8e-5f);
+        EXPECT_NEAR(Calc::FastAcos(1.f), 0.f, 8e-5f);
+        EXPECT_NEAR(Calc::FastAcos(-1.f), Calc::Pi, 8e-5f);
+
+        for (float_t x = -20.f; x < 20.f; x += 0.01f)
+            EXPECT_NEAR(Calc::FastExp2(x) / std::exp2(x), 1.f, 3e-7f);
+    }
+
+    TEST(calc, ConstexprMath)
+    {
+        static_assert(Calc::Sqrt(16.f) == 4.f);
+        static_assert(Calc::Exp2(10.f) == 1024.f);
+        static_assert(Calc::Exp2(-149.f) == std::numeric_limits<float_t>::denorm_min());
+        static_assert(Calc::Log2(8.f) == 3.f);
+        static_assert(Calc::Log2(std::numeric_limits<double_t>::denorm_min()) == -1074.);
+        static_assert(Calc::Pow(-2.f, 3.f) == -8.f);
+        static_assert(Calc::Pow(0.f, 2.f) == 0.f);
+        static_assert(Calc::Sqrt(-1.f) != Calc::Sqrt(-1.f));
+        static_assert(Calc::Pow(-2.f, 0.5f) != Calc::Pow(-2.f, 0.5f));
+
+        // IEEE special cases of pow
+        constexpr double_t Infinity = std::numeric_limits<double_t>::infinity();
+        static_assert(Calc::Pow(-1., Infinity) == 1.);
+        static_assert(Calc::Pow(-1., -Infinity) == 1.);
+        static_assert(Calc::Pow(-0., -1.) == -Infinity);
+        static_assert(Calc::Pow(-0., -2.) == Infinity);
+        static_assert(std::bit_cast<uint64_t>(Calc::Pow(-0., 3.)) == std::bit_cast<uint64_t>(-0.));
+        static_assert(std::bit_cast<uint64_t>(Calc::Pow(-0., 2.)) == std::bit_cast<uint64_t>(0.));
+        static_assert(Calc::Pow(-0.5, Infinity) == 0.);
+        static_assert(Calc::Pow(-Infinity, -1.) == 0.);
+
+        // Computed at compile-time and checked against the standard library at run-time
+        struct Results
+        {
+            std::array<float_t, 200> x, sqrt, sin, cos, tan, exp2, log2, pow;
+        };
+        constexpr Results Constant = []
+        {
+            Results results;
+            for (size_t i = 0; i < results.x.size(); i++)
+            {
+                const float_t x = 0.173f * static_cast<float_t>(i) + 0.01f;
+                results.x[i] = x;
+                results.sqrt[i] = Calc::Sqrt(x);
+                results.sin[i] = Calc::Sin(x - 17.f);
+                results.cos[i] = Calc::Cos(x - 17.f);
+                results.tan[i] = Calc::Tan(x - 17.f);
+                results.exp2[i] = Calc::Exp2(x * 4.f - 70.f);
+                results.log2[i] = Calc::Log2(x);
+                results.pow[i] = Calc::Pow(x, 3.7f);
+            }
+            return results;
+        }();
+
+        // Subnormal inputs
+        constexpr std::array<double_t, 4> Subnormals = { 1e-320, 1e-310, 2e-308, std::numeric_limits<double_t>::denorm_min() };
+        constexpr std::array<double_t, Subnormals.size()> SubnormalSqrts = [&]
+        {
+            std::array<double_t, Subnormals.size()> results;
+            for (size_t i = 0; i < Subnormals.size(); i++)
+                results[i] = Calc::Sqrt(Subnormals[i]);
+            return results;
+        }();
+        for (size_t i = 0; i < Subnormals.size(); i++)
+            EXPECT_DOUBLE_EQ(SubnormalSqrts[i], std::sqrt(Subnormals[i]));
+
+        for (size_t i = 0; i < Constant.x.size(); i++)
+        {
+            const float_t x = Constant.x[i];
+            EXPECT_EQ(Constant.sqrt[i], std::sqrt(x));
+            EXPECT_NEAR(Constant.sin[i], std::sin(x - 17.f), 2e-7f);
+            EXPECT_NEAR(Constant.cos[i], std::cos(x - 17.f), 2e-7f);
+            EXPECT_NEAR(Constant.tan[i] / std::tan(x - 17.f), 1.f, 1e-6f);
+            EXPECT_FLOAT_EQ(Constant.exp2[i], std::exp2(x * 4.f - 70.f));
+            EXPECT_FLOAT_EQ(Constant.log2[i], std::log2(x));
+            EXPECT_FLOAT_EQ(Constant.pow[i], std::pow(x, 3.7f));
+        }
+    }
+
+    TEST(calc, ConstexprEasing)
+    {
+        constexpr std::array<Easing::Easer, 9> Easers = {
+            Easing::SineIn, Easing::SineOut, Easing::SineInOut,
+            Easing::ExpoIn, Easing::ExpoOut, Easing::ExpoInOut,
+            Easing::CircIn, Easing::CircOut, Easing::CircInOut
+        };
+
+        // Easing tables baked at compile-time
+        constexpr std::array<std::array<float_t, 21>, Easers.size()> Tables = [&]
+        {
+            std::array<std::array<float_t, 21>, Easers.size()> tables;
+            for (size_t i = 0; i < Easers.size(); i++)
+            {
+                for (size_t j = 0; j < tables[i].size(); j++)
+                    tables[i][j] = Easers[i](static_cast<float_t>(j) / 20.f);
+            }
+            return tables;
+        }();
+
+        static_assert(Easing::ExpoIn(1.f) == 1.f);
+        static_assert(Easing::CircOut(0.25f) == 0.5f);
+
+        for (size_t i = 0; i < Easers.size(); i++)
+        {
+            for (size_t j = 0; j < Tables[i].size(); j++)
+                EXPECT_NEAR(Tables[i][j], Easers[i](static_cast<float_t>(j) / 20.f), 2e-7f);
+        }
+    }
+
+    TEST(calc, FastEasing)
+    {
+        constexpr std::pair<Easing::Easer, Easing::Easer> Easers[] = {
+            { Easing::SineIn, Easing::Fast::SineIn }, { Easing::SineOut, Easing::Fast::SineOut }, { Easing::SineInOut, Easing::Fast::SineInOut },
+            { Easing::ExpoIn, Easing::Fast::ExpoIn }, { Easing::ExpoOut, Easing::Fast::ExpoOut }, { Easing::ExpoInOut, Easing::Fast::ExpoInOut },
+            { Easing::ElasticIn, Easing::Fast::ElasticIn }, { Easing::ElasticOut, Easing::Fast::ElasticOut }, { Easing::ElasticInOut, Easing::Fast::ElasticInOut },
+            { Easing::BounceIn, Easing::Fast::BounceIn }, { Easing::BounceOut, Easing::Fast::BounceOut }, { Easing::BounceInOut, Easing::Fast::BounceInOut }
+        };
+
+        for (const auto& [precise, fast] : Easers)
+        {
+            for (float_t t = 0.f; t <= 1.f; t += 0.01f)
+                EXPECT_NEAR(fast(t), precise(t), 1e-4f);
+        }
+    }
 }
 
 namespace TestVector2
@@ -64,6 +351,34 @@ namespace TestVector2
 
         EXPECT_EQ(X4.Normalized().SquaredLength(), 1.f);
         EXPECT_EQ(Y4.Normalized().Length(), 1.f);
+
+        EXPECT_NEAR(Vector2(1.f, 2.f).Normalized(Calc::FastMath).Length(), 1.f, 1e-5f);
+        EXPECT_TRUE(Calc::Equals(Zero.Normalized(Calc::FastMath), Zero));
+    }
+
+    TEST(Vector2, BatchNormalization)
+    {
+        // 19 vectors to go through the wide loops and the remainders of the kernels
+        Vector2 vectors[19];
+        for (size_t i = 0; i < std::size(vectors); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            vectors[i] = Vector2(f - 9.f, 0.5f * f);
+        }
+        vectors[4] = Zero;
+        vectors[11] = Vector2(1e-7f, 0.f);
+
+        Vector2 normalized[std::size(vectors)];
+        Vector2::Normalize(vectors, normalized);
+        for (size_t i = 0; i < std::size(vectors); i++)
+            EXPECT_TRUE(Calc::Equals(normalized[i], vectors[i].Normalized()));
+        EXPECT_EQ(normalized[4], Zero);
+        EXPECT_EQ(normalized[11], Zero);
+
+        Vector2::NormalizeInPlace(vectors);
+        EXPECT_TRUE(std::ranges::equal(vectors, normalized));
+
+        EXPECT_THROW(Vector2::Normalize(vectors, std::span(normalized).first(1)), std::invalid_argument);
     }
 
     TEST(Vector2, Normal)
@@ -87,6 +402,7 @@ namespace TestVector2
     TEST(Vector2, SubscriptOutOfRangeThrow)
     {
         EXPECT_THROW(UnitX[2], std::out_of_range);
+        EXPECT_EQ(UnitX.UncheckedAt(0), 1.f);
     }
 
     TEST(Vector2, Checks)
@@ -225,6 +541,34 @@ namespace TestVector3
 
         EXPECT_EQ(X4.Normalized().SquaredLength(), 1.f);
         EXPECT_EQ(Y4.Normalized().Length(), 1.f);
+
+        EXPECT_NEAR(Vector3(1.f, 2.f, 3.f).Normalized(Calc::FastMath).Length(), 1.f, 1e-5f);
+        EXPECT_TRUE(Calc::Equals(Zero.Normalized(Calc::FastMath), Zero));
+    }
+
+    TEST(Vector3, BatchNormalization)
+    {
+        // 19 vectors to go through the wide loops and the remainders of the kernels
+        Vector3 vectors[19];
+        for (size_t i = 0; i < std::size(vectors); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            vectors[i] = Vector3(f - 9.f, 0.5f * f, 2.f);
+        }
+        vectors[4] = Zero;
+        vectors[11] = Vector3(0.f, 1e-7f, 0.f);
+
+        Vector3 normalized[std::size(vectors)];
+        Vector3::Normalize(vectors, normalized);
+        for (size_t i = 0; i < std::size(vectors); i++)
+            EXPECT_TRUE(Calc::Equals(normalized[i], vectors[i].Normalized()));
+        EXPECT_EQ(normalized[4], Zero);
+        EXPECT_EQ(normalized[11], Zero);
+
+        Vector3::NormalizeInPlace(vectors);
+        EXPECT_TRUE(std::ranges::equal(vectors, normalized));
+
+        EXPECT_THROW(Vector3::Normalize(vectors, std::span(normalized).first(1)), std::invalid_argument);
     }
 
     TEST(Vector3, DotProduct)
@@ -280,6 +624,102 @@ namespace TestVector3
     }
 }
 
+// ReSharper disable once CppInconsistentNaming
+namespace TestVector3A
+{
+    constexpr Vector3A Zero = Vector3A::Zero();
+    constexpr Vector3A UnitX = Vector3A::UnitX();
+    constexpr Vector3A UnitY = Vector3A::UnitY();
+    constexpr Vector3A UnitZ = Vector3A::UnitZ();
+
+    constexpr Vector3A X4(4.f, 0.f, 0.f);
+    constexpr Vector3A Y4(0.f, 4.f, 0.f);
+
+    TEST(Vector3A, Constants)
+    {
+        EXPECT_TRUE(Calc::Equals(Vector3A::Zero(), Vector3A()));
+
+        EXPECT_TRUE(Calc::Equals(UnitX, Vector3A(1.f, 0.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(UnitY, Vector3A(0.f, 1.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(UnitZ, Vector3A(0.f, 0.f, 1.f)));
+    }
+
+    TEST(Vector3A, LengthAndNormalization)
+    {
+        EXPECT_EQ(X4.SquaredLength(), 16.f);
+        EXPECT_EQ(Y4.Length(), 4.f);
+
+        EXPECT_EQ(Zero.SquaredLength(), 0.f);
+        EXPECT_EQ(Zero.Length(), 0.f);
+
+        EXPECT_EQ(X4.Normalized().SquaredLength(), 1.f);
+        EXPECT_EQ(Y4.Normalized().Length(), 1.f);
+        EXPECT_TRUE(Calc::Equals(Zero.Normalized(), Zero));
+
+        EXPECT_NEAR(Vector3A(1.f, 2.f, 3.f).Normalized(Calc::FastMath).Length(), 1.f, 1e-5f);
+        EXPECT_TRUE(Calc::Equals(Zero.Normalized(Calc::FastMath), Zero));
+    }
+
+    TEST(Vector3A, DotAndCrossProducts)
+    {
+        EXPECT_EQ(Vector3A::Dot(UnitX, UnitY), 0.f);
+        EXPECT_EQ(Vector3A::Dot(UnitX, UnitX), 1.f);
+        EXPECT_EQ(Vector3A::Dot(UnitX, -UnitX), -1.f);
+
+        EXPECT_TRUE(Calc::Equals(Vector3A::Cross(UnitX, UnitY), UnitZ));
+
+        // Run-time products may use SIMD instructions and must match their compile-time counterparts
+        constexpr Vector3A a(1.f, 2.f, 3.f);
+        constexpr Vector3A b(-4.f, 5.f, 0.5f);
+        constexpr Vector3A cross = Vector3A::Cross(a, b);
+        constexpr float_t dot = Vector3A::Dot(a, b);
+
+        Vector3A runtime = a;
+        EXPECT_TRUE(Calc::Equals(Vector3A::Cross(runtime, b), cross));
+        EXPECT_EQ(Vector3A::Dot(runtime, b), dot);
+        EXPECT_TRUE(Calc::Equals(static_cast<Vector3>(cross), Vector3::Cross(static_cast<Vector3>(a), static_cast<Vector3>(b))));
+    }
+
+    TEST(Vector3A, Conversions)
+    {
+        constexpr Vector3 v(1.f, -2.f, 3.5f);
+        EXPECT_EQ(static_cast<Vector3>(Vector3A(v)), v);
+    }
+
+    TEST(Vector3A, SubscriptOutOfRangeThrow)
+    {
+        EXPECT_THROW(UnitX[3], std::out_of_range);
+    }
+
+    TEST(Vector3A, Operators)
+    {
+        EXPECT_TRUE(Calc::Equals(UnitX + UnitY, Vector3A(1.f, 1.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(UnitX - UnitX, Vector3A(0.f)));
+
+        EXPECT_TRUE(Calc::Equals(UnitX * 2.f, Vector3A(2.f, 0.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(Vector3A(1.f) * Vector3A(2.f, 0.5f, 0.f), Vector3A(2.f, 0.5f, 0.f)));
+
+        EXPECT_TRUE(Calc::Equals(UnitX / 2.f, Vector3A(0.5f, 0.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(Vector3A(1.f) / Vector3A(2.f, 0.5f, 1.f), Vector3A(0.5f, 2.f, 1.f)));
+
+        Vector3A temp = UnitX;
+        EXPECT_TRUE(Calc::Equals(temp += UnitY, Vector3A(1.f, 1.f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(temp -= UnitX, UnitY));
+
+        temp = Vector3A(1.f);
+        EXPECT_TRUE(Calc::Equals(temp *= 2.f, Vector3A(2.f)));
+        EXPECT_TRUE(Calc::Equals(temp *= Vector3A(2.f, 0.5f, 0.f), Vector3A(4.f, 1.f, 0.f)));
+
+        EXPECT_TRUE(Calc::Equals(temp /= 2.f, Vector3A(2.f, 0.5f, 0.f)));
+        EXPECT_TRUE(Calc::Equals(temp /= Vector3A(2.f, 0.5f, 1.f), Vector3A(1.f, 1.f, 0.f)));
+    }
+
+    TEST(Vector3A, Formatting)
+    {
+        EXPECT_EQ(std::format("{0:06.3f}", UnitX), "01.000 ; 00.000 ; 00.000");
+    }
+}
+
 namespace TestVector4
 {
     constexpr Vector4 Zero = Vector4::Zero();
@@ -310,6 +750,34 @@ namespace TestVector4
 
         EXPECT_EQ(X4.Normalized().SquaredLength(), 1.f);
         EXPECT_EQ(Y4.Normalized().Length(), 1.f);
+
+        EXPECT_NEAR(Vector4(1.f, 2.f, 3.f, 4.f).Normalized(Calc::FastMath).Length(), 1.f, 1e-5f);
+        EXPECT_TRUE(Calc::Equals(Zero.Normalized(Calc::FastMath), Zero));
+    }
+
+    TEST(Vector4, BatchNormalization)
+    {
+        // 19 vectors to go through the wide loops and the remainders of the kernels
+        Vector4 vectors[19];
+        for (size_t i = 0; i < std::size(vectors); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            vectors[i] = Vector4(f - 9.f, 0.5f * f, 2.f, -1.f);
+        }
+        vectors[4] = Zero;
+        vectors[11] = Vector4(0.f, 0.f, 1e-7f, 0.f);
+
+        Vector4 normalized[std::size(vectors)];
+        Vector4::Normalize(vectors, normalized);
+        for (size_t i = 0; i < std::size(vectors); i++)
+            EXPECT_TRUE(Calc::Equals(normalized[i], vectors[i].Normalized()));
+        EXPECT_EQ(normalized[4], Zero);
+        EXPECT_EQ(normalized[11], Zero);
+
+        Vector4::NormalizeInPlace(vectors);
+        EXPECT_TRUE(std::ranges::equal(vectors, normalized));
+
+        EXPECT_THROW(Vector4::Normalize(vectors, std::span(normalized).first(1)), std::invalid_argument);
     }
 
     TEST(Vector4, DotProduct)
@@ -365,6 +833,106 @@ namespace TestVector4
     }
 }
 
+namespace TestVectorT
+{
+    TEST(VectorT, Layout)
+    {
+        static_assert(sizeof(Vector3i) == 3 * sizeof(int32_t));
+        static_assert(sizeof(Vector4d) == 4 * sizeof(double_t));
+        static_assert(std::is_same_v<Vector3, VectorT<3, float_t>>);
+        static_assert(std::is_same_v<Vector2i, VectorT<2, int32_t>>);
+
+        constexpr Vector3i v(1, 2, 3);
+        EXPECT_EQ(v.z, 3);
+        EXPECT_EQ(v[1], 2);
+        EXPECT_EQ(v.Data()[2], 3);
+        EXPECT_THROW(v[3], std::out_of_range);
+
+        static_assert(Vector4i::UnitW() == Vector4i(0, 0, 0, 1));
+        static_assert(Vector3d::One() == Vector3d(1.));
+    }
+
+    TEST(VectorT, IntegerOperations)
+    {
+        constexpr Vector4i a(1, -2, 300000, -7);
+        constexpr Vector4i b(-5, 4, 70000, 3);
+
+        // Compile-time results use the scalar path, so they check the SIMD results computed at run-time
+        constexpr Vector4i sum = a + b;
+        constexpr Vector4i difference = a - b;
+        constexpr Vector4i product = a * Vector4i(3, -3, 2, -1);
+        constexpr Vector4i min = Vector4i::Min(a, b);
+        constexpr Vector4i max = Vector4i::Max(a, b);
+
+        const Vector4i lhs = a;
+        EXPECT_EQ(lhs + b, sum);
+        EXPECT_EQ(lhs - b, difference);
+        EXPECT_EQ(lhs * Vector4i(3, -3, 2, -1), product);
+        EXPECT_EQ(product, Vector4i(3, 6, 600000, 7));
+        EXPECT_EQ(Vector4i::Min(lhs, b), min);
+        EXPECT_EQ(Vector4i::Max(lhs, b), max);
+        EXPECT_EQ(min, Vector4i(-5, -2, 70000, -7));
+        EXPECT_EQ(-lhs, Vector4i(-1, 2, -300000, 7));
+        EXPECT_EQ(lhs / 2, Vector4i(0, -1, 150000, -3));
+
+        Vector3i voxel(4, 5, 6);
+        voxel += Vector3i(1);
+        voxel *= 2;
+        EXPECT_EQ(voxel, Vector3i(10, 12, 14));
+        EXPECT_EQ(Vector3i::Dot(voxel, Vector3i::UnitY()), 12);
+        EXPECT_EQ(Vector3i::Cross(Vector3i::UnitX(), Vector3i::UnitY()), Vector3i::UnitZ());
+        EXPECT_EQ(Vector3i(3, 4, 0).Length(), 5.f);
+    }
+
+    TEST(VectorT, DoubleOperations)
+    {
+        constexpr Vector3d a(1e8, 2., -3.);
+        const Vector3d b(0.5, 4., 6.);
+
+        EXPECT_EQ(a + b, Vector3d(100000000.5, 6., 3.));
+        EXPECT_EQ(a * b, Vector3d(5e7, 8., -18.));
+        EXPECT_EQ(a / b, Vector3d(2e8, .5, -.5));
+        EXPECT_EQ(Vector4d::Max(Vector4d(1., -1., 2., -2.), Vector4d(-1.)), Vector4d(1., -1., 2., -1.));
+
+        // A Vector3 can't tell 1e8 and 1e8 + 0.5 apart
+        EXPECT_EQ(static_cast<Vector3>(a + b).x, 1e8f);
+        EXPECT_EQ((a + b).x - a.x, .5);
+
+        EXPECT_TRUE(Calc::Equals(Vector3d(3., 0., 4.).Normalized(), Vector3d(.6, 0., .8)));
+        EXPECT_EQ(Vector3d().Normalized(), Vector3d::Zero());
+    }
+
+    TEST(VectorT, Conversions)
+    {
+        constexpr Vector3 v(1.5f, -2.f, 3.f);
+        constexpr Vector3d vd(v);
+        EXPECT_EQ(vd, Vector3d(1.5, -2., 3.));
+        EXPECT_TRUE(Calc::Equals(static_cast<Vector3>(vd), v));
+        EXPECT_EQ(static_cast<Vector3i>(v), Vector3i(1, -2, 3));
+        EXPECT_EQ(Vector2d(Vector2i(1, 2)), Vector2d(1., 2.));
+    }
+
+    TEST(VectorT, MatrixProduct)
+    {
+        constexpr Matrix3x4 affine(
+            1.f, 0.f, 0.f, 5.f,
+            0.f, 2.f, 0.f, 6.f,
+            0.f, 0.f, 3.f, 7.f
+        );
+        constexpr Vector3 transformed = affine * Vector4(1.f, 1.f, 1.f, 1.f);
+        EXPECT_EQ(transformed, Vector3(6.f, 8.f, 10.f));
+
+        constexpr Matrix3d m(Matrix3::Identity());
+        EXPECT_EQ(m * Vector3d(1., 2., 3.), Vector3d(1., 2., 3.));
+    }
+
+    TEST(VectorT, Formatting)
+    {
+        EXPECT_EQ(std::format("{}", Vector3i(1, -2, 3)), "1 ; -2 ; 3");
+        EXPECT_EQ(std::format("{:.1f}", Vector2d(1., 2.5)), "1.0 ; 2.5");
+    }
+}
+
 namespace TestQuaternion
 {
     constexpr Quaternion Zero = Quaternion::Zero();
@@ -401,6 +969,36 @@ namespace TestQuaternion
 
         EXPECT_EQ(X4.Normalized().SquaredLength(), 1.f);
         EXPECT_EQ(Y4.Normalized().Length(), 1.f);
+        EXPECT_NEAR(Quaternion(1.f, 2.f, 3.f, 4.f).Normalized(Calc::FastMath).Length(), 1.f, 1e-5f);
+    }
+
+    TEST(Quaternion, BatchNormalization)
+    {
+        // 19 quaternions to go through the wide loops and the remainders of the kernels
+        Quaternion quaternions[19];
+        for (size_t i = 0; i < std::size(quaternions); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            quaternions[i] = Quaternion(0.25f * f, -1.f, f - 9.f, 3.f);
+        }
+        quaternions[4] = Zero;
+        quaternions[11] = Quaternion(0.f, 0.f, 0.f, 1e-7f);
+
+        Quaternion normalized[std::size(quaternions)];
+        Quaternion::Normalize(quaternions, normalized);
+        // Unlike the batch version, Normalized divides by zero lengths
+        for (size_t i = 0; i < std::size(quaternions); i++)
+        {
+            if (i != 4 && i != 11)
+                EXPECT_TRUE(Calc::Equals(normalized[i], quaternions[i].Normalized()));
+        }
+        EXPECT_EQ(normalized[4], Zero);
+        EXPECT_EQ(normalized[11], Zero);
+
+        Quaternion::NormalizeInPlace(quaternions);
+        EXPECT_TRUE(std::ranges::equal(quaternions, normalized));
+
+        EXPECT_THROW(Quaternion::Normalize(quaternions, std::span(normalized).first(1)), std::invalid_argument);
     }
 
     TEST(Quaternion, DotProduct)
@@ -414,6 +1012,14 @@ namespace TestQuaternion
     {
         EXPECT_TRUE(Calc::Equals(Quaternion::Lerp(Quaternion::Zero(), Quaternion(1.f), 0.5f), Quaternion(0.5f)));
         EXPECT_TRUE(Calc::Equals(Quaternion::Slerp(Quaternion::Zero(), Quaternion(1.f), 0.5f), Quaternion(0.707107f)));
+
+        const Quaternion from = Quaternion::FromAxisAngle(Vector3::UnitX(), 0.3f);
+        const Quaternion to = -Quaternion::FromAxisAngle(Vector3(1.f, 2.f, 3.f).Normalized(), 2.5f);
+        for (float_t t = 0.f; t <= 1.f; t += 0.05f)
+        {
+            const Quaternion difference = Quaternion::Slerp(from, to, t, Calc::FastMath) - Quaternion::Slerp(from, to, t);
+            EXPECT_LT(difference.Length(), 1e-4f);
+        }
     }
 
     TEST(Quaternion, SubscriptOutOfRangeThrow)
@@ -440,6 +1046,23 @@ namespace TestQuaternion
         EXPECT_TRUE(Calc::Equals(Quaternion(RotatedUnitX), RotationHalfCircleZ * Vector3::UnitX() * RotationHalfCircleZ.Conjugate()));
 
         EXPECT_TRUE(Calc::Equals(RotationHalfCircleZ, Quaternion::FromEuler(Vector3(0.f, 0.f, Calc::PiOver2))));
+
+        std::vector<Vector3> rotations;
+        for (float_t angle = -4.f; angle < 4.f; angle += 0.07f)
+            rotations.emplace_back(angle * 0.8f, -angle, angle * 1.1f + 0.5f);
+        std::vector<Quaternion> results(rotations.size());
+        Quaternion::FromEuler(rotations, results);
+
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+            const Vector3& rotation = rotations[i];
+            const Quaternion expected = Quaternion::FromAxisAngle(Vector3::UnitZ(), rotation.z)
+                * Quaternion::FromAxisAngle(Vector3::UnitY(), rotation.y)
+                * Quaternion::FromAxisAngle(Vector3::UnitX(), rotation.x);
+            EXPECT_TRUE(Calc::Equals(Quaternion::FromEuler(rotation), expected));
+            EXPECT_TRUE(Calc::Equals(results[i], expected));
+            EXPECT_TRUE(Calc::Equals(Matrix::Rotation(results[i]), Matrix::Rotation(rotation)));
+        }
         EXPECT_TRUE(Calc::Equals(RotationHalfCircleZ, Quaternion::FromRotationMatrix(Matrix::RotationZ(Calc::PiOver2))));
     }
 
@@ -474,9 +1097,40 @@ namespace TestQuaternion
         EXPECT_TRUE(Calc::Equals(temp /= 2.f, Quaternion(0.5f)));
     }
 
+    TEST(Quaternion, DoublePrecision)
+    {
+        constexpr Quaterniond A(1., 2., 3., 4.);
+        constexpr Quaterniond B(-2., 0.5, 1., 3.);
+        const Quaterniond rotation = Quaterniond::FromAxisAngle(Vector3d(0., 0., 1.), static_cast<double_t>(Calc::PiOver2));
+
+        static_assert(Quaterniond::Identity() * A == A);
+        static_assert(A.SquaredLength() == 30.);
+        EXPECT_EQ(static_cast<Quaternion>(A * B), Quaternion(1.f, 2.f, 3.f, 4.f) * Quaternion(-2.f, 0.5f, 1.f, 3.f));
+        EXPECT_EQ(Quaterniond(UnitX), Quaterniond(1., 0., 0., 0.));
+        EXPECT_TRUE(Calc::Equals(static_cast<Quaternion>(rotation), RotationHalfCircleZ));
+        EXPECT_TRUE(Calc::Equals(static_cast<Vector3>(Quaterniond::Rotate(Vector3d(1., 0., 0.), rotation)), RotatedUnitX));
+        EXPECT_TRUE(Calc::Equals(static_cast<Quaternion>(A * A.Inverted()), Quaternion::Identity()));
+        EXPECT_NEAR(A.Normalized().Length(), 1., 1e-15);
+    }
+
+    TEST(Quaternion, Layout)
+    {
+#ifdef MATH_SIMD_ALIGN
+        static_assert(alignof(Quaternion) == 16 && alignof(Vector4) == 16 && alignof(Matrix) == 16);
+#endif
+
+        const Quaternion q(1.f, 2.f, 3.f, 4.f);
+        EXPECT_EQ(q.Data()[0], 1.f);
+        EXPECT_EQ(q.Data()[3], 4.f);
+        EXPECT_TRUE(Calc::Equals(Vector4(q.Data()), static_cast<Vector4>(q)));
+        EXPECT_EQ(Quaternion::Dot(q, q), q.SquaredLength());
+        EXPECT_TRUE(Calc::Equals(q.Normalized().Length(), 1.f));
+    }
+
     TEST(Quaternion, Formatting)
     {
         EXPECT_EQ(std::format("{0:06.3f}", UnitX), "01.000 ; 00.000 ; 00.000 ; 00.000");
+        EXPECT_EQ(std::format("{0:06.3f}", Quaterniond(UnitX)), "01.000 ; 00.000 ; 00.000 ; 00.000");
     }
 }
 
@@ -559,6 +1213,7 @@ namespace TestMatrix2
         );
 
         EXPECT_THROW(temp.Inverted(), std::invalid_argument);
+        EXPECT_FALSE(temp.TryInverted().has_value());
     }
 
     TEST(Matrix2, Rotation)
@@ -657,6 +1312,26 @@ namespace TestMatrix3
         EXPECT_TRUE(Calc::Equals(ab * One, Vector3(-10.f)));
     }
 
+    TEST(Matrix3, ProductExpression)
+    {
+        constexpr Matrix3 a(0.f, -1.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f);
+        constexpr Matrix3 b = Matrix3::Scaling(Vector3(-5.f));
+        constexpr Matrix3 c(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 10.f);
+
+        static_assert(std::same_as<decltype(a * b), Matrix3>);
+        const Matrix3 abc = a * b * c;
+        EXPECT_TRUE(Calc::Equals((a * b).Inverted(), b.Inverted() * a.Inverted()));
+        EXPECT_EQ((a * b).Transposed(), b.Transposed() * a.Transposed());
+        EXPECT_EQ((a * b).m01, -5.f * a.m01);
+
+        EXPECT_TRUE(Calc::Equals(abc, LazyProduct(a, b, c).Evaluate()));
+        EXPECT_TRUE(Calc::Equals(LazyProduct(a, b, c) * One, abc * One));
+        EXPECT_TRUE(Calc::Equals(LazyProduct(a, b, c) * Vector2(1.f, 2.f), abc * Vector2(1.f, 2.f)));
+
+        Matrix3 m = a;
+        EXPECT_TRUE(Calc::Equals(m *= b, a * b));
+    }
+
     TEST(Matrix3, Inversion)
     {
         EXPECT_TRUE(Calc::Equals(RotationHalfCircleZ * RotationHalfCircleZ.Inverted(), Identity));
@@ -673,6 +1348,20 @@ namespace TestMatrix3
     TEST(Matrix3, Rotation)
     {
         EXPECT_TRUE(Calc::Equals(Matrix3::RotationZ(Calc::PiOver2) * Vector3::UnitX(), Vector3::UnitY()));
+
+        std::vector<Vector3> rotations;
+        for (float_t angle = -4.f; angle < 4.f; angle += 0.07f)
+            rotations.emplace_back(-angle, angle * 0.4f - 2.f, angle * 1.7f);
+        std::vector<Matrix3> results(rotations.size());
+        Matrix3::Rotation(rotations, results);
+
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+            const Vector3& rotation = rotations[i];
+            const Matrix3 expected = Matrix3::RotationZ(rotation.z) * Matrix3::RotationY(rotation.y) * Matrix3::RotationX(rotation.x);
+            EXPECT_TRUE(Calc::Equals(Matrix3::Rotation(rotation), expected));
+            EXPECT_TRUE(Calc::Equals(results[i], expected));
+        }
     }
 
     TEST(Matrix3, Scaling)
@@ -686,6 +1375,11 @@ namespace TestMatrix3
         EXPECT_THROW(Zero.At(0, 3), std::out_of_range);
         EXPECT_THROW(Zero.At(3, 3), std::out_of_range);
         EXPECT_NO_THROW(Zero.At(1, 2));
+
+        Matrix3 m = Identity;
+        m.UncheckedAt(1, 2) = 5.f;
+        EXPECT_EQ(m.At(1, 2), 5.f);
+        EXPECT_EQ(Identity.UncheckedAt(2, 2), 1.f);
     }
 
     TEST(Matrix3, Formatting)
@@ -695,6 +1389,79 @@ namespace TestMatrix3
     }
 }
 
+namespace TestMatrix3A
+{
+    constexpr Matrix3 A(
+        2.f, -1.f, 0.5f,
+        1.f, 3.f, -2.f,
+        0.f, 1.5f, 4.f
+    );
+    const Matrix3 B = Matrix3::Rotation(Vector3(0.3f, -1.2f, 2.5f)) * Matrix3::Scaling(Vector3(2.f, 3.f, 4.f));
+
+    constexpr Vector3 Point(0.5f, 1.5f, -2.5f);
+
+    TEST(Matrix3A, Layout)
+    {
+        static_assert(Matrix3A::Identity().IsIdentity());
+
+        const Matrix3A a(A);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&a) % 16, 0);
+        EXPECT_EQ(a.Data()[4], -1.f);
+        EXPECT_EQ(a.At(2, 1), 1.5f);
+        EXPECT_THROW(a.At(3, 0), std::out_of_range);
+        EXPECT_THROW(a.At(0, 3), std::out_of_range);
+        EXPECT_EQ(static_cast<Matrix3>(a), A);
+        EXPECT_EQ(Matrix3A(A.Data()), a);
+        EXPECT_EQ(Matrix3A(a[0], a[1], a[2]), a);
+
+        Matrix3A temp = a;
+        temp[1] = Vector3A::UnitZ();
+        EXPECT_EQ(temp.m02, 0.5f);
+        EXPECT_EQ(temp.m01, 0.f);
+        EXPECT_EQ(temp.m21, 1.f);
+    }
+
+    TEST(Matrix3A, Operations)
+    {
+        const Matrix3A a(A);
+        const Matrix3A b(B);
+
+        EXPECT_TRUE(Calc::Equals(a * b, Matrix3A(Matrix3(A * B))));
+        EXPECT_TRUE(Calc::Equals(a * Point, A * Point));
+        EXPECT_TRUE(Calc::Equals(static_cast<Vector3>(b * Vector3A(Point)), B * Point));
+        EXPECT_TRUE(Calc::Equals(a + b, Matrix3A(A + B)));
+        EXPECT_TRUE(Calc::Equals(a - b, Matrix3A(A - B)));
+        EXPECT_TRUE(Calc::Equals(-a * 2.f, Matrix3A(A * -2.f)));
+        EXPECT_TRUE(Calc::Equals(a.Transposed(), Matrix3A(A.Transposed())));
+        EXPECT_NEAR(a.Determinant(), 34.75f, 1e-4f);
+        EXPECT_NEAR(b.Determinant(), 24.f, 1e-4f);
+
+        constexpr Matrix3A ConstexprA(A);
+        static_assert(ConstexprA.Determinant() == 34.75f);
+        static_assert(ConstexprA.Transposed().Transposed() == ConstexprA);
+        EXPECT_TRUE(Calc::Equals(ConstexprA * ConstexprA.Inverted(), Matrix3A::Identity()));
+        EXPECT_TRUE(Calc::Equals(ConstexprA.Inverted(), a.Inverted()));
+
+        Matrix3A temp = b;
+        EXPECT_TRUE(Calc::Equals(temp *= temp.Inverted(), Matrix3A::Identity()));
+        EXPECT_TRUE(Calc::Equals(b.Inverted() * (b * Point), Point));
+
+        temp = Matrix3A(Matrix3::Scaling(Vector3(1.f, 0.f, 1.f)));
+        EXPECT_THROW(temp.Inverted(), std::invalid_argument);
+
+        Matrix3A result = Matrix3A::Identity();
+        EXPECT_FALSE(temp.TryInverted(&result));
+        EXPECT_EQ(result, Matrix3A::Identity());
+        EXPECT_TRUE(b.TryInverted(&result));
+        EXPECT_TRUE(Calc::Equals(result, b.Inverted()));
+    }
+
+    TEST(Matrix3A, Formatting)
+    {
+        EXPECT_EQ(std::format("{0:06.3f}", Matrix3A::Identity()), "[ 01.000 ; 00.000 ; 00.000 ] [ 00.000 ; 01.000 ; 00.000 ] [ 00.000 ; 00.000 ; 01.000 ]");
+    }
+}
+
 namespace TestMatrix
 {
     constexpr Matrix Zero = Matrix();
@@ -719,6 +1486,16 @@ namespace TestMatrix
 
     constexpr Vector3 OneTwoThree(1.f, 2.f, 3.f);
 
+    // Calc::Equals uses an absolute tolerance, which elements of tens of units exceed when FMA contraction changes the rounding
+    void ExpectNear(const Matrix& actual, const Matrix& expected)
+    {
+        for (size_t i = 0; i < 16; i++)
+        {
+            const float_t value = expected.Data()[i];
+            EXPECT_NEAR(actual.Data()[i], value, 1e-6f * std::max(1.f, std::abs(value)));
+        }
+    }
+
     TEST(Matrix, Constants)
     {
         EXPECT_TRUE(Calc::Equals(Identity, Matrix(1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f)));
@@ -769,6 +1546,125 @@ namespace TestMatrix
         constexpr Matrix ts = t * s;
 
         EXPECT_TRUE(Calc::Equals(ts * One, Vector3(-4.f)));
+
+        // Run-time products may use SIMD instructions and must match their compile-time counterparts
+        constexpr Vector4 v(1.f, 2.f, 3.f, 0.5f);
+        constexpr Matrix symmetricAntisymmetric = Symmetric * Antisymmetric;
+        constexpr Vector4 antisymmetricV = Antisymmetric * v;
+
+        Matrix runtime = Symmetric;
+        EXPECT_TRUE(Calc::Equals(runtime * Antisymmetric, symmetricAntisymmetric));
+        EXPECT_TRUE(Calc::Equals(runtime *= Antisymmetric, symmetricAntisymmetric));
+
+        runtime = Antisymmetric;
+        EXPECT_TRUE(Calc::Equals(runtime * v, antisymmetricV));
+        EXPECT_TRUE(Calc::Equals(antisymmetricV, Vector4(16.f, 29.5f, 13.5f, -40.f)));
+    }
+
+    TEST(Matrix, BatchTrs)
+    {
+        Vector3 translations[13], scales[std::size(translations)];
+        Quaternion rotations[std::size(translations)];
+        for (size_t i = 0; i < std::size(translations); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            translations[i] = OneTwoThree * f;
+            rotations[i] = Quaternion::FromAxisAngle(Vector3(1.f, f, -2.f).Normalized(), 0.3f * f);
+            scales[i] = Vector3(1.f + f * 0.25f, 2.f, 0.5f);
+        }
+
+        Matrix results[std::size(translations)];
+        Matrix::Trs(translations, rotations, scales, results);
+        for (size_t i = 0; i < std::size(translations); i++)
+            EXPECT_TRUE(Calc::Equals(results[i], Matrix::Trs(translations[i], rotations[i], scales[i])));
+
+        EXPECT_NO_THROW(Matrix::Trs(std::span<const Vector3>(), std::span<const Quaternion>(), std::span<const Vector3>(), std::span<Matrix>()));
+        EXPECT_THROW(Matrix::Trs(translations, rotations, std::span(scales, 2), results), std::invalid_argument);
+        EXPECT_THROW(Matrix::Trs(translations, rotations, scales, std::span(results, 1)), std::invalid_argument);
+    }
+
+    TEST(Matrix, BatchMultiplication)
+    {
+        // Enough matrices to be split across the 4 threads, with integer components so that every product is exact
+        std::vector<Matrix> models(4 * Dispatch::MinimumCountPerThread + 3);
+        for (size_t i = 0; i < models.size(); i++)
+            models[i] = Matrix::Translation(Vector3(static_cast<float_t>(i % 7), -2.f, 1.f)) * Matrix::Scaling(Vector3(1.f + static_cast<float_t>(i % 3)));
+
+        const Matrix viewProjection = Antisymmetric;
+
+        for (const size_t threadCount : { size_t{1}, size_t{4}, size_t{0} })
+        {
+            SCOPED_TRACE(threadCount);
+
+            std::vector<Matrix> results(models.size());
+            Matrix::Multiply(viewProjection, models, results, threadCount);
+            for (size_t i = 0; i < models.size(); i++)
+                ASSERT_EQ(results[i], viewProjection * models[i]);
+
+            Matrix::Multiply(models, viewProjection, results, threadCount);
+            for (size_t i = 0; i < models.size(); i++)
+                ASSERT_EQ(results[i], models[i] * viewProjection);
+
+            // The shared matrix is the first result, which the first chunk overwrites while the other threads still read it
+            results[0] = viewProjection;
+            Matrix::Multiply(results[0], models, results, threadCount);
+            for (size_t i = 0; i < models.size(); i++)
+                ASSERT_EQ(results[i], viewProjection * models[i]);
+
+            results[0] = viewProjection;
+            Matrix::Multiply(models, results[0], results, threadCount);
+            for (size_t i = 0; i < models.size(); i++)
+                ASSERT_EQ(results[i], models[i] * viewProjection);
+        }
+
+        Matrix inPlace[] = { Symmetric, Antisymmetric, Identity };
+        Matrix::Multiply(Antisymmetric, inPlace, inPlace);
+        EXPECT_EQ(inPlace[0], Antisymmetric * Symmetric);
+        EXPECT_EQ(inPlace[1], Antisymmetric * Antisymmetric);
+        EXPECT_EQ(inPlace[2], Antisymmetric);
+
+        Matrix::Multiply(inPlace, Symmetric, inPlace);
+        EXPECT_EQ(inPlace[0], Antisymmetric * Symmetric * Symmetric);
+        EXPECT_EQ(inPlace[2], Antisymmetric * Symmetric);
+
+        EXPECT_NO_THROW(Matrix::Multiply(Symmetric, std::span<const Matrix>(), std::span<Matrix>()));
+        EXPECT_THROW(Matrix::Multiply(Symmetric, inPlace, std::span(inPlace, 1)), std::invalid_argument);
+        EXPECT_THROW(Matrix::Multiply(inPlace, Symmetric, std::span(inPlace, 1)), std::invalid_argument);
+    }
+
+    TEST(Matrix, ProductExpression)
+    {
+        // Non-affine matrices with integer components, so that every product is exact
+        const Matrix projection = Antisymmetric;
+        const Matrix view = Matrix::Translation(OneTwoThree);
+        const Matrix model = Symmetric;
+
+        // Products of two matrices stay evaluated right away, so their members can be used directly
+        static_assert(std::same_as<decltype(projection * view), Matrix>);
+        const Matrix eager = (projection * view) * model;
+        EXPECT_TRUE(Calc::Equals((view * model).Inverted(), model.Inverted() * view.Inverted()));
+        EXPECT_EQ((view * model).Transposed(), model.Transposed() * view.Transposed());
+        EXPECT_EQ((projection * view)[3], projection * view[3]);
+        EXPECT_EQ((projection * view).m03, (projection * view)[3].x);
+
+        const Matrix mvp = LazyProduct(projection, view, model);
+        EXPECT_EQ(mvp, eager);
+        EXPECT_EQ(LazyProduct(projection, view) * model, eager);
+        EXPECT_EQ(projection * LazyProduct(view, model), eager);
+        EXPECT_EQ(Matrix(LazyProduct(projection, LazyProduct(view, model))), eager);
+
+        // Vectors are transformed by each matrix in turn instead of by the evaluated product
+        constexpr Vector4 v(1.f, 2.f, 3.f, 0.5f);
+        EXPECT_TRUE(Calc::Equals(LazyProduct(projection, view, model) * v, mvp * v));
+        EXPECT_TRUE(Calc::Equals(LazyProduct(projection, view, model) * OneTwoThree, mvp * OneTwoThree));
+        EXPECT_TRUE(Calc::Equals(LazyProduct(Symmetric, Antisymmetric) * Vector2(1.f, 2.f), Symmetric * Antisymmetric * Vector2(1.f, 2.f)));
+
+        const auto product = LazyProduct(view, Matrix::Scaling(Vector3(2.f)));
+        EXPECT_EQ(product.Evaluate(), view * Matrix::Scaling(Vector3(2.f)));
+
+        constexpr Matrix compileTime = Symmetric * Antisymmetric * Symmetric;
+        static_assert(LazyProduct(Symmetric, Antisymmetric, Symmetric).Evaluate() == compileTime);
+        EXPECT_EQ(Symmetric * Antisymmetric * Symmetric, compileTime);
     }
 
     TEST(Matrix, Inversion)
@@ -783,6 +1679,86 @@ namespace TestMatrix
         );
 
         EXPECT_THROW(temp.Inverted(), std::invalid_argument);
+
+        // Run-time inversions may use SIMD instructions and must match their compile-time counterparts
+        constexpr Matrix affine = Matrix::Translation(OneTwoThree) * Matrix::Scaling(Vector3(2.f, 0.5f, 4.f));
+        constexpr Matrix affineInverted = affine.Inverted();
+        constexpr Matrix affineInvertedAffine = affine.InvertedAffine();
+        constexpr Matrix antisymmetricInverted = Antisymmetric.Inverted();
+
+        Matrix runtime = affine;
+        EXPECT_TRUE(Calc::Equals(affineInvertedAffine, affineInverted));
+        EXPECT_TRUE(Calc::Equals(runtime.Inverted(), affineInverted));
+        EXPECT_TRUE(Calc::Equals(runtime.InvertedAffine(), affineInverted));
+        EXPECT_TRUE(Calc::Equals(Trs * Trs.InvertedAffine(), Identity));
+
+        runtime = Antisymmetric;
+        EXPECT_TRUE(Calc::Equals(runtime.Inverted(), antisymmetricInverted));
+        EXPECT_TRUE(Calc::Equals(runtime * runtime.Inverted(), Identity));
+
+        EXPECT_THROW(temp.InvertedAffine(), std::invalid_argument);
+
+        Matrix result = Identity;
+        EXPECT_FALSE(temp.TryInverted(&result));
+        EXPECT_FALSE(temp.TryInvertedAffine(&result));
+        EXPECT_EQ(result, Identity);
+        EXPECT_FALSE(temp.TryInverted().has_value());
+        EXPECT_TRUE(affine.TryInverted(&result));
+        EXPECT_TRUE(Calc::Equals(result, affineInverted));
+        EXPECT_TRUE(Calc::Equals(affine.TryInvertedAffine().value(), affineInverted));
+        static_assert(affine.TryInverted().has_value());
+    }
+
+    TEST(Matrix, ClosedFormInversion)
+    {
+        // A half turn around z and powers of two, so that the compile-time results are exact
+        constexpr Quaternion halfTurn(Vector3(0.f, 0.f, 1.f), 0.f);
+        static_assert(Matrix::InvertedTrs(OneTwoThree, halfTurn, Vector3(2.f)) == Matrix::Scaling(Vector3(0.5f)) * Matrix::Rotation(halfTurn.Conjugate()) * Matrix::Translation(-OneTwoThree));
+        static_assert(Matrix::InvertedTrs(OneTwoThree, halfTurn, Vector3(2.f)) * Matrix::Trs(OneTwoThree, halfTurn, Vector3(2.f)) == Identity);
+        static_assert(Matrix::Translation(OneTwoThree).InvertedRigid() == Matrix::Translation(-OneTwoThree));
+        static_assert(Matrix::Trs(OneTwoThree, halfTurn, Vector3(1.f)).InvertedRigid() == Matrix::InvertedTrs(OneTwoThree, halfTurn, Vector3(1.f)));
+
+        const Vector3 translation(1.f, -2.f, 3.f), scale(2.f, 0.5f, 4.f);
+        const Quaternion rotation = Quaternion::FromAxisAngle(Vector3(1.f, 2.f, 3.f).Normalized(), 0.7f);
+        ExpectNear(Matrix::InvertedTrs(translation, rotation, scale), Matrix::Trs(translation, rotation, scale).Inverted());
+
+        const Matrix rigid = Matrix::Trs(translation, rotation, Vector3(1.f));
+        EXPECT_TRUE(Calc::Equals(rigid.InvertedRigid(), rigid.Inverted()));
+        EXPECT_TRUE(Calc::Equals(rigid.InvertedRigid() * rigid, Identity));
+
+        Matrix inPlace = rigid;
+        inPlace.InvertedRigid(&inPlace);
+        EXPECT_EQ(inPlace, rigid.InvertedRigid());
+
+        // 13 objects to go through the 8-wide, the 4-wide and the scalar loops
+        Vector3 translations[13], scales[std::size(translations)];
+        Quaternion rotations[std::size(translations)];
+        Matrix rigids[std::size(translations)];
+        for (size_t i = 0; i < std::size(translations); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            translations[i] = OneTwoThree * f;
+            rotations[i] = Quaternion::FromAxisAngle(Vector3(1.f, f, -2.f).Normalized(), 0.3f * f);
+            scales[i] = Vector3(1.f + f * 0.25f, 2.f, 0.5f);
+            rigids[i] = Matrix::Trs(translations[i], rotations[i], Vector3(1.f));
+        }
+
+        Matrix results[std::size(translations)];
+        Matrix::InvertedTrs(translations, rotations, scales, results);
+        for (size_t i = 0; i < std::size(translations); i++)
+            ExpectNear(results[i], Matrix::InvertedTrs(translations[i], rotations[i], scales[i]));
+
+        Matrix::InvertedRigid(rigids, results);
+        Matrix::InvertedRigid(rigids, rigids);
+        for (size_t i = 0; i < std::size(translations); i++)
+        {
+            EXPECT_EQ(rigids[i], results[i]);
+            ExpectNear(results[i], Matrix::Trs(translations[i], rotations[i], Vector3(1.f)).InvertedRigid());
+        }
+
+        EXPECT_THROW(Matrix::InvertedTrs(translations, rotations, std::span(scales, 2), results), std::invalid_argument);
+        EXPECT_THROW(Matrix::InvertedTrs(translations, rotations, scales, std::span(results, 1)), std::invalid_argument);
+        EXPECT_THROW(Matrix::InvertedRigid(rigids, std::span(results, 1)), std::invalid_argument);
     }
 
     TEST(Matrix, Translation)
@@ -793,6 +1769,22 @@ namespace TestMatrix
     TEST(Matrix, Rotation)
     {
         EXPECT_TRUE(Calc::Equals(Matrix::RotationZ(Calc::PiOver2) * Vector3::UnitX(), Vector3::UnitY()));
+
+        std::vector<Vector3> rotations;
+        for (float_t angle = -4.f; angle < 4.f; angle += 0.07f)
+            rotations.emplace_back(angle, angle * 0.6f + 1.f, -angle * 1.3f);
+        std::vector<Matrix> results(rotations.size());
+        Matrix::Rotation(rotations, results);
+
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+            const Vector3& rotation = rotations[i];
+            const Matrix expected = Matrix::RotationZ(rotation.z) * Matrix::RotationY(rotation.y) * Matrix::RotationX(rotation.x);
+            EXPECT_TRUE(Calc::Equals(Matrix::Rotation(rotation), expected));
+            EXPECT_TRUE(Calc::Equals(results[i], expected));
+        }
+
+        EXPECT_THROW(Matrix::Rotation(rotations, std::span(results).first(1)), std::invalid_argument);
     }
 
     TEST(Matrix, Scaling)
@@ -802,21 +1794,617 @@ namespace TestMatrix
 
     TEST(Matrix, TRS)
     {
+        const Vector3 rotation(0.3f, -1.2f, 2.5f);
+        EXPECT_TRUE(Calc::Equals(Matrix::Trs(OneTwoThree, rotation, Vector3(2.f, 3.f, 4.f)), Matrix::Trs(OneTwoThree, Matrix::Rotation(rotation), Vector3(2.f, 3.f, 4.f))));
         EXPECT_TRUE(Calc::Equals(Matrix::Trs(One, Vector3(0.f, 0.f, Calc::PiOver2), Vector3(2.f)) * One, Vector3(-1.f, 3.f, 3.f)));
     }
 
+    TEST(Matrix, ConstexprBuilders)
+    {
+        constexpr Vector3 Axis(1.f, 2.f, 3.f);
+        constexpr Vector3 Eye(4.f, 5.f, 6.f);
+        constexpr Matrix Rotation = Matrix::Rotation(0.7f, Axis);
+        constexpr Matrix RotationX = Matrix::RotationX(Calc::PiOver2);
+        constexpr Matrix Trs = Matrix::Trs(Eye, Vector3(0.1f, 0.2f, 0.3f), Vector3(2.f));
+        constexpr Matrix Perspective = Matrix::Perspective(Calc::PiOver2, 16.f / 9.f, 0.1f, 100.f);
+        constexpr Matrix View = Matrix::LookAt(Eye, Vector3::Zero(), Vector3::UnitY());
+        constexpr Matrix3 Rotation3 = Matrix3::Rotation(Vector3(0.1f, 0.2f, 0.3f));
+        constexpr Quaternion AxisAngle = Quaternion::FromAxisAngle(Axis, 0.7f);
+
+        static_assert(Vector3(2.f, 3.f, 6.f).Length() == 7.f);
+        static_assert(Perspective.m11 == 1.f);
+        static_assert(Matrix::TryPerspective(Calc::PiOver2, 16.f / 9.f, 0.1f, 100.f) == Perspective);
+        static_assert(!Matrix::TryPerspective(Calc::PiOver2, 16.f / 9.f, 100.f, 0.1f).has_value());
+        static_assert(!Matrix::TryOrthographic(-1.f, 1.f, -1.f, 1.f, 100.f, 0.1f).has_value());
+
+        // Calls outside of constant expressions use the standard library functions
+        EXPECT_TRUE(Calc::Equals(Rotation, Matrix::Rotation(0.7f, Axis)));
+        EXPECT_TRUE(Calc::Equals(RotationX, Matrix::RotationX(Calc::PiOver2)));
+        EXPECT_TRUE(Calc::Equals(Trs, Matrix::Trs(Eye, Vector3(0.1f, 0.2f, 0.3f), Vector3(2.f))));
+        EXPECT_TRUE(Calc::Equals(Perspective, Matrix::Perspective(Calc::PiOver2, 16.f / 9.f, 0.1f, 100.f)));
+        EXPECT_TRUE(Calc::Equals(View, Matrix::LookAt(Eye, Vector3::Zero(), Vector3::UnitY())));
+        EXPECT_TRUE(Calc::Equals(Rotation3, Matrix3::Rotation(Vector3(0.1f, 0.2f, 0.3f))));
+        EXPECT_TRUE(Calc::Equals(AxisAngle, Quaternion::FromAxisAngle(Axis, 0.7f)));
+    }
+
+    TEST(Matrix, CameraRelative)
+    {
+        // Far enough from the origin for a float to be only precise to the meter
+        constexpr Vector3d Camera(1e7, 2e7, -3e7);
+        constexpr Vector3d Offset(0.25, -0.5, 0.125);
+        constexpr Matrixd World(
+            1., 0., 0., Camera.x + Offset.x,
+            0., 1., 0., Camera.y + Offset.y,
+            0., 0., 1., Camera.z + Offset.z,
+            0., 0., 0., 1.
+        );
+
+        static_assert(Matrix::CameraRelative(World, Camera) == Matrix::Translation(Vector3(0.25f, -0.5f, 0.125f)));
+        static_assert(Matrix::CameraRelativeTrs(Camera + Offset, Quaterniond::Identity(), Vector3d(1.), Camera) == Matrix::Translation(Vector3(0.25f, -0.5f, 0.125f)));
+
+        const Quaterniond rotation = Quaterniond::FromAxisAngle(Vector3d(0., 0., 1.), static_cast<double_t>(Calc::PiOver2));
+        const Matrix trs = Matrix::CameraRelativeTrs(Camera + Offset, rotation, Vector3d(2.), Camera);
+        EXPECT_TRUE(Calc::Equals(trs, Matrix::Trs(static_cast<Vector3>(Offset), static_cast<Quaternion>(rotation), Vector3(2.f))));
+
+        const Matrixd worlds[] = { World, Matrixd::Identity() };
+        Matrix results[2];
+        Matrix::CameraRelative(worlds, Camera, results);
+        EXPECT_EQ(results[0], Matrix::CameraRelative(World, Camera));
+        EXPECT_EQ(results[1], Matrix::Translation(Vector3(-1e7f, -2e7f, 3e7f)));
+
+        const Vector3d translations[] = { Camera + Offset, Camera };
+        const Quaterniond rotations[] = { rotation, Quaterniond::Identity() };
+        const Vector3d scales[] = { Vector3d(2.), Vector3d(1.) };
+        Matrix::CameraRelativeTrs(translations, rotations, scales, Camera, results);
+        EXPECT_EQ(results[0], trs);
+        EXPECT_EQ(results[1], Matrix::Identity());
+
+        EXPECT_THROW(Matrix::CameraRelative(worlds, Camera, std::span(results, 1)), std::invalid_argument);
+        EXPECT_THROW(Matrix::CameraRelativeTrs(translations, std::span(rotations, 1), scales, Camera, results), std::invalid_argument);
+    }
+
+    TEST(Matrix, BatchTransformations)
+    {
+        // 11 points to go through both the 8-wide loop and its remainder
+        Vector3 points[11];
+        for (size_t i = 0; i < std::size(points); i++)
+            points[i] = Vector3(static_cast<float_t>(i), -0.5f * static_cast<float_t>(i), 2.f);
+
+        Vector3 results[std::size(points)];
+        Trs.TransformPoints(points, results);
+        for (size_t i = 0; i < std::size(points); i++)
+            EXPECT_TRUE(Calc::Equals(results[i], Trs * points[i]));
+
+        Trs.TransformDirections(points, results);
+        for (size_t i = 0; i < std::size(points); i++)
+            EXPECT_TRUE(Calc::Equals(results[i], Trs * points[i] - Trs * Vector3::Zero()));
+
+        const Matrix projection = Matrix::Perspective(Calc::PiOver2, 16.f / 9.f, 0.1f, 100.f);
+        Vector3 inPlace[std::size(points)];
+        std::ranges::copy(points, inPlace);
+        projection.TransformPointsProjective(inPlace, inPlace);
+        for (size_t i = 0; i < std::size(points); i++)
+        {
+            const Vector4 clip = projection * Vector4(points[i].x, points[i].y, points[i].z, 1.f);
+            EXPECT_TRUE(Calc::Equals(inPlace[i], Vector3(clip.x, clip.y, clip.z) / clip.w));
+        }
+
+        EXPECT_NO_THROW(Trs.TransformPoints(std::span<const Vector3>(), std::span<Vector3>()));
+        EXPECT_THROW(Trs.TransformPoints(points, std::span(results, 1)), std::invalid_argument);
+        EXPECT_THROW(Trs.TransformDirections(points, std::span(results, 1)), std::invalid_argument);
+        EXPECT_THROW(projection.TransformPointsProjective(points, std::span(results, 1)), std::invalid_argument);
+    }
+
     TEST(Matrix, Subscript)
     {
         EXPECT_THROW(Zero.At(4, 0), std::out_of_range);
         EXPECT_THROW(Zero.At(0, 4), std::out_of_range);
         EXPECT_THROW(Zero.At(4, 4), std::out_of_range);
         EXPECT_NO_THROW(Zero.At(1, 2));
+
+        Matrix m = Identity;
+        m.UncheckedAt(1, 2) = 5.f;
+        EXPECT_EQ(m.At(1, 2), 5.f);
+        EXPECT_EQ(Identity.UncheckedAt(3, 3), 1.f);
     }
 
     TEST(Matrix, Formatting)
     {
         EXPECT_EQ(std::format("{0:06.3f}", Identity), "[ 01.000 ; 00.000 ; 00.000 ; 00.000 ] [ 00.000 ; 01.000 ; 00.000 ; 00.000 ] [ 00.000 ; 00.000 ; 01.000 ; 00.000 ] [ 00.000 ; 00.000 ; 00.000 ; 01.000 ]");
         EXPECT_EQ(std::format("{0:m06.3f}", Identity), "[ 01.000 ; 00.000 ; 00.000 ; 00.000 ]\n[ 00.000 ; 01.000 ; 00.000 ; 00.000 ]\n[ 00.000 ; 00.000 ; 01.000 ; 00.000 ]\n[ 00.000 ; 00.000 ; 00.000 ; 01.000 ]");
+        EXPECT_EQ(std::format("{0:06.3f}", Identity * Identity), std::format("{0:06.3f}", Identity));
+    }
+}
+
+namespace TestAffineTransform
+{
+    constexpr Vector3 Translation(1.f, -2.f, 3.f);
+    constexpr Vector3 Rotation(0.3f, -1.2f, 2.5f);
+    constexpr Vector3 Scale(2.f, 3.f, 4.f);
+    constexpr Vector3 Point(0.5f, 1.5f, -2.5f);
+
+    TEST(AffineTransform, Layout)
+    {
+        static_assert(sizeof(AffineTransform) == 48);
+        static_assert(AffineTransform::Identity().IsIdentity());
+
+        const AffineTransform transform(
+            1.f, 2.f, 3.f, 4.f,
+            5.f, 6.f, 7.f, 8.f,
+            9.f, 10.f, 11.f, 12.f
+        );
+        EXPECT_EQ(transform.Data()[1], 5.f);
+        EXPECT_EQ(transform.Data()[9], 4.f);
+        EXPECT_EQ(transform.At(1, 3), 8.f);
+        EXPECT_THROW(transform.At(3, 0), std::out_of_range);
+        EXPECT_THROW(transform.At(0, 4), std::out_of_range);
+        EXPECT_EQ(AffineTransform(transform.Data()), transform);
+        EXPECT_EQ(AffineTransform(static_cast<Matrix>(transform)), transform);
+        EXPECT_EQ(AffineTransform(static_cast<Matrix3>(transform), Vector3(4.f, 8.f, 12.f)), transform);
+    }
+
+    TEST(AffineTransform, Trs)
+    {
+        constexpr Vector3 Axis = Vector3(1.f, 2.f, 3.f).Normalized();
+        const Quaternion quaternion = Quaternion::FromAxisAngle(Axis, 0.7f);
+
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(AffineTransform::Trs(Translation, Rotation, Scale)), Matrix::Trs(Translation, Rotation, Scale)));
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(AffineTransform::Trs(Translation, 0.7f, Axis, Scale)), Matrix::Trs(Translation, 0.7f, Axis, Scale)));
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(AffineTransform::Trs(Translation, quaternion, Scale)), Matrix::Trs(Translation, quaternion, Scale)));
+        EXPECT_TRUE(Calc::Equals(
+            static_cast<Matrix>(AffineTransform::Trs(Translation, Matrix3::Rotation(Rotation), Scale)),
+            Matrix::Trs(Translation, Matrix::Rotation(Rotation), Scale)
+        ));
+        EXPECT_EQ(AffineTransform::Trs(Translation, Matrix3::Identity(), Vector3(1.f)), AffineTransform::Translation(Translation));
+        EXPECT_EQ(AffineTransform::Trs(Vector3::Zero(), Matrix3::Identity(), Scale), AffineTransform::Scaling(Scale));
+    }
+
+    TEST(AffineTransform, BatchTrs)
+    {
+        Vector3 translations[13], scales[std::size(translations)];
+        Quaternion rotations[std::size(translations)];
+        for (size_t i = 0; i < std::size(translations); i++)
+        {
+            const float_t f = static_cast<float_t>(i);
+            translations[i] = Translation * f;
+            rotations[i] = Quaternion::FromAxisAngle(Vector3(1.f, f, -2.f).Normalized(), 0.3f * f);
+            scales[i] = Scale + Vector3(f * 0.25f);
+        }
+
+        AffineTransform results[std::size(translations)];
+        AffineTransform::Trs(translations, rotations, scales, results);
+        for (size_t i = 0; i < std::size(translations); i++)
+            EXPECT_TRUE(Calc::Equals(results[i], AffineTransform::Trs(translations[i], rotations[i], scales[i])));
+
+        EXPECT_THROW(AffineTransform::Trs(translations, std::span(rotations, 1), scales, results), std::invalid_argument);
+        EXPECT_THROW(AffineTransform::Trs(translations, rotations, scales, std::span(results, 1)), std::invalid_argument);
+    }
+
+    TEST(AffineTransform, Operations)
+    {
+        const AffineTransform a = AffineTransform::Trs(Translation, Rotation, Scale);
+        const AffineTransform b = AffineTransform::Trs(Scale, 1.1f, Vector3::UnitY(), Translation);
+        const Matrix matrixA = Matrix::Trs(Translation, Rotation, Scale);
+        const Matrix matrixB = Matrix::Trs(Scale, 1.1f, Vector3::UnitY(), Translation);
+
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(a * b), Matrix(matrixA * matrixB)));
+        EXPECT_TRUE(Calc::Equals(a * Point, matrixA * Point));
+        EXPECT_TRUE(Calc::Equals(a.TransformDirection(Point), static_cast<Matrix3>(a) * Point));
+        EXPECT_NEAR(a.Determinant(), 24.f, 1e-4f);
+
+        AffineTransform temp = a;
+        EXPECT_TRUE(Calc::Equals(temp *= temp.Inverted(), AffineTransform::Identity()));
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(a.Inverted()), matrixA.InvertedAffine()));
+        EXPECT_TRUE(Calc::Equals(a.Inverted() * (a * Point), Point));
+
+        constexpr AffineTransform ConstexprTrs = AffineTransform::Trs(Translation, Matrix3::Rotation(Rotation), Scale);
+        static_assert(ConstexprTrs.Inverted().Determinant() != 0.f);
+        EXPECT_TRUE(Calc::Equals(ConstexprTrs * ConstexprTrs.Inverted(), AffineTransform::Identity()));
+        EXPECT_TRUE(Calc::Equals(ConstexprTrs.Inverted(), a.Inverted()));
+
+        temp = AffineTransform::Scaling(Vector3(1.f, 0.f, 1.f));
+        EXPECT_THROW(temp.Inverted(), std::invalid_argument);
+        EXPECT_FALSE(temp.TryInverted().has_value());
+        EXPECT_TRUE(Calc::Equals(a.TryInverted().value(), a.Inverted()));
+    }
+
+    TEST(AffineTransform, Formatting)
+    {
+        EXPECT_EQ(std::format("{0:06.3f}", AffineTransform::Identity()), "[ 01.000 ; 00.000 ; 00.000 ; 00.000 ] [ 00.000 ; 01.000 ; 00.000 ; 00.000 ] [ 00.000 ; 00.000 ; 01.000 ; 00.000 ]");
+    }
+}
+
+namespace TestMatrixT
+{
+    constexpr Matrix3x4 Affine(
+        1.f, 2.f, 3.f, 4.f,
+        5.f, 6.f, 7.f, 8.f,
+        9.f, 10.f, 11.f, 12.f
+    );
+
+    constexpr Matrix Invertible(
+        2.f, 0.f, 1.f, 3.f,
+        1.f, 3.f, 0.f, 1.f,
+        0.f, 1.f, 4.f, 2.f,
+        1.f, 0.f, 2.f, 5.f
+    );
+
+    TEST(MatrixT, Layout)
+    {
+        static_assert(sizeof(Matrix3x4) == 12 * sizeof(float_t));
+        static_assert(sizeof(Matrixd) == 16 * sizeof(double_t));
+        static_assert(std::is_same_v<Matrix, MatrixT<4, 4, float_t>>);
+
+        // Values are given row by row but stored column by column, like Matrix
+        EXPECT_EQ(Affine.Data()[1], 5.f);
+        EXPECT_EQ(Affine.At(0, 3), 4.f);
+        EXPECT_THROW(Affine.At(3, 0), std::out_of_range);
+
+        EXPECT_TRUE(Matrix3x4::Identity().IsIdentity());
+        EXPECT_FALSE(Affine.IsDiagonal());
+        EXPECT_TRUE(Matrix4x3().IsNull());
+    }
+
+    TEST(MatrixT, Multiplication)
+    {
+        constexpr Matrix4x3 transposed = Affine.Transposed();
+        EXPECT_EQ(transposed.At(3, 0), 4.f);
+        EXPECT_EQ(transposed.Transposed(), Affine);
+
+        // A 3x4 Matrix by a 4x3 Matrix gives a Matrix3
+        constexpr Matrix3 product = Affine * transposed;
+        EXPECT_TRUE(Calc::Equals(product, Matrix3(30.f, 70.f, 110.f, 70.f, 174.f, 278.f, 110.f, 278.f, 446.f)));
+        EXPECT_TRUE(product.IsSymmetric());
+
+        // The specializations work with the other shapes
+        const Matrix3x4 translated = Affine * Matrix::Translation(Vector3(1.f, 0.f, 0.f));
+        EXPECT_EQ(translated.At(0, 3), 5.f);
+        EXPECT_TRUE(Calc::Equals(Matrix3x4(Matrix3::Identity() * Affine), Affine));
+
+        EXPECT_TRUE(Calc::Equals(Affine * 2.f - Affine, Affine));
+    }
+
+    TEST(MatrixT, Inversion)
+    {
+        const Matrixd invertible(Invertible);
+        EXPECT_DOUBLE_EQ(invertible.Determinant(), static_cast<double_t>(Invertible.Determinant()));
+        EXPECT_TRUE(Calc::Equals(invertible * invertible.Inverted(), Matrixd::Identity()));
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix>(invertible.Inverted()), Invertible.Inverted()));
+
+        constexpr Matrix2d m2(1., 2., 3., 4.);
+        EXPECT_EQ(m2.Determinant(), -2.);
+        EXPECT_TRUE(Calc::Equals(static_cast<Matrix2>(m2), Matrix2(1.f, 2.f, 3.f, 4.f)));
+
+        constexpr Matrix3d singular(1., 2., 3., 2., 4., 6., 0., 1., 1.);
+        EXPECT_EQ(singular.Determinant(), 0.);
+        EXPECT_THROW(singular.Inverted(), std::invalid_argument);
+        static_assert(!singular.TryInverted().has_value());
+        EXPECT_TRUE(Calc::Equals(invertible.TryInverted().value(), invertible.Inverted()));
+    }
+
+    TEST(MatrixT, Formatting)
+    {
+        EXPECT_EQ(std::format("{0:04.1f}", Matrix3x4::Identity()), "[ 01.0 ; 00.0 ; 00.0 ; 00.0 ] [ 00.0 ; 01.0 ; 00.0 ; 00.0 ] [ 00.0 ; 00.0 ; 01.0 ; 00.0 ]");
+    }
+}
+
+namespace TestPackets
+{
+    const Vector3 Vectors[] = {
+        Vector3(1.f, 2.f, 3.f), Vector3(-0.5f, 0.25f, 1.5f), Vector3::Zero(), Vector3(0.f, -3.f, 4.f),
+        Vector3(2.f, 0.f, -1.f), Vector3(0.1f, 0.2f, 0.3f), Vector3(-1.f, -1.f, -1.f), Vector3(0.75f, -0.5f, 0.25f)
+    };
+
+    const Quaternion Rotations[] = {
+        Quaternion::FromAxisAngle(Vector3::UnitX(), 0.5f), Quaternion::FromAxisAngle(Vector3::UnitY(), -1.2f),
+        Quaternion::FromAxisAngle(Vector3(1.f, 1.f, 0.f), 2.5f), Quaternion::Identity(),
+        Quaternion::FromAxisAngle(Vector3::UnitZ(), 3.f), Quaternion::FromAxisAngle(Vector3(-1.f, 2.f, 0.5f), 0.1f),
+        Quaternion::FromAxisAngle(Vector3(0.f, 1.f, 1.f), -2.f), Quaternion::FromAxisAngle(Vector3::UnitX(), 1.f)
+    };
+
+    TEST(Packets, Floatx8)
+    {
+        const float_t values[] = { 1.f, -2.f, 3.f, 0.f, 4.5f, -0.5f, 9.f, 16.f };
+
+        const Floatx8 a = Floatx8::Load(values);
+        const Floatx8 b = 2.f;
+
+        const Maskx8 positive = a > 0.f;
+        EXPECT_EQ(positive.Bits(), 0b11010101u);
+        EXPECT_TRUE(positive.Any());
+        EXPECT_FALSE(positive.All());
+        EXPECT_TRUE((positive | ~positive).All());
+        EXPECT_FALSE((positive & ~positive).Any());
+        EXPECT_EQ((a == b).Bits(), 0u);
+
+        float_t result[Floatx8::Size];
+        (Floatx8::Select(positive, a * b, -a) + 1.f).Store(result);
+        for (size_t i = 0; i < Floatx8::Size; i++)
+        {
+            EXPECT_EQ(result[i], (values[i] > 0.f ? values[i] * 2.f : -values[i]) + 1.f);
+            EXPECT_EQ(a[i], values[i]);
+            EXPECT_EQ(Floatx8::Abs(a)[i], std::abs(values[i]));
+            EXPECT_EQ(Calc::Clamp(a, -1.f, 1.f)[i], Calc::Clamp(values[i], -1.f, 1.f));
+            EXPECT_FLOAT_EQ(Calc::Lerp(a, b, 0.25f)[i], Calc::Lerp(values[i], 2.f, 0.25f));
+        }
+
+        EXPECT_THROW(a[Floatx8::Size], std::out_of_range);
+        EXPECT_THROW(positive[Floatx8::Size], std::out_of_range);
+    }
+
+    TEST(Packets, Vector3x8)
+    {
+        const Vector3x8 a = Vector3x8::Load(Vectors);
+        const Vector3x8 b(Vector3(0.5f, -1.f, 2.f));
+
+        Vector3 stored[8];
+        a.Store(stored);
+        for (size_t i = 0; i < 8; i++)
+            EXPECT_EQ(stored[i], Vectors[i]);
+
+        const Vector3x8 normalized = a.Normalized();
+        const Vector3x8 fastNormalized = a.Normalized(Calc::FastMath);
+        const Vector3x8 cross = Vector3x8::Cross(a, b);
+        const Floatx8 dot = Vector3x8::Dot(a, b);
+        const Floatx8 length = a.Length();
+        const Vector3x8 lerp = Calc::Lerp(a, b, 0.25f);
+        const Vector3x8 clamped = Calc::Clamp(a, Vector3(-0.5f), Vector3(0.5f));
+        const Vector3x8 selected = Vector3x8::Select(length > 2.f, a, -b * 2.f + a / 4.f);
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            const Vector3 v = Vectors[i];
+            EXPECT_TRUE(Calc::Equals(normalized[i], v.Normalized()));
+            EXPECT_TRUE(Calc::Equals(fastNormalized[i], v.Normalized(Calc::FastMath)));
+            EXPECT_TRUE(Calc::Equals(cross[i], Vector3::Cross(v, b[i])));
+            EXPECT_FLOAT_EQ(dot[i], Vector3::Dot(v, b[i]));
+            EXPECT_FLOAT_EQ(length[i], v.Length());
+            EXPECT_TRUE(Calc::Equals(lerp[i], Calc::Lerp(v, b[i], 0.25f)));
+            EXPECT_EQ(clamped[i], Calc::Clamp(v, Vector3(-0.5f), Vector3(0.5f)));
+            EXPECT_TRUE(Calc::Equals(selected[i], v.Length() > 2.f ? v : -b[i] * 2.f + v / 4.f));
+        }
+
+        EXPECT_EQ(normalized[2], Vector3::Zero());
+        EXPECT_EQ(fastNormalized[2], Vector3::Zero());
+        EXPECT_THROW(a[8], std::out_of_range);
+    }
+
+    TEST(Packets, PartialLoadStore)
+    {
+        const Vector3x8 a = Vector3x8::Load(std::span(Vectors, 5));
+        EXPECT_EQ(a[4], Vectors[4]);
+        EXPECT_EQ(a[5], Vector3::Zero());
+        EXPECT_EQ(a[7], Vector3::Zero());
+
+        Vector3 stored[4] = {};
+        (a * 2.f).Store(std::span(stored));
+        for (size_t i = 0; i < 4; i++)
+            EXPECT_EQ(stored[i], Vectors[i] * 2.f);
+
+        const Vector2 vectors2[] = { Vector2(1.f, 2.f), Vector2(3.f, -4.f), Vector2(0.f, 0.5f) };
+        const Vector2x8 b = Vector2x8::Load(std::span(vectors2));
+        Vector2 stored2[3];
+        (b + Vector2(1.f)).Store(std::span(stored2));
+        for (size_t i = 0; i < 3; i++)
+            EXPECT_EQ(stored2[i], vectors2[i] + Vector2(1.f));
+        EXPECT_EQ(b[3], Vector2::Zero());
+
+        const Quaternionx8 q = Quaternionx8::Load(std::span(Rotations, 2));
+        Quaternion storedQ[8];
+        q.Store(storedQ);
+        EXPECT_EQ(storedQ[1], Rotations[1]);
+        EXPECT_EQ(storedQ[2], Quaternion(0.f, 0.f, 0.f, 0.f));
+    }
+
+    TEST(Packets, Vector2x8)
+    {
+        Vector2 vectors[8];
+        for (size_t i = 0; i < 8; i++)
+            vectors[i] = Vector2(Vectors[i].x, Vectors[i].y);
+
+        const Vector2x8 a = Vector2x8::Load(vectors);
+        const Vector2x8 b(Vector2(0.5f, -1.f));
+
+        Vector2 stored[8];
+        a.Store(stored);
+        for (size_t i = 0; i < 8; i++)
+            EXPECT_EQ(stored[i], vectors[i]);
+
+        const Vector2x8 normalized = a.Normalized();
+        const Floatx8 cross = Vector2x8::Cross(a, b);
+        const Floatx8 dot = Vector2x8::Dot(a, b);
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            EXPECT_TRUE(Calc::Equals(normalized[i], vectors[i].Normalized()));
+            EXPECT_FLOAT_EQ(cross[i], Vector2::Cross(vectors[i], b[i]));
+            EXPECT_FLOAT_EQ(dot[i], Vector2::Dot(vectors[i], b[i]));
+        }
+    }
+
+    TEST(Packets, Quaternionx8)
+    {
+        const Quaternionx8 a = Quaternionx8::Load(Rotations);
+        const Quaternionx8 b(Quaternion::FromAxisAngle(Vector3(0.f, -1.f, 1.f), 1.5f));
+
+        Quaternion stored[8];
+        a.Store(stored);
+        for (size_t i = 0; i < 8; i++)
+            EXPECT_EQ(stored[i], Rotations[i]);
+
+        const Quaternionx8 product = a * b;
+        const Quaternionx8 lerp = Quaternionx8::Lerp(a, -b, 0.3f);
+        const Quaternionx8 normalized = (a * 3.f).Normalized();
+        const Vector3x8 rotated = Quaternionx8::Rotate(Vector3x8::Load(Vectors), a);
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            const Quaternion q = Rotations[i];
+            EXPECT_TRUE(Calc::Equals(product[i], q * b[i]));
+            EXPECT_TRUE(Calc::Equals(lerp[i], Quaternion::Lerp(q, -b[i], 0.3f)));
+            EXPECT_TRUE(Calc::Equals(normalized[i], q));
+            EXPECT_TRUE(Calc::Equals(a.Conjugate()[i], q.Conjugate()));
+            EXPECT_FLOAT_EQ(Quaternionx8::Dot(a, b)[i], Quaternion::Dot(q, b[i]));
+            EXPECT_TRUE(Calc::Equals(rotated[i], Quaternion::Rotate(Vectors[i], q)));
+        }
+    }
+}
+
+
+namespace TestDispatch
+{
+    using Dispatch::InstructionSet;
+
+    constexpr InstructionSet InstructionSets[] = { InstructionSet::Scalar, InstructionSet::Sse41, InstructionSet::Avx2, InstructionSet::Avx512 };
+
+    const Matrix Matrices[] = {
+        Matrix::Trs(Vector3(1.f), Vector3(0.f, 0.f, Calc::PiOver2), Vector3(2.f)),
+        Matrix(1.f, 2.f, 3.f, 4.f, -2.f, 5.f, 6.f, 7.f, -3.f, -6.f, 8.f, 9.f, -4.f, -7.f, -9.f, 10.f),
+        Matrix::Perspective(Calc::PiOver2, 16.f / 9.f, 0.1f, 100.f),
+        Matrix::Identity()
+    };
+
+    TEST(Dispatch, InstructionSets)
+    {
+        const InstructionSet previous = Dispatch::CurrentInstructionSet();
+
+        EXPECT_EQ(Dispatch::SetInstructionSet(InstructionSet::Scalar), InstructionSet::Scalar);
+        EXPECT_EQ(Dispatch::CurrentInstructionSet(), InstructionSet::Scalar);
+        EXPECT_EQ(Dispatch::SetInstructionSet(InstructionSet::Avx512), Dispatch::SupportedInstructionSet());
+        EXPECT_EQ(Dispatch::GetKernels().instructionSet, Dispatch::SupportedInstructionSet());
+
+        EXPECT_STREQ(Dispatch::ToString(InstructionSet::Sse41), "sse4.1");
+
+        Dispatch::SetInstructionSet(previous);
+    }
+
+    TEST(Dispatch, Kernels)
+    {
+        const InstructionSet previous = Dispatch::CurrentInstructionSet();
+
+        for (const InstructionSet instructionSet : InstructionSets)
+        {
+            if (instructionSet > Dispatch::SupportedInstructionSet())
+                break;
+
+            SCOPED_TRACE(Dispatch::ToString(instructionSet));
+            ASSERT_EQ(Dispatch::SetInstructionSet(instructionSet), instructionSet);
+            const Dispatch::Kernels& kernels = Dispatch::GetKernels();
+
+            Matrix products[std::size(Matrices)];
+            kernels.multiplyMatrices(Matrices[0].Data(), Matrices[1].Data(), products[0].Data(), std::size(Matrices) - 1);
+            for (size_t i = 0; i + 1 < std::size(Matrices); i++)
+                EXPECT_TRUE(Calc::Equals(products[i], Matrices[i] * Matrices[i + 1]));
+
+            kernels.multiplyMatricesByMatrix(Matrices[0].Data(), Matrices[1].Data(), products[0].Data(), std::size(Matrices));
+            for (size_t i = 0; i < std::size(Matrices); i++)
+                EXPECT_TRUE(Calc::Equals(products[i], Matrices[i] * Matrices[1]));
+
+            Matrix inverses[std::size(Matrices)];
+            EXPECT_TRUE(kernels.invertMatrices(Matrices[0].Data(), inverses[0].Data(), std::size(Matrices)));
+            for (size_t i = 0; i < std::size(Matrices); i++)
+                EXPECT_TRUE(Calc::Equals(inverses[i] * Matrices[i], Matrix::Identity()));
+            EXPECT_FALSE(kernels.invertMatrices(Matrix().Data(), inverses[0].Data(), 1));
+
+            // Odd counts to go through the remainder of the wide kernels
+            Vector4 vectors4[7];
+            for (size_t i = 0; i < std::size(vectors4); i++)
+                vectors4[i] = Vector4(static_cast<float_t>(i), -2.f, 0.5f * static_cast<float_t>(i), 1.f);
+            vectors4[3] = Vector4::Zero();
+
+            Vector4 transformed[std::size(vectors4)];
+            kernels.transformVectors4(Matrices[1].Data(), vectors4[0].Data(), transformed[0].Data(), std::size(vectors4));
+            for (size_t i = 0; i < std::size(vectors4); i++)
+                EXPECT_TRUE(Calc::Equals(transformed[i], Matrices[1] * vectors4[i]));
+
+            Vector4 normalized4[std::size(vectors4)];
+            kernels.normalizeVectors4(vectors4[0].Data(), normalized4[0].Data(), std::size(vectors4));
+            for (size_t i = 0; i < std::size(vectors4); i++)
+                EXPECT_TRUE(Calc::Equals(normalized4[i], vectors4[i].Normalized()));
+
+            Vector2 vectors2[std::size(vectors4)];
+            for (size_t i = 0; i < std::size(vectors2); i++)
+                vectors2[i] = Vector2(vectors4[i].x, vectors4[i].z);
+
+            Vector2 normalized2[std::size(vectors2)];
+            kernels.normalizeVectors2(vectors2[0].Data(), normalized2[0].Data(), std::size(vectors2));
+            for (size_t i = 0; i < std::size(vectors2); i++)
+                EXPECT_TRUE(Calc::Equals(normalized2[i], vectors2[i].Normalized()));
+
+            Vector3 vectors3[11];
+            for (size_t i = 0; i < std::size(vectors3); i++)
+                vectors3[i] = Vector3(static_cast<float_t>(i), 3.f - static_cast<float_t>(i), 2.f);
+            vectors3[5] = Vector3::Zero();
+
+            Vector3 normalized3[std::size(vectors3)];
+            std::ranges::copy(vectors3, normalized3);
+            kernels.normalizeVectors3(normalized3[0].Data(), normalized3[0].Data(), std::size(vectors3));
+            for (size_t i = 0; i < std::size(vectors3); i++)
+                EXPECT_TRUE(Calc::Equals(normalized3[i], vectors3[i].Normalized()));
+
+            // 13 objects to go through the 8-wide, the 4-wide and the scalar loops
+            Vector3 translations[13], scales[std::size(translations)];
+            Quaternion rotations[std::size(translations)];
+            for (size_t i = 0; i < std::size(translations); i++)
+            {
+                const float_t f = static_cast<float_t>(i);
+                translations[i] = Vector3(f, -f, 2.f);
+                rotations[i] = Quaternion::FromAxisAngle(Vector3(f, 1.f, 2.f).Normalized(), 0.5f * f);
+                scales[i] = Vector3(1.f, 0.5f * f, 2.f);
+            }
+
+            Matrix trs[std::size(translations)];
+            kernels.composeTrs4x4(translations[0].Data(), rotations[0].Data(), scales[0].Data(), trs[0].Data(), std::size(translations));
+            AffineTransform affineTrs[std::size(translations)];
+            kernels.composeTrs3x4(translations[0].Data(), rotations[0].Data(), scales[0].Data(), affineTrs[0].Data(), std::size(translations));
+            for (size_t i = 0; i < std::size(translations); i++)
+            {
+                EXPECT_TRUE(Calc::Equals(trs[i], Matrix::Trs(translations[i], rotations[i], scales[i])));
+                EXPECT_TRUE(Calc::Equals(affineTrs[i], AffineTransform::Trs(translations[i], rotations[i], scales[i])));
+            }
+
+            // The inverse needs scales without zero components
+            Vector3 invertibleScales[std::size(translations)];
+            for (size_t i = 0; i < std::size(translations); i++)
+                invertibleScales[i] = Vector3(1.f, 0.5f * static_cast<float_t>(i + 1), 2.f);
+
+            Matrix invertedTrs[std::size(translations)];
+            kernels.composeInvertedTrs4x4(translations[0].Data(), rotations[0].Data(), invertibleScales[0].Data(), invertedTrs[0].Data(), std::size(translations));
+            for (size_t i = 0; i < std::size(translations); i++)
+                TestMatrix::ExpectNear(invertedTrs[i], Matrix::InvertedTrs(translations[i], rotations[i], invertibleScales[i]));
+
+            Matrix rigids[std::size(translations)];
+            for (size_t i = 0; i < std::size(translations); i++)
+                rigids[i] = Matrix::Trs(translations[i], rotations[i], Vector3(1.f));
+            kernels.invertRigidMatrices(rigids[0].Data(), rigids[0].Data(), std::size(translations));
+            for (size_t i = 0; i < std::size(translations); i++)
+                TestMatrix::ExpectNear(rigids[i], Matrix::InvertedTrs(translations[i], rotations[i], Vector3(1.f)));
+
+            Vector3 transformed3[std::size(vectors3)];
+            std::ranges::copy(vectors3, transformed3);
+            kernels.transformPoints3(Matrices[0].Data(), transformed3[0].Data(), transformed3[0].Data(), std::size(vectors3));
+            for (size_t i = 0; i < std::size(vectors3); i++)
+                EXPECT_TRUE(Calc::Equals(transformed3[i], Matrices[0] * vectors3[i]));
+
+            kernels.transformDirections3(Matrices[1].Data(), vectors3[0].Data(), transformed3[0].Data(), std::size(vectors3));
+            for (size_t i = 0; i < std::size(vectors3); i++)
+            {
+                const Vector4 direction = Matrices[1] * Vector4(vectors3[i].x, vectors3[i].y, vectors3[i].z, 0.f);
+                EXPECT_TRUE(Calc::Equals(transformed3[i], Vector3(direction.x, direction.y, direction.z)));
+            }
+
+            kernels.transformPointsProjective3(Matrices[2].Data(), vectors3[0].Data(), transformed3[0].Data(), std::size(vectors3));
+            for (size_t i = 0; i < std::size(vectors3); i++)
+            {
+                const Vector4 clip = Matrices[2] * Vector4(vectors3[i].x, vectors3[i].y, vectors3[i].z, 1.f);
+                // The zero vector is on the plane of the eye, where the perspective divide gives NaN
+                if (clip.w == 0.f)
+                    continue;
+                EXPECT_TRUE(Calc::Equals(transformed3[i], Vector3(clip.x, clip.y, clip.z) / clip.w));
+            }
+        }
+
+        Dispatch::SetInstructionSet(previous);
     }
 }
 
@@ -0,0 +1,2 @@
+#include "Math/math.hpp"
+float f(){ return Vector3(3,4,0).Length() + Quaternion::Identity().Normalized().W(); }
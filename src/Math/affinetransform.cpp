@@ -0,0 +1,33 @@
+#include "Math/affinetransform.hpp"
+
+#include <stdexcept>
+
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const AffineTransform& m)
+{
+    return out << "{ { " << m.m00 << ' ' << m.m01 << ' ' << m.m02 << ' ' << m.m03 << " } { "
+                        << m.m10 << ' ' << m.m11 << ' ' << m.m12 << ' ' << m.m13 << " } { "
+                        << m.m20 << ' ' << m.m21 << ' ' << m.m22 << ' ' << m.m23 << " } }";
+}
+
+MATH_INLINE void AffineTransform::Trs(
+    const std::span<const Vector3> translations,
+    const std::span<const Quaternion> rotations,
+    const std::span<const Vector3> scales,
+    const std::span<AffineTransform> results
+)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float_t), "Quaternion must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(AffineTransform) == 12 * sizeof(float_t), "AffineTransform must be tightly packed to be used as an array of float_t");
+
+    if (rotations.size() != translations.size() || scales.size() != translations.size())
+        MATH_THROW(std::invalid_argument("The translation, rotation and scaling ranges must have the same size"));
+
+    if (results.size() < translations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the translation range"));
+
+    if (translations.empty())
+        return;
+
+    Dispatch::GetKernels().composeTrs3x4(translations.front().Data(), rotations.front().Data(), scales.front().Data(), results.front().Data(), translations.size());
+}
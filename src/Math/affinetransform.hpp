@@ -0,0 +1,618 @@
+#pragma once
+
+#include <format>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/calc.hpp"
+#include "Math/matrix.hpp"
+#include "Math/matrix3.hpp"
+#include "Math/quaternion.hpp"
+#include "Math/simd.hpp"
+#include "Math/vector3.hpp"
+
+/// @file affinetransform.hpp
+/// @brief Defines the AffineTransform struct.
+
+/// @brief The AffineTransform struct represents the first three rows of an affine transformation Matrix, e.g. one whose last row is (0, 0, 0, 1).
+///
+/// Values are stored using the column-major convention, like Matrix, but without the last row, so that this struct only takes 48 bytes.
+/// Its products, inversion and vector transformations also skip that row, which makes them cheaper than those of a Matrix.
+/// Use it for model matrices, and convert it to a Matrix when it needs to be combined with a projection.
+struct MATH_TOOLBOX AffineTransform
+{
+    /// @brief The component at position [0, 0] of an AffineTransform.
+    float_t m00 = 0.f;
+
+    /// @brief The component at position [1, 0] of an AffineTransform.
+    float_t m10 = 0.f;
+
+    /// @brief The component at position [2, 0] of an AffineTransform.
+    float_t m20 = 0.f;
+
+    /// @brief The component at position [0, 1] of an AffineTransform.
+    float_t m01 = 0.f;
+
+    /// @brief The component at position [1, 1] of an AffineTransform.
+    float_t m11 = 0.f;
+
+    /// @brief The component at position [2, 1] of an AffineTransform.
+    float_t m21 = 0.f;
+
+    /// @brief The component at position [0, 2] of an AffineTransform.
+    float_t m02 = 0.f;
+
+    /// @brief The component at position [1, 2] of an AffineTransform.
+    float_t m12 = 0.f;
+
+    /// @brief The component at position [2, 2] of an AffineTransform.
+    float_t m22 = 0.f;
+
+    /// @brief The component at position [0, 3] of an AffineTransform, e.g. the @c x component of its translation.
+    float_t m03 = 0.f;
+
+    /// @brief The component at position [1, 3] of an AffineTransform, e.g. the @c y component of its translation.
+    float_t m13 = 0.f;
+
+    /// @brief The component at position [2, 3] of an AffineTransform, e.g. the @c z component of its translation.
+    float_t m23 = 0.f;
+
+    /// @brief Returns the identity AffineTransform.
+    [[nodiscard]]
+    static constexpr AffineTransform Identity() noexcept;
+
+    /// @brief Returns the identity AffineTransform.
+    static constexpr void Identity(AffineTransform* result) noexcept;
+
+    /// @brief Creates a 3D translation AffineTransform.
+    [[nodiscard]]
+    static constexpr AffineTransform Translation(const Vector3& translation) noexcept;
+
+    /// @brief Creates a 3D translation AffineTransform.
+    static constexpr void Translation(const Vector3& translation, AffineTransform* result) noexcept;
+
+    /// @brief Creates a 3D scaling AffineTransform.
+    [[nodiscard]]
+    static constexpr AffineTransform Scaling(const Vector3& scale) noexcept;
+
+    /// @brief Creates a 3D scaling AffineTransform.
+    static constexpr void Scaling(const Vector3& scale, AffineTransform* result) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    ///
+    /// @see Matrix::Trs(const Vector3&, const Vector3&, const Vector3&)
+    [[nodiscard]]
+    static constexpr AffineTransform Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    static constexpr void Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, AffineTransform* result) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    ///
+    /// @see Matrix::Trs(const Vector3&, float_t, const Vector3&, const Vector3&)
+    [[nodiscard]]
+    static constexpr AffineTransform Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    static constexpr void Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale, AffineTransform* result) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    ///
+    /// @see Matrix::Trs(const Vector3&, const Matrix&, const Vector3&)
+    [[nodiscard]]
+    static constexpr AffineTransform Trs(const Vector3& translation, const Matrix3& rotation, const Vector3& scale) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    static constexpr void Trs(const Vector3& translation, const Matrix3& rotation, const Vector3& scale, AffineTransform* result) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    ///
+    /// @see Matrix::Trs(const Vector3&, const Quaternion&, const Vector3&)
+    [[nodiscard]]
+    static constexpr AffineTransform Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform from the given translation, rotation and scaling.
+    static constexpr void Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, AffineTransform* result) noexcept;
+
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) AffineTransform for each of the given translations, rotations and scalings.
+    ///
+    /// @throws std::invalid_argument If @p translations, @p rotations and @p scales don't have the same size, or if @p results is smaller than them.
+    /// @see Matrix::Trs(std::span<const Vector3>, std::span<const Quaternion>, std::span<const Vector3>, std::span<Matrix>)
+    static void Trs(std::span<const Vector3> translations, std::span<const Quaternion> rotations, std::span<const Vector3> scales, std::span<AffineTransform> results);
+
+    /// @brief Constructs an AffineTransform with all its values set to 0.
+    constexpr AffineTransform() = default;
+
+    /// @brief Constructs an AffineTransform with its components set to the data pointed by @c data.
+    ///
+    /// This constructor assumes that @c data is a valid pointer pointing to at least 12 @c float_t values, stored column by column.
+    ///
+    /// @param data The data where the values for this AffineTransform's components are located.
+    constexpr explicit AffineTransform(const float_t* data) noexcept;
+
+    /// @brief Constructs an AffineTransform from its linear part and its translation.
+    constexpr AffineTransform(const Matrix3& linear, const Vector3& translation) noexcept;
+
+    /// @brief Constructs an AffineTransform from the first three rows of @p matrix, ignoring its last row.
+    constexpr explicit AffineTransform(const Matrix& matrix) noexcept;
+
+    /// @brief Constructs an AffineTransform with 12 values, given row by row.
+    constexpr AffineTransform(
+        float_t m00, float_t m01, float_t m02, float_t m03,
+        float_t m10, float_t m11, float_t m12, float_t m13,
+        float_t m20, float_t m21, float_t m22, float_t m23
+    ) noexcept;
+
+    /// @brief Gets a pointer to the first value of this AffineTransform.
+    ///
+    /// @returns A pointer to the first value of this AffineTransform.
+    [[nodiscard]]
+    constexpr const float_t* Data() const noexcept;
+
+    /// @brief Gets a pointer to the first value of this AffineTransform.
+    ///
+    /// @returns A pointer to the first value of this AffineTransform.
+    [[nodiscard]]
+    constexpr float_t* Data() noexcept;
+
+    /// @brief Returns whether this AffineTransform is the identity AffineTransform.
+    [[nodiscard]]
+    constexpr bool_t IsIdentity() const noexcept;
+
+    /// @brief Computes the determinant of this AffineTransform, e.g. the one of its linear part.
+    [[nodiscard]]
+    constexpr float_t Determinant() const noexcept;
+
+    /// @brief Computes the invert of this AffineTransform.
+    ///
+    /// This only inverts the linear part and transforms the translation accordingly, like Matrix::InvertedAffine.
+    ///
+    /// @throws std::invalid_argument If this AffineTransform isn't invertible.
+    [[nodiscard]]
+    constexpr AffineTransform Inverted() const;
+
+    /// @brief Computes the invert of this AffineTransform.
+    ///
+    /// @throws std::invalid_argument If this AffineTransform isn't invertible.
+    constexpr void Inverted(AffineTransform* result) const;
+
+    /// @brief Computes the invert of this AffineTransform like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<AffineTransform> TryInverted() const noexcept;
+
+    /// @brief Computes the invert of this AffineTransform like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(AffineTransform* result) const noexcept;
+
+    /// @brief Transforms a point, e.g. applies the linear part and the translation.
+    [[nodiscard]]
+    constexpr Vector3 TransformPoint(const Vector3& point) const noexcept;
+
+    /// @brief Transforms a direction, e.g. only applies the linear part.
+    [[nodiscard]]
+    constexpr Vector3 TransformDirection(const Vector3& direction) const noexcept;
+
+    /// @brief Retrieves this AffineTransform's value at position @c [row, col].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [row, col].
+    [[nodiscard]]
+    constexpr float_t At(size_t row, size_t col) const;
+
+    /// @brief Retrieves this AffineTransform's value at position @c [row, col].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [row, col].
+    [[nodiscard]]
+    constexpr float_t& At(size_t row, size_t col);
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t row, size_t col) noexcept;
+
+    /// @brief Converts this AffineTransform to a Matrix by adding the (0, 0, 0, 1) last row.
+    [[nodiscard]]
+    constexpr explicit operator Matrix() const noexcept;
+
+    /// @brief Converts this AffineTransform to a Matrix3 by cropping its translation, e.g. returns its linear part.
+    [[nodiscard]]
+    constexpr explicit operator Matrix3() const noexcept;
+};
+
+/// @brief Combines two @ref AffineTransform "AffineTransforms", e.g. applying @p rhs then @p lhs.
+///
+/// Uses SIMD instructions when @c MATH_SIMD_SSE is defined and the call isn't constant-evaluated.
+[[nodiscard]]
+constexpr AffineTransform operator*(const AffineTransform& lhs, const AffineTransform& rhs) noexcept;
+
+/// @brief Transforms a point by an AffineTransform, like @ref operator*(const Matrix&, const Vector3&).
+[[nodiscard]]
+constexpr Vector3 operator*(const AffineTransform& transform, const Vector3& point) noexcept;
+
+/// @brief Combines two @ref AffineTransform "AffineTransforms" according to @ref operator*(const AffineTransform&, const AffineTransform&), placing the result in @p lhs.
+constexpr AffineTransform& operator*=(AffineTransform& lhs, const AffineTransform& rhs) noexcept;
+
+/// @brief Checks if two @ref AffineTransform "AffineTransforms" are equal.
+[[nodiscard]]
+constexpr bool_t operator==(const AffineTransform& a, const AffineTransform& b) noexcept;
+
+/// @brief Checks if two @ref AffineTransform "AffineTransforms" are different.
+[[nodiscard]]
+constexpr bool_t operator!=(const AffineTransform& a, const AffineTransform& b) noexcept;
+
+/// @brief Streams an AffineTransform into @p out, printing its values one by one on a single line.
+MATH_TOOLBOX std::ostream& operator<<(std::ostream& out, const AffineTransform& m);
+
+constexpr AffineTransform AffineTransform::Identity() noexcept
+{
+    return AffineTransform(
+        1.f, 0.f, 0.f, 0.f,
+        0.f, 1.f, 0.f, 0.f,
+        0.f, 0.f, 1.f, 0.f
+    );
+}
+
+constexpr void AffineTransform::Identity(AffineTransform* result) noexcept { *result = Identity(); }
+
+constexpr AffineTransform AffineTransform::Translation(const Vector3& translation) noexcept
+{
+    return AffineTransform(
+        1.f, 0.f, 0.f, translation.x,
+        0.f, 1.f, 0.f, translation.y,
+        0.f, 0.f, 1.f, translation.z
+    );
+}
+
+constexpr void AffineTransform::Translation(const Vector3& translation, AffineTransform* result) noexcept { *result = Translation(translation); }
+
+constexpr AffineTransform AffineTransform::Scaling(const Vector3& scale) noexcept
+{
+    return AffineTransform(
+        scale.x,     0.f,     0.f, 0.f,
+            0.f, scale.y,     0.f, 0.f,
+            0.f,     0.f, scale.z, 0.f
+    );
+}
+
+constexpr void AffineTransform::Scaling(const Vector3& scale, AffineTransform* result) noexcept { *result = Scaling(scale); }
+
+constexpr AffineTransform AffineTransform::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept
+{
+    AffineTransform result;
+    Trs(translation, rotation, scale, &result);
+    return result;
+}
+
+constexpr void AffineTransform::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, AffineTransform* result) noexcept
+{
+    Trs(translation, Matrix3::Rotation(rotation), scale, result);
+}
+
+constexpr AffineTransform AffineTransform::Trs(const Vector3& translation, const float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept
+{
+    AffineTransform result;
+    Trs(translation, rotationAngle, rotationAxis, scale, &result);
+    return result;
+}
+
+constexpr void AffineTransform::Trs(
+    const Vector3& translation,
+    const float_t rotationAngle,
+    const Vector3& rotationAxis,
+    const Vector3& scale,
+    AffineTransform* result
+) noexcept
+{
+    Trs(translation, Matrix3::Rotation(rotationAngle, rotationAxis), scale, result);
+}
+
+constexpr AffineTransform AffineTransform::Trs(const Vector3& translation, const Matrix3& rotation, const Vector3& scale) noexcept
+{
+    AffineTransform result;
+    Trs(translation, rotation, scale, &result);
+    return result;
+}
+
+constexpr void AffineTransform::Trs(const Vector3& translation, const Matrix3& rotation, const Vector3& scale, AffineTransform* result) noexcept
+{
+    // Scaling the columns of the rotation is the same as multiplying it by a scaling matrix
+    *result = AffineTransform(
+        rotation.m00 * scale.x, rotation.m01 * scale.y, rotation.m02 * scale.z, translation.x,
+        rotation.m10 * scale.x, rotation.m11 * scale.y, rotation.m12 * scale.z, translation.y,
+        rotation.m20 * scale.x, rotation.m21 * scale.y, rotation.m22 * scale.z, translation.z
+    );
+}
+
+constexpr AffineTransform AffineTransform::Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept
+{
+    AffineTransform result;
+    Trs(translation, rotation, scale, &result);
+    return result;
+}
+
+constexpr void AffineTransform::Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, AffineTransform* result) noexcept
+{
+    Trs(translation, Matrix3::Rotation(rotation), scale, result);
+}
+
+constexpr AffineTransform::AffineTransform(const float_t* const data) noexcept
+    : m00(data[0]), m10(data[1]), m20(data[2])
+    , m01(data[3]), m11(data[4]), m21(data[5])
+    , m02(data[6]), m12(data[7]), m22(data[8])
+    , m03(data[9]), m13(data[10]), m23(data[11])
+{
+}
+
+constexpr AffineTransform::AffineTransform(const Matrix3& linear, const Vector3& translation) noexcept
+    : m00(linear.m00), m10(linear.m10), m20(linear.m20)
+    , m01(linear.m01), m11(linear.m11), m21(linear.m21)
+    , m02(linear.m02), m12(linear.m12), m22(linear.m22)
+    , m03(translation.x), m13(translation.y), m23(translation.z)
+{
+}
+
+constexpr AffineTransform::AffineTransform(const Matrix& matrix) noexcept
+    : m00(matrix.m00), m10(matrix.m10), m20(matrix.m20)
+    , m01(matrix.m01), m11(matrix.m11), m21(matrix.m21)
+    , m02(matrix.m02), m12(matrix.m12), m22(matrix.m22)
+    , m03(matrix.m03), m13(matrix.m13), m23(matrix.m23)
+{
+}
+
+constexpr AffineTransform::AffineTransform(
+    const float_t m00, const float_t m01, const float_t m02, const float_t m03,
+    const float_t m10, const float_t m11, const float_t m12, const float_t m13,
+    const float_t m20, const float_t m21, const float_t m22, const float_t m23
+) noexcept
+    : m00(m00), m10(m10), m20(m20)
+    , m01(m01), m11(m11), m21(m21)
+    , m02(m02), m12(m12), m22(m22)
+    , m03(m03), m13(m13), m23(m23)
+{
+}
+
+constexpr const float_t* AffineTransform::Data() const noexcept { return &m00; }
+
+constexpr float_t* AffineTransform::Data() noexcept { return &m00; }
+
+constexpr bool_t AffineTransform::IsIdentity() const noexcept
+{
+    return Calc::Equals(m00, 1.f) && Calc::IsZero(m01) && Calc::IsZero(m02) && Calc::IsZero(m03)
+        && Calc::IsZero(m10) && Calc::Equals(m11, 1.f) && Calc::IsZero(m12) && Calc::IsZero(m13)
+        && Calc::IsZero(m20) && Calc::IsZero(m21) && Calc::Equals(m22, 1.f) && Calc::IsZero(m23);
+}
+
+constexpr float_t AffineTransform::Determinant() const noexcept
+{
+    return m00 * (m11 * m22 - m12 * m21)
+        + m01 * (m12 * m20 - m10 * m22)
+        + m02 * (m10 * m21 - m11 * m20);
+}
+
+constexpr AffineTransform AffineTransform::Inverted() const
+{
+    AffineTransform result;
+    Inverted(&result);
+    return result;
+}
+
+constexpr void AffineTransform::Inverted(AffineTransform* result) const
+{
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("AffineTransform isn't invertible"));
+}
+
+constexpr std::optional<AffineTransform> AffineTransform::TryInverted() const noexcept
+{
+    AffineTransform result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t AffineTransform::TryInverted(AffineTransform* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::InvertAffine3x4(Data(), result->Data());
+#endif
+
+    const float_t cofactor00 = m11 * m22 - m12 * m21;
+    const float_t cofactor01 = m12 * m20 - m10 * m22;
+    const float_t cofactor02 = m10 * m21 - m11 * m20;
+
+    const float_t determinant = m00 * cofactor00 + m01 * cofactor01 + m02 * cofactor02;
+
+    if (determinant == 0.f) [[unlikely]]
+        return false;
+
+    const float_t invDeterminant = 1.f / determinant;
+
+    const float_t i00 = cofactor00 * invDeterminant;
+    const float_t i01 = (m02 * m21 - m01 * m22) * invDeterminant;
+    const float_t i02 = (m01 * m12 - m02 * m11) * invDeterminant;
+
+    const float_t i10 = cofactor01 * invDeterminant;
+    const float_t i11 = (m00 * m22 - m02 * m20) * invDeterminant;
+    const float_t i12 = (m02 * m10 - m00 * m12) * invDeterminant;
+
+    const float_t i20 = cofactor02 * invDeterminant;
+    const float_t i21 = (m01 * m20 - m00 * m21) * invDeterminant;
+    const float_t i22 = (m00 * m11 - m01 * m10) * invDeterminant;
+
+    *result = AffineTransform(
+        i00, i01, i02, -(i00 * m03 + i01 * m13 + i02 * m23),
+        i10, i11, i12, -(i10 * m03 + i11 * m13 + i12 * m23),
+        i20, i21, i22, -(i20 * m03 + i21 * m13 + i22 * m23)
+    );
+
+    return true;
+}
+
+constexpr Vector3 AffineTransform::TransformPoint(const Vector3& point) const noexcept
+{
+    return Vector3(
+        point.x * m00 + point.y * m01 + point.z * m02 + m03,
+        point.x * m10 + point.y * m11 + point.z * m12 + m13,
+        point.x * m20 + point.y * m21 + point.z * m22 + m23
+    );
+}
+
+constexpr Vector3 AffineTransform::TransformDirection(const Vector3& direction) const noexcept
+{
+    return Vector3(
+        direction.x * m00 + direction.y * m01 + direction.z * m02,
+        direction.x * m10 + direction.y * m11 + direction.z * m12,
+        direction.x * m20 + direction.y * m21 + direction.z * m22
+    );
+}
+
+constexpr float_t AffineTransform::At(const size_t row, const size_t col) const
+{
+    if (row < 3 && col < 4) [[likely]]
+        return Data()[col * 3 + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("AffineTransform subscript out of range"));
+}
+
+constexpr float_t& AffineTransform::At(const size_t row, const size_t col)
+{
+    if (row < 3 && col < 4) [[likely]]
+        return Data()[col * 3 + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("AffineTransform subscript out of range"));
+}
+
+constexpr float_t AffineTransform::UncheckedAt(const size_t row, const size_t col) const noexcept { return Data()[col * 3 + row]; }
+
+constexpr float_t& AffineTransform::UncheckedAt(const size_t row, const size_t col) noexcept { return Data()[col * 3 + row]; }
+
+constexpr AffineTransform::operator Matrix() const noexcept
+{
+    return Matrix(
+        m00, m01, m02, m03,
+        m10, m11, m12, m13,
+        m20, m21, m22, m23,
+        0.f, 0.f, 0.f, 1.f
+    );
+}
+
+constexpr AffineTransform::operator Matrix3() const noexcept
+{
+    return Matrix3(
+        m00, m01, m02,
+        m10, m11, m12,
+        m20, m21, m22
+    );
+}
+
+constexpr AffineTransform operator*(const AffineTransform& lhs, const AffineTransform& rhs) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        AffineTransform result;
+        Simd::MultiplyAffine3x4(lhs.Data(), rhs.Data(), result.Data());
+        return result;
+    }
+#endif
+
+    return AffineTransform(
+        lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20,
+        lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21,
+        lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22,
+        lhs.m00 * rhs.m03 + lhs.m01 * rhs.m13 + lhs.m02 * rhs.m23 + lhs.m03,
+
+        lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20,
+        lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21,
+        lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22,
+        lhs.m10 * rhs.m03 + lhs.m11 * rhs.m13 + lhs.m12 * rhs.m23 + lhs.m13,
+
+        lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20,
+        lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21,
+        lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22,
+        lhs.m20 * rhs.m03 + lhs.m21 * rhs.m13 + lhs.m22 * rhs.m23 + lhs.m23
+    );
+}
+
+constexpr Vector3 operator*(const AffineTransform& transform, const Vector3& point) noexcept { return transform.TransformPoint(point); }
+
+constexpr AffineTransform& operator*=(AffineTransform& lhs, const AffineTransform& rhs) noexcept { return lhs = lhs * rhs; }
+
+constexpr bool_t operator==(const AffineTransform& a, const AffineTransform& b) noexcept
+{
+    return a.m00 == b.m00 && a.m01 == b.m01 && a.m02 == b.m02 && a.m03 == b.m03
+        && a.m10 == b.m10 && a.m11 == b.m11 && a.m12 == b.m12 && a.m13 == b.m13
+        && a.m20 == b.m20 && a.m21 == b.m21 && a.m22 == b.m22 && a.m23 == b.m23;
+}
+
+constexpr bool_t operator!=(const AffineTransform& a, const AffineTransform& b) noexcept { return !(a == b); }
+
+template <>
+struct std::formatter<AffineTransform>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx);
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(const AffineTransform& m, FmtContext& ctx) const;
+
+private:
+    std::string m_Format;
+    bool_t m_Multiline = false;
+};
+
+template <class ParseContext>
+constexpr typename ParseContext::iterator std::formatter<AffineTransform, char_t>::parse(ParseContext& ctx)
+{
+    auto it = ctx.begin();
+    if (it == ctx.end())
+        return it;
+
+    if (*it == 'm')
+    {
+        m_Multiline = true;
+        it++;
+    }
+
+    while (*it != '}' && it != ctx.end())
+        m_Format += *it++;
+
+    return it;
+}
+
+template <class FmtContext>
+typename FmtContext::iterator std::formatter<AffineTransform>::format(const AffineTransform& m, FmtContext& ctx) const
+{
+    std::ostringstream out;
+
+    const char_t separator = m_Multiline ? '\n' : ' ';
+
+    out << std::vformat(
+            "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]" + separator
+            + "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]" + separator
+            + "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]",
+            std::make_format_args(
+                    m.m00, m.m01, m.m02, m.m03,
+                    m.m10, m.m11, m.m12, m.m13,
+                    m.m20, m.m21, m.m22, m.m23
+            )
+    );
+
+    return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+}
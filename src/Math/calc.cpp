@@ -1,24 +1,36 @@
 #include "Math/calc.hpp"
 
+#include <stdexcept>
+
+#include "Math/affinetransform.hpp"
+#include "Math/dispatch.hpp"
 #include "Math/matrix.hpp"
 #include "Math/matrix2.hpp"
 #include "Math/matrix3.hpp"
+#include "Math/matrix3a.hpp"
 #include "Math/quaternion.hpp"
 
-bool_t Calc::Equals(const Matrix2& a, const Matrix2& b) noexcept
+MATH_INLINE bool_t Calc::Equals(const Matrix2& a, const Matrix2& b) noexcept
 {
     return Equals(a.m00, b.m00) && Equals(a.m01, b.m01)
         && Equals(a.m10, b.m10) && Equals(a.m11, b.m11);
 }
 
-bool_t Calc::Equals(const Matrix3& a, const Matrix3& b) noexcept
+MATH_INLINE bool_t Calc::Equals(const Matrix3& a, const Matrix3& b) noexcept
+{
+    return Equals(a.m00, b.m00) && Equals(a.m01, b.m01) && Equals(a.m02, b.m02)
+        && Equals(a.m10, b.m10) && Equals(a.m11, b.m11) && Equals(a.m12, b.m12)
+        && Equals(a.m20, b.m20) && Equals(a.m21, b.m21) && Equals(a.m22, b.m22);
+}
+
+MATH_INLINE bool_t Calc::Equals(const Matrix3A& a, const Matrix3A& b) noexcept
 {
     return Equals(a.m00, b.m00) && Equals(a.m01, b.m01) && Equals(a.m02, b.m02)
         && Equals(a.m10, b.m10) && Equals(a.m11, b.m11) && Equals(a.m12, b.m12)
         && Equals(a.m20, b.m20) && Equals(a.m21, b.m21) && Equals(a.m22, b.m22);
 }
 
-bool_t Calc::Equals(const Matrix& a, const Matrix& b) noexcept
+MATH_INLINE bool_t Calc::Equals(const Matrix& a, const Matrix& b) noexcept
 {
     return Equals(a.m00, b.m00) && Equals(a.m01, b.m01) && Equals(a.m02, b.m02) && Equals(a.m03, b.m03)
         && Equals(a.m10, b.m10) && Equals(a.m11, b.m11) && Equals(a.m12, b.m12) && Equals(a.m13, b.m13)
@@ -26,7 +38,209 @@ bool_t Calc::Equals(const Matrix& a, const Matrix& b) noexcept
         && Equals(a.m30, b.m30) && Equals(a.m31, b.m31) && Equals(a.m32, b.m32) && Equals(a.m33, b.m33);
 }
 
-bool_t Calc::Equals(const Quaternion& a, const Quaternion& b) noexcept
+MATH_INLINE bool_t Calc::Equals(const AffineTransform& a, const AffineTransform& b) noexcept
+{
+    return Equals(a.m00, b.m00) && Equals(a.m01, b.m01) && Equals(a.m02, b.m02) && Equals(a.m03, b.m03)
+        && Equals(a.m10, b.m10) && Equals(a.m11, b.m11) && Equals(a.m12, b.m12) && Equals(a.m13, b.m13)
+        && Equals(a.m20, b.m20) && Equals(a.m21, b.m21) && Equals(a.m22, b.m22) && Equals(a.m23, b.m23);
+}
+
+MATH_INLINE bool_t Calc::Equals(const Quaternion& a, const Quaternion& b) noexcept
 {
     return Equals(a.imaginary, b.imaginary) && Equals(a.real, b.real);
 }
+
+MATH_INLINE void Calc::SinCos(const std::span<const float_t> angles, const std::span<float_t> sines, const std::span<float_t> cosines)
+{
+    if (sines.size() < angles.size() || cosines.size() < angles.size())
+        MATH_THROW(std::invalid_argument("The output ranges must be at least as large as the angle range"));
+
+    size_t i = 0;
+
+#ifdef MATH_SIMD_SSE
+    for (; i + 4 <= angles.size(); i += 4)
+    {
+        const __m128 a = _mm_loadu_ps(&angles[i]);
+
+        // Out of range angles and NaNs are handled by the scalar version
+        if (!Simd::IsSinCosInRange(a))
+        {
+            for (size_t j = i; j < i + 4; j++)
+                SinCos(angles[j], &sines[j], &cosines[j]);
+            continue;
+        }
+
+        __m128 sin, cos;
+        Simd::SinCos(a, &sin, &cos);
+        _mm_storeu_ps(&sines[i], sin);
+        _mm_storeu_ps(&cosines[i], cos);
+    }
+#endif
+
+    for (; i < angles.size(); i++)
+        SinCos(angles[i], &sines[i], &cosines[i]);
+}
+
+MATH_INLINE void Calc::SinCos(const std::span<const Vector3> angles, const std::span<Vector3> sines, const std::span<Vector3> cosines)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+
+    if (sines.size() < angles.size() || cosines.size() < angles.size())
+        MATH_THROW(std::invalid_argument("The output ranges must be at least as large as the angle range"));
+
+    if (angles.empty())
+        return;
+
+    const size_t count = angles.size() * 3;
+    SinCos(std::span(angles.front().Data(), count), std::span(sines.front().Data(), count), std::span(cosines.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Round(const std::span<const float_t> values, const std::span<float_t> result)
+{
+    if (result.size() < values.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    Dispatch::GetKernels().roundValues(values.data(), result.data(), values.size());
+}
+
+MATH_INLINE void Calc::Round(const std::span<const Vector2> vectors, const std::span<Vector2> result)
+{
+    static_assert(sizeof(Vector2) == 2 * sizeof(float_t), "Vector2 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 2;
+    Round(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Round(const std::span<const Vector3> vectors, const std::span<Vector3> result)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 3;
+    Round(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Round(const std::span<const Vector4> vectors, const std::span<Vector4> result)
+{
+    static_assert(sizeof(Vector4) == 4 * sizeof(float_t), "Vector4 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 4;
+    Round(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Floor(const std::span<const float_t> values, const std::span<float_t> result)
+{
+    if (result.size() < values.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    Dispatch::GetKernels().floorValues(values.data(), result.data(), values.size());
+}
+
+MATH_INLINE void Calc::Floor(const std::span<const Vector2> vectors, const std::span<Vector2> result)
+{
+    static_assert(sizeof(Vector2) == 2 * sizeof(float_t), "Vector2 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 2;
+    Floor(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Floor(const std::span<const Vector3> vectors, const std::span<Vector3> result)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 3;
+    Floor(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Floor(const std::span<const Vector4> vectors, const std::span<Vector4> result)
+{
+    static_assert(sizeof(Vector4) == 4 * sizeof(float_t), "Vector4 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 4;
+    Floor(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Ceil(const std::span<const float_t> values, const std::span<float_t> result)
+{
+    if (result.size() < values.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    Dispatch::GetKernels().ceilValues(values.data(), result.data(), values.size());
+}
+
+MATH_INLINE void Calc::Ceil(const std::span<const Vector2> vectors, const std::span<Vector2> result)
+{
+    static_assert(sizeof(Vector2) == 2 * sizeof(float_t), "Vector2 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 2;
+    Ceil(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Ceil(const std::span<const Vector3> vectors, const std::span<Vector3> result)
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 3;
+    Ceil(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
+
+MATH_INLINE void Calc::Ceil(const std::span<const Vector4> vectors, const std::span<Vector4> result)
+{
+    static_assert(sizeof(Vector4) == 4 * sizeof(float_t), "Vector4 must be tightly packed to be used as an array of float_t");
+
+    if (result.size() < vectors.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the input range"));
+
+    if (vectors.empty())
+        return;
+
+    const size_t count = vectors.size() * 4;
+    Ceil(std::span(vectors.front().Data(), count), std::span(result.front().Data(), count));
+}
@@ -1,12 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <limits>
 #include <numbers>
+#include <span>
 
 #include "Math/core.hpp"
+#include "Math/denormals.hpp"
 #include "Math/easing.hpp"
+#include "Math/simd.hpp"
 #include "Math/vector2.hpp"
 #include "Math/vector3.hpp"
+#include "Math/vector3a.hpp"
 #include "Math/vector4.hpp"
 
 /// @file calc.hpp
@@ -22,13 +28,22 @@
 #define ZERO 1e-6f
 #endif
 
-struct Matrix2;
-struct Matrix3;
-struct Matrix;
-struct Quaternion;
-struct Vector2;
-struct Vector3;
-struct Vector4;
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT;
+using Matrix2 = MatrixT<2, 2, float_t>;
+using Matrix3 = MatrixT<3, 3, float_t>;
+using Matrix = MatrixT<4, 4, float_t>;
+template <typename T>
+struct QuaternionT;
+using Quaternion = QuaternionT<float_t>;
+template <size_t N, typename T>
+struct VectorT;
+using Vector2 = VectorT<2, float_t>;
+using Vector3 = VectorT<3, float_t>;
+using Vector4 = VectorT<4, float_t>;
+struct Vector3A;
+struct AffineTransform;
+struct Matrix3A;
 
 /// @namespace Calc
 /// @brief This namespace contains mathematical constants and useful functions/macros.
@@ -97,9 +112,23 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector4 Abs(const Vector4& vector) noexcept;
 
+	/// @brief	A constexpr version of the @c std::trunc function.
+	///
+	/// At run-time, this uses the SSE4.1 @c roundss instruction when compiling with AVX, and SSE2 conversions otherwise.
+	/// In constant expressions, the result is computed using an integer conversion. Both are exact for any value, including infinities and NaNs.
+	///
+	/// @param number The number to round toward zero.
+	/// @returns The integer value of @p number, its fractional part being discarded.
+	template <std::floating_point T>
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr T Trunc(T number) noexcept;
+
 	/// @brief	A constexpr version of the @c std::round function.
 	///
-	/// @param number The number to round to the nearest integer value.
+	/// At run-time, this uses the SSE4.1 @c roundss instruction when compiling with AVX, and SSE2 conversions otherwise.
+	/// In constant expressions, the result is computed using an integer conversion. Both are exact for any value, including infinities and NaNs.
+	///
+	/// @param number The number to round to the nearest integer value, halfway cases away from zero.
 	/// @returns The rounded value of @p number.
 	template <std::floating_point T>
 	[[nodiscard]]
@@ -107,83 +136,209 @@ namespace Calc
 
 	/// @brief	A constexpr version of the @c std::round function for @c Vector2.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to round to the nearest integer value, halfway cases away from zero.
 	/// @returns A Vector2 whose components are the rounded values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector2 Round(Vector2 vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::round function for @c Vector3.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to round to the nearest integer value, halfway cases away from zero.
 	/// @returns A Vector3 whose components are the rounded values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector3 Round(const Vector3& vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::round function for @c Vector4.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to round to the nearest integer value, halfway cases away from zero.
 	/// @returns A Vector4 whose components are the rounded values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector4 Round(const Vector4& vector) noexcept;
 
-    /// @brief	A constexpr version of the @c std::floor function.
-    ///
-    /// @param number The number to floor.
-    /// @returns The floor value of @p number.
+	/// @brief	Computes the round of a range of values.
+	///
+	/// The values are processed using the best SIMD instructions supported by the CPU, see the @c Dispatch namespace.
+	///
+	/// @param values The values to round to the nearest integer value, halfway cases away from zero.
+	/// @param result The rounded values. May be the same range as @p values.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p values.
+	MATH_TOOLBOX void Round(std::span<const float_t> values, std::span<float_t> result);
+
+	/// @brief	Computes the round of the components of a range of Vector2.
+	///
+	/// This is the same as calling @ref Round(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to round to the nearest integer value, halfway cases away from zero.
+	/// @param result The rounded vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Round(std::span<const Vector2> vectors, std::span<Vector2> result);
+
+	/// @brief	Computes the round of the components of a range of Vector3.
+	///
+	/// This is the same as calling @ref Round(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to round to the nearest integer value, halfway cases away from zero.
+	/// @param result The rounded vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Round(std::span<const Vector3> vectors, std::span<Vector3> result);
+
+	/// @brief	Computes the round of the components of a range of Vector4.
+	///
+	/// This is the same as calling @ref Round(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to round to the nearest integer value, halfway cases away from zero.
+	/// @param result The rounded vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Round(std::span<const Vector4> vectors, std::span<Vector4> result);
+
+	/// @brief	A constexpr version of the @c std::floor function.
+	///
+	/// At run-time, this uses the SSE4.1 @c roundss instruction when compiling with AVX, and SSE2 conversions otherwise.
+	/// In constant expressions, the result is computed using an integer conversion. Both are exact for any value, including infinities and NaNs.
+	///
+	/// @param number The number to floor.
+	/// @returns The floor value of @p number.
 	template <std::floating_point T>
-    [[nodiscard]]
+	[[nodiscard]]
 	MATH_TOOLBOX constexpr T Floor(T number) noexcept;
 
 	/// @brief	A constexpr version of the @c std::floor function for @c Vector2.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to floor.
 	/// @returns A Vector2 whose components are the floored values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector2 Floor(Vector2 vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::floor function for @c Vector3.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to floor.
 	/// @returns A Vector3 whose components are the floored values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector3 Floor(const Vector3& vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::floor function for @c Vector4.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to floor.
 	/// @returns A Vector4 whose components are the floored values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector4 Floor(const Vector4& vector) noexcept;
 
-    /// @brief	A constexpr version of the @c std::ceil function.
-    ///
-    /// @param number The number to ceil.
-    /// @returns The ceil value of @p number.
+	/// @brief	Computes the floor of a range of values.
+	///
+	/// The values are processed using the best SIMD instructions supported by the CPU, see the @c Dispatch namespace.
+	///
+	/// @param values The values to floor.
+	/// @param result The floored values. May be the same range as @p values.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p values.
+	MATH_TOOLBOX void Floor(std::span<const float_t> values, std::span<float_t> result);
+
+	/// @brief	Computes the floor of the components of a range of Vector2.
+	///
+	/// This is the same as calling @ref Floor(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to floor.
+	/// @param result The floored vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Floor(std::span<const Vector2> vectors, std::span<Vector2> result);
+
+	/// @brief	Computes the floor of the components of a range of Vector3.
+	///
+	/// This is the same as calling @ref Floor(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to floor.
+	/// @param result The floored vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Floor(std::span<const Vector3> vectors, std::span<Vector3> result);
+
+	/// @brief	Computes the floor of the components of a range of Vector4.
+	///
+	/// This is the same as calling @ref Floor(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to floor.
+	/// @param result The floored vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Floor(std::span<const Vector4> vectors, std::span<Vector4> result);
+
+	/// @brief	A constexpr version of the @c std::ceil function.
+	///
+	/// At run-time, this uses the SSE4.1 @c roundss instruction when compiling with AVX, and SSE2 conversions otherwise.
+	/// In constant expressions, the result is computed using an integer conversion. Both are exact for any value, including infinities and NaNs.
+	///
+	/// @param number The number to ceil.
+	/// @returns The ceil value of @p number.
 	template <std::floating_point T>
-    [[nodiscard]]
+	[[nodiscard]]
 	MATH_TOOLBOX constexpr T Ceil(T number) noexcept;
 
 	/// @brief	A constexpr version of the @c std::ceil function for @c Vector2.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to ceil.
 	/// @returns A Vector2 whose components are the ceiled values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector2 Ceil(Vector2 vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::ceil function for @c Vector3.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to ceil.
 	/// @returns A Vector3 whose components are the ceiled values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector3 Ceil(const Vector3& vector) noexcept;
 
 	/// @brief	A constexpr version of the @c std::ceil function for @c Vector4.
 	///
-	/// @param vector The vector to round to the nearest integer value.
+	/// @param vector The vector to ceil.
 	/// @returns A Vector4 whose components are the ceiled values of @p vector.
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector4 Ceil(const Vector4& vector) noexcept;
 
+	/// @brief	Computes the ceil of a range of values.
+	///
+	/// The values are processed using the best SIMD instructions supported by the CPU, see the @c Dispatch namespace.
+	///
+	/// @param values The values to ceil.
+	/// @param result The ceiled values. May be the same range as @p values.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p values.
+	MATH_TOOLBOX void Ceil(std::span<const float_t> values, std::span<float_t> result);
+
+	/// @brief	Computes the ceil of the components of a range of Vector2.
+	///
+	/// This is the same as calling @ref Ceil(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to ceil.
+	/// @param result The ceiled vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Ceil(std::span<const Vector2> vectors, std::span<Vector2> result);
+
+	/// @brief	Computes the ceil of the components of a range of Vector3.
+	///
+	/// This is the same as calling @ref Ceil(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to ceil.
+	/// @param result The ceiled vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Ceil(std::span<const Vector3> vectors, std::span<Vector3> result);
+
+	/// @brief	Computes the ceil of the components of a range of Vector4.
+	///
+	/// This is the same as calling @ref Ceil(std::span<const float_t>, std::span<float_t>) on their components.
+	///
+	/// @param vectors The vectors to ceil.
+	/// @param result The ceiled vectors. May be the same range as @p vectors.
+	///
+	/// @throws std::invalid_argument If @p result is smaller than @p vectors.
+	MATH_TOOLBOX void Ceil(std::span<const Vector4> vectors, std::span<Vector4> result);
+
 	/// @brief	A constexpr version of the @c std::clamp function.
 	///
 	/// @param number The number to clamp between two values.
@@ -221,7 +376,10 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr Vector4 Clamp(const Vector4& vector, const Vector4& min, const Vector4& max) noexcept;
 
-	/// @brief	A constexpr version of the @c std::fmodf function.
+	/// @brief	A constexpr version of the @c std::fmod function.
+	///
+	/// At run-time, this calls @c std::fmod. In constant expressions, the result is computed as <c>a - Trunc(a / b) * b</c>,
+	/// which may lose precision when the quotient is larger than 2^23.
 	///
 	/// @param a The left-hand side of the modulo.
 	/// @param b The right-hand side of the modulo.
@@ -238,6 +396,202 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr bool_t IsNan(T value) noexcept;
 
+	/// @brief A constexpr version of the @c std::sqrt function.
+	///
+	/// At run-time, this calls @c std::sqrt. In constant expressions, the result is computed using Newton-Raphson steps in double precision.
+	///
+	/// @param x The value to compute the square root of.
+	/// @returns The square root of @p x, or NaN if @p x is negative.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Sqrt(float_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::sqrt function.
+	///
+	/// @see Sqrt(float_t)
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr double_t Sqrt(double_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::sin function.
+	///
+	/// At run-time, this calls @c std::sin. In constant expressions, the result is computed by @ref SinCos(float_t, float_t*, float_t*).
+	///
+	/// @param angle The angle in radians.
+	/// @returns The sine of @p angle.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Sin(float_t angle) noexcept;
+
+	/// @brief A constexpr version of the @c std::cos function.
+	///
+	/// At run-time, this calls @c std::cos. In constant expressions, the result is computed by @ref SinCos(float_t, float_t*, float_t*).
+	///
+	/// @param angle The angle in radians.
+	/// @returns The cosine of @p angle.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Cos(float_t angle) noexcept;
+
+	/// @brief A constexpr version of the @c std::tan function.
+	///
+	/// At run-time, this calls @c std::tan. In constant expressions, the result is computed by @ref SinCos(float_t, float_t*, float_t*).
+	///
+	/// @param angle The angle in radians.
+	/// @returns The tangent of @p angle.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Tan(float_t angle) noexcept;
+
+	/// @brief A constexpr version of the @c std::exp2 function.
+	///
+	/// At run-time, this calls @c std::exp2. In constant expressions, the result is computed using a polynomial in double precision.
+	///
+	/// @param x The exponent.
+	/// @returns 2 raised to the power of @p x.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Exp2(float_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::exp2 function.
+	///
+	/// @see Exp2(float_t)
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr double_t Exp2(double_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::log2 function.
+	///
+	/// At run-time, this calls @c std::log2. In constant expressions, the result is computed using a series in double precision.
+	///
+	/// @param x The value to compute the base-2 logarithm of.
+	/// @returns The base-2 logarithm of @p x, or NaN if @p x is negative.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Log2(float_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::log2 function.
+	///
+	/// @see Log2(float_t)
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr double_t Log2(double_t x) noexcept;
+
+	/// @brief A constexpr version of the @c std::pow function.
+	///
+	/// At run-time, this calls @c std::pow. In constant expressions, the result is computed as @code Exp2(exponent * Log2(base))@endcode in double precision.
+	///
+	/// @param base The base.
+	/// @param exponent The exponent.
+	/// @returns @p base raised to the power of @p exponent, or NaN if @p base is negative and @p exponent isn't an integer.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t Pow(float_t base, float_t exponent) noexcept;
+
+	/// @brief A constexpr version of the @c std::pow function.
+	///
+	/// In constant expressions, the relative error grows with the magnitude of @code exponent * Log2(base)@endcode, being a few ulps for results between 1e-20 and 1e20.
+	///
+	/// @see Pow(float_t, float_t)
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr double_t Pow(double_t base, double_t exponent) noexcept;
+
+	/// @brief Computes both @c std::sin(angle) and @c std::cos(angle), sharing a single range reduction.
+	///
+	/// The results are as precise as the standard library ones for angles between -1e6 and 1e6 radians.
+	/// At run-time, larger angles fall back to @c std::sin and @c std::cos.
+	///
+	/// @param angle The angle in radians.
+	/// @param sin The sine of @p angle.
+	/// @param cos The cosine of @p angle.
+	MATH_TOOLBOX constexpr void SinCos(float_t angle, float_t* sin, float_t* cos) noexcept;
+
+	/// @brief Computes both the sines and the cosines of a range of angles, sharing a single range reduction per angle.
+	///
+	/// On x64, the angles are processed 4 at a time using SSE, with a maximum absolute error of 2e-7 for angles between -8192 and 8192 radians.
+	/// Larger angles use @ref SinCos(float_t, float_t*, float_t*) instead.
+	///
+	/// @param angles The angles in radians.
+	/// @param sines The sines of @p angles. May be the same range as @p angles.
+	/// @param cosines The cosines of @p angles. May be the same range as @p angles.
+	///
+	/// @throws std::invalid_argument If @p sines or @p cosines is smaller than @p angles.
+	MATH_TOOLBOX void SinCos(std::span<const float_t> angles, std::span<float_t> sines, std::span<float_t> cosines);
+
+	/// @brief Computes both the sines and the cosines of the 3 components of @p angles at once.
+	///
+	/// On x64, the 3 angles are processed together using SSE if they are between -8192 and 8192 radians,
+	/// with the same precision as @ref SinCos(std::span<const float_t>, std::span<float_t>, std::span<float_t>).
+	/// Otherwise, this is the same as calling @ref SinCos(float_t, float_t*, float_t*) on each of them.
+	///
+	/// @param angles The angles in radians, e.g. Euler angles.
+	/// @param sin The sines of @p angles.
+	/// @param cos The cosines of @p angles.
+	MATH_TOOLBOX constexpr void SinCos(const Vector3& angles, Vector3* sin, Vector3* cos) noexcept;
+
+	/// @brief Computes both the sines and the cosines of the components of a range of Vector3, e.g. Euler angles.
+	///
+	/// This is the same as calling @ref SinCos(std::span<const float_t>, std::span<float_t>, std::span<float_t>) on their components.
+	///
+	/// @param angles The angles in radians.
+	/// @param sines The sines of @p angles. May be the same range as @p angles.
+	/// @param cosines The cosines of @p angles. May be the same range as @p angles.
+	///
+	/// @throws std::invalid_argument If @p sines or @p cosines is smaller than @p angles.
+	MATH_TOOLBOX void SinCos(std::span<const Vector3> angles, std::span<Vector3> sines, std::span<Vector3> cosines);
+
+	/// @brief Tag type selecting the fast approximations of the functions accepting it, e.g. @c v.Normalized(Calc::FastMath).
+	///
+	/// Those functions use @ref FastRsqrt, @ref FastSinCos, @ref FastAcos and @ref FastExp2 instead of their standard library counterparts,
+	/// trading an error of at most 1e-4 for speed.
+	struct FastMathTag
+	{
+		explicit constexpr FastMathTag() = default;
+	};
+
+	/// @brief The @ref FastMathTag value to pass to the functions accepting it.
+	constexpr FastMathTag FastMath;
+
+	/// @brief Computes a fast approximation of @c 1 / std::sqrt(x).
+	///
+	/// The maximum relative error is 5e-6, or 3e-7 when evaluated at run-time on x64.
+	///
+	/// @param x The value to compute the reciprocal square root of. Must be strictly positive.
+	/// @returns An approximation of the reciprocal square root of @p x.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t FastRsqrt(float_t x) noexcept;
+
+	/// @brief Computes fast approximations of both @c std::sin(angle) and @c std::cos(angle).
+	///
+	/// The maximum absolute error is 5e-6 for angles between -1e5 and 1e5 radians. Larger angles lose precision.
+	///
+	/// @param angle The angle in radians.
+	/// @param sin The approximation of the sine of @p angle.
+	/// @param cos The approximation of the cosine of @p angle.
+	MATH_TOOLBOX constexpr void FastSinCos(float_t angle, float_t* sin, float_t* cos) noexcept;
+
+	/// @brief Computes a fast approximation of @c std::sin(angle), with the same error as @ref FastSinCos.
+	///
+	/// @param angle The angle in radians.
+	/// @returns An approximation of the sine of @p angle.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t FastSin(float_t angle) noexcept;
+
+	/// @brief Computes a fast approximation of @c std::cos(angle), with the same error as @ref FastSinCos.
+	///
+	/// @param angle The angle in radians.
+	/// @returns An approximation of the cosine of @p angle.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t FastCos(float_t angle) noexcept;
+
+	/// @brief Computes a fast approximation of @c std::acos(x).
+	///
+	/// The maximum absolute error is 8e-5 radians.
+	///
+	/// @param x The value to compute the arc cosine of. Must be between -1 and 1.
+	/// @returns An approximation of the arc cosine of @p x, between 0 and Pi.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t FastAcos(float_t x) noexcept;
+
+	/// @brief Computes a fast approximation of @c std::exp2(x).
+	///
+	/// The maximum relative error is 3e-7. @p x is clamped between -126 and 127 so that the result stays a normal float.
+	///
+	/// @param x The exponent.
+	/// @returns An approximation of 2 raised to the power of @p x.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr float_t FastExp2(float_t x) noexcept;
+
 	/// @brief Approaches the target value by the given step size without ever exceeding it.
 	///
 	/// @param value The value to change.
@@ -345,6 +699,14 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr bool_t Equals(const Vector3& a, const Vector3& b) noexcept;
 
+	/// @brief Checks if two values are considered equal using @c IsZero().
+	///
+	/// @param a The first value.
+	/// @param b The second value.
+	/// @returns Whether the values are considered equal.
+	[[nodiscard]]
+	MATH_TOOLBOX constexpr bool_t Equals(const Vector3A& a, const Vector3A& b) noexcept;
+
 	/// @brief Checks if two values are considered equal using @c IsZero().
 	///
 	/// @param a The first value.
@@ -353,6 +715,15 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX constexpr bool_t Equals(const Vector4& a, const Vector4& b) noexcept;
 
+	/// @brief Checks if two values are considered equal using @c IsZero() if they hold floating-point values, or exactly otherwise.
+	///
+	/// @param a The first value.
+	/// @param b The second value.
+	/// @returns Whether the values are considered equal.
+	template <size_t N, typename T>
+	[[nodiscard]]
+	constexpr bool_t Equals(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept;
+
 	/// @brief Checks if two values are considered equal using @c IsZero().
 	///
 	/// @param a The first value.
@@ -369,6 +740,14 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX bool_t Equals(const Matrix3& a, const Matrix3& b) noexcept;
 
+	/// @brief Checks if two values are considered equal using @c IsZero().
+	///
+	/// @param a The first value.
+	/// @param b The second value.
+	/// @returns Whether the values are considered equal.
+	[[nodiscard]]
+	MATH_TOOLBOX bool_t Equals(const Matrix3A& a, const Matrix3A& b) noexcept;
+
 	/// @brief Checks if two values are considered equal using @c IsZero().
 	///
 	/// @param a The first value.
@@ -377,6 +756,23 @@ namespace Calc
 	[[nodiscard]]
 	MATH_TOOLBOX bool_t Equals(const Matrix& a, const Matrix& b) noexcept;
 
+	/// @brief Checks if two values are considered equal using @c IsZero().
+	///
+	/// @param a The first value.
+	/// @param b The second value.
+	/// @returns Whether the values are considered equal.
+	[[nodiscard]]
+	MATH_TOOLBOX bool_t Equals(const AffineTransform& a, const AffineTransform& b) noexcept;
+
+	/// @brief Checks if two values are considered equal using @c IsZero().
+	///
+	/// @param a The first value.
+	/// @param b The second value.
+	/// @returns Whether the values are considered equal.
+	template <size_t Rows, size_t Cols, typename T>
+	[[nodiscard]]
+	constexpr bool_t Equals(const MatrixT<Rows, Cols, T>& a, const MatrixT<Rows, Cols, T>& b) noexcept;
+
 	/// @brief Checks if two values are considered equal using @c IsZero().
 	///
 	/// @param a The first value.
@@ -421,13 +817,44 @@ constexpr Vector3 Calc::Abs(const Vector3& vector) noexcept { return { Abs(vecto
 
 constexpr Vector4 Calc::Abs(const Vector4& vector) noexcept { return { Abs(vector.x), Abs(vector.y), Abs(vector.z), Abs(vector.w) }; }
 
+template <std::floating_point T>
+constexpr T Calc::Trunc(T number) noexcept
+{
+	if (!std::is_constant_evaluated())
+	{
+#ifdef MATH_SIMD_SSE
+		if constexpr (std::is_same_v<T, float_t>)
+			return _mm_cvtss_f32(Simd::Truncate(_mm_set_ss(number)));
+#endif
+		return std::trunc(number);
+	}
+
+	// Values this large have no fractional part, and may not fit in an int64_t. NaNs also fail this test and are kept as well.
+	if (!(Abs(number) < static_cast<T>(1ull << (std::numeric_limits<T>::digits - 1))))
+		return number;
+
+	// Converting the absolute value keeps the sign of the values truncated to zero
+	if (number < 0)
+		return -static_cast<T>(static_cast<int64_t>(-number));
+	return static_cast<T>(static_cast<int64_t>(number));
+}
+
 template <std::floating_point T>
 constexpr T Calc::Round(T number) noexcept
 {
-	const int32_t lower = static_cast<int32_t>(number);
-	const int32_t upper = static_cast<int32_t>(number + 0.5f);  // NOLINT(bugprone-incorrect-roundings)
+	if (!std::is_constant_evaluated())
+	{
+#ifdef MATH_SIMD_SSE
+		if constexpr (std::is_same_v<T, float_t>)
+			return _mm_cvtss_f32(Simd::Round(_mm_set_ss(number)));
+#endif
+		return std::round(number);
+	}
 
-	return static_cast<float_t>(lower < upper ? upper : lower);
+	const T truncated = Trunc(number);
+	if (Abs(number - truncated) >= static_cast<T>(0.5))
+		return number < 0 ? truncated - 1 : truncated + 1;
+	return truncated;
 }
 
 constexpr Vector2 Calc::Round(const Vector2 vector) noexcept { return { Round(vector.x), Round(vector.y) }; }
@@ -437,7 +864,20 @@ constexpr Vector3 Calc::Round(const Vector3& vector) noexcept { return { Round(v
 constexpr Vector4 Calc::Round(const Vector4& vector) noexcept { return { Round(vector.x), Round(vector.y), Round(vector.z), Round(vector.w) }; }
 
 template <std::floating_point T>
-constexpr T Calc::Floor(T number) noexcept { return Round(number - 0.5f); }
+constexpr T Calc::Floor(T number) noexcept
+{
+	if (!std::is_constant_evaluated())
+	{
+#ifdef MATH_SIMD_SSE
+		if constexpr (std::is_same_v<T, float_t>)
+			return _mm_cvtss_f32(Simd::Floor(_mm_set_ss(number)));
+#endif
+		return std::floor(number);
+	}
+
+	const T truncated = Trunc(number);
+	return truncated > number ? truncated - 1 : truncated;
+}
 
 constexpr Vector2 Calc::Floor(const Vector2 vector) noexcept { return { Floor(vector.x), Floor(vector.y) }; }
 
@@ -446,7 +886,20 @@ constexpr Vector3 Calc::Floor(const Vector3& vector) noexcept { return { Floor(v
 constexpr Vector4 Calc::Floor(const Vector4& vector) noexcept { return { Floor(vector.x), Floor(vector.y), Floor(vector.z), Floor(vector.w) }; }
 
 template <std::floating_point T>
-constexpr T Calc::Ceil(T number) noexcept { return Round(number + 0.5f); }
+constexpr T Calc::Ceil(T number) noexcept
+{
+	if (!std::is_constant_evaluated())
+	{
+#ifdef MATH_SIMD_SSE
+		if constexpr (std::is_same_v<T, float_t>)
+			return _mm_cvtss_f32(Simd::Ceil(_mm_set_ss(number)));
+#endif
+		return std::ceil(number);
+	}
+
+	const T truncated = Trunc(number);
+	return truncated < number ? truncated + 1 : truncated;
+}
 
 constexpr Vector2 Calc::Ceil(const Vector2 vector) noexcept { return { Ceil(vector.x), Ceil(vector.y) }; }
 
@@ -480,7 +933,13 @@ constexpr Vector4 Calc::Clamp(const Vector4& vector, const Vector4& min, const V
 }
 
 template <std::floating_point T>
-constexpr T Calc::Modulo(T a, T b) noexcept { return a - static_cast<float_t>(static_cast<int64_t>(a / b)) * b; }
+constexpr T Calc::Modulo(T a, T b) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::fmod(a, b);
+
+	return a - Trunc(a / b) * b;
+}
 
 template <std::floating_point T>
 constexpr bool_t Calc::IsNan(T value) noexcept
@@ -488,6 +947,323 @@ constexpr bool_t Calc::IsNan(T value) noexcept
 	return value == std::numeric_limits<T>::quiet_NaN() || value == std::numeric_limits<T>::signaling_NaN();
 }
 
+constexpr void Calc::SinCos(const float_t angle, float_t* const sin, float_t* const cos) noexcept
+{
+	// NaNs also fail this test
+	if (!std::is_constant_evaluated() && !(Abs(angle) <= 1e6f))
+	{
+		*sin = std::sin(angle);
+		*cos = std::cos(angle);
+		return;
+	}
+
+	// Reduces the angle to [-Pi / 4, Pi / 4] in double precision, Pi / 2 being split in two constants to keep the precision of the subtraction.
+	// Adding and subtracting 1.5 * 2^52 rounds to the nearest integer without branching.
+	const double_t q = static_cast<double_t>(angle) * 6.36619772367581382433e-1 + 6755399441055744. - 6755399441055744.;
+	const int64_t quadrant = static_cast<int64_t>(q);
+	const double_t x = static_cast<double_t>(angle) - q * 1.57079632673412561417 - q * 6.07710050650619224932e-11;
+
+	// Minimax polynomials on [-Pi / 4, Pi / 4], precise enough for single precision results, evaluated with Estrin's scheme to shorten the dependency chains
+	const double_t x2 = x * x;
+	const double_t x4 = x2 * x2;
+	const double_t sinPolynomial = (-1.66666666416265235595e-1 + x2 * 8.3333293858894631756e-3) + x4 * (-1.98393348360966317347e-4 + x2 * 2.7183114939898219064e-6);
+	const double_t cosPolynomial = (-4.99999997251031003120e-1 + x2 * 4.16666233237390631894e-2) + x4 * (-1.38867637746099294692e-3 + x2 * 2.43904487962774090654e-5);
+	const uint64_t s = std::bit_cast<uint64_t>(x + x * x2 * sinPolynomial);
+	const uint64_t c = std::bit_cast<uint64_t>(1. + x2 * cosPolynomial);
+
+	// sin(x + n * Pi / 2) and cos(x + n * Pi / 2) cycle through sin(x), cos(x), -sin(x) and -cos(x).
+	// The quadrant being random in most cases, the results are selected and negated using bit masks rather than branches.
+	const uint64_t swap = 0 - static_cast<uint64_t>(quadrant & 1);
+	const uint64_t sinSign = static_cast<uint64_t>(quadrant & 2) << 62;
+	const uint64_t cosSign = static_cast<uint64_t>((quadrant + 1) & 2) << 62;
+	*sin = static_cast<float_t>(std::bit_cast<double_t>(((s & ~swap) | (c & swap)) ^ sinSign));
+	*cos = static_cast<float_t>(std::bit_cast<double_t>(((c & ~swap) | (s & swap)) ^ cosSign));
+}
+
+constexpr void Calc::SinCos(const Vector3& angles, Vector3* const sin, Vector3* const cos) noexcept
+{
+#ifdef MATH_SIMD_SSE
+	if (!std::is_constant_evaluated())
+	{
+		const __m128 a = _mm_set_ps(0.f, angles.z, angles.y, angles.x);
+		if (Simd::IsSinCosInRange(a))
+		{
+			__m128 s, c;
+			Simd::SinCos(a, &s, &c);
+
+			alignas(16) float_t values[8];
+			_mm_store_ps(values, s);
+			_mm_store_ps(values + 4, c);
+			*sin = Vector3(values);
+			*cos = Vector3(values + 4);
+			return;
+		}
+	}
+#endif
+
+	SinCos(angles.x, &sin->x, &cos->x);
+	SinCos(angles.y, &sin->y, &cos->y);
+	SinCos(angles.z, &sin->z, &cos->z);
+}
+
+constexpr float_t Calc::Sqrt(const float_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::sqrt(x);
+
+	return static_cast<float_t>(Sqrt(static_cast<double_t>(x)));
+}
+
+constexpr double_t Calc::Sqrt(const double_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::sqrt(x);
+
+	if (x == 0. || x == std::numeric_limits<double_t>::infinity())
+		return x;
+
+	// NaNs also fail this test
+	if (!(x > 0.))
+		return std::numeric_limits<double_t>::quiet_NaN();
+
+	// Subnormal values are scaled up by 2^64 first, as halving their exponent field alone gives a poor guess
+	const bool_t subnormal = x < std::numeric_limits<double_t>::min();
+	const double_t scaled = subnormal ? x * 18446744073709551616. : x;
+
+	// Halving the exponent gives an initial guess within 6% of the result, which Newton-Raphson steps refine quadratically
+	double_t result = std::bit_cast<double_t>((std::bit_cast<uint64_t>(scaled) >> 1) + 0x1FF8000000000000ull);
+	for (int32_t i = 0; i < 6; i++)
+		result = 0.5 * (result + scaled / result);
+	return subnormal ? result / 4294967296. : result;
+}
+
+constexpr float_t Calc::Sin(const float_t angle) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::sin(angle);
+
+	float_t sin, cos;
+	SinCos(angle, &sin, &cos);
+	return sin;
+}
+
+constexpr float_t Calc::Cos(const float_t angle) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::cos(angle);
+
+	float_t sin, cos;
+	SinCos(angle, &sin, &cos);
+	return cos;
+}
+
+constexpr float_t Calc::Tan(const float_t angle) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::tan(angle);
+
+	float_t sin, cos;
+	SinCos(angle, &sin, &cos);
+	return sin / cos;
+}
+
+constexpr float_t Calc::Exp2(const float_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return MATH_CHECK_DENORMALS(std::exp2(x), x);
+
+	return static_cast<float_t>(Exp2(static_cast<double_t>(x)));
+}
+
+constexpr double_t Calc::Exp2(const double_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return MATH_CHECK_DENORMALS(std::exp2(x), x);
+
+	// NaNs are the only values that aren't equal to themselves
+	if (x != x)
+		return x;
+	if (x >= 1024.)
+		return std::numeric_limits<double_t>::infinity();
+	if (x < -1075.)
+		return 0.;
+
+	// 2^x = 2^n * e^(f * ln(2)), with n an integer and f in [-0.5, 0.5]
+	const int64_t n = static_cast<int64_t>(x < 0. ? x - 0.5 : x + 0.5);
+	const double_t f = (x - static_cast<double_t>(n)) * std::numbers::ln2;
+
+	// Taylor series of e^f, precise to the last bit for |f| <= ln(2) / 2
+	double_t fraction = 1.;
+	for (int32_t i = 15; i > 0; i--)
+		fraction = 1. + fraction * f / static_cast<double_t>(i);
+
+	// 2^n is applied in two halves so that subnormal and near-overflow results don't need an out-of-range exponent
+	const int64_t half = n / 2;
+	const double_t scale0 = std::bit_cast<double_t>(static_cast<uint64_t>(half + 1023) << 52);
+	const double_t scale1 = std::bit_cast<double_t>(static_cast<uint64_t>(n - half + 1023) << 52);
+	return fraction * scale0 * scale1;
+}
+
+constexpr float_t Calc::Log2(const float_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::log2(x);
+
+	return static_cast<float_t>(Log2(static_cast<double_t>(x)));
+}
+
+constexpr double_t Calc::Log2(const double_t x) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return std::log2(x);
+
+	if (x == 0.)
+		return -std::numeric_limits<double_t>::infinity();
+
+	// NaNs also fail this test
+	if (!(x > 0.))
+		return std::numeric_limits<double_t>::quiet_NaN();
+
+	if (x == std::numeric_limits<double_t>::infinity())
+		return x;
+
+	// x = m * 2^e with m in [sqrt(2) / 2, sqrt(2)], subnormal values being scaled up first
+	const bool_t subnormal = x < std::numeric_limits<double_t>::min();
+	const uint64_t bits = std::bit_cast<uint64_t>(subnormal ? x * 18446744073709551616. : x);
+	int64_t exponent = static_cast<int64_t>(bits >> 52) - (subnormal ? 1087 : 1023);
+	double_t m = std::bit_cast<double_t>((bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+	if (m > std::numbers::sqrt2)
+	{
+		m *= 0.5;
+		exponent++;
+	}
+
+	// log2(m) = 2 * atanh(t) / ln(2) with t = (m - 1) / (m + 1), the series of atanh converging quickly as |t| < 0.172
+	const double_t t = (m - 1.) / (m + 1.);
+	const double_t t2 = t * t;
+	double_t series = 0.;
+	for (int32_t i = 23; i > 0; i -= 2)
+		series = series * t2 + 1. / static_cast<double_t>(i);
+	return static_cast<double_t>(exponent) + 2. * std::numbers::log2e * t * series;
+}
+
+constexpr float_t Calc::Pow(const float_t base, const float_t exponent) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return MATH_CHECK_DENORMALS(std::pow(base, exponent), base, exponent);
+
+	return static_cast<float_t>(Pow(static_cast<double_t>(base), static_cast<double_t>(exponent)));
+}
+
+constexpr double_t Calc::Pow(const double_t base, const double_t exponent) noexcept
+{
+	if (!std::is_constant_evaluated())
+		return MATH_CHECK_DENORMALS(std::pow(base, exponent), base, exponent);
+
+	if (exponent == 0. || base == 1.)
+		return 1.;
+
+	// NaNs are the only values that aren't equal to themselves
+	if (base != base || exponent != exponent)
+		return std::numeric_limits<double_t>::quiet_NaN();
+
+	// -1 raised to an infinite power is 1, which Log2(1) * inf would otherwise make a NaN
+	if (Abs(base) == 1. && Abs(exponent) == std::numeric_limits<double_t>::infinity())
+		return 1.;
+
+	// Odd integer exponents keep the sign of the base, doubles above 2^53 and infinities being even
+	const bool_t large = Abs(exponent) >= 9007199254740992.;
+	const bool_t integer = large || static_cast<double_t>(static_cast<int64_t>(exponent)) == exponent;
+	const bool_t odd = !large && integer && (static_cast<int64_t>(exponent) & 1);
+
+	if (base == 0.)
+	{
+		if (exponent > 0.)
+			return odd ? base : 0.;
+		return odd && std::bit_cast<int64_t>(base) < 0 ? -std::numeric_limits<double_t>::infinity() : std::numeric_limits<double_t>::infinity();
+	}
+
+	const double_t result = Exp2(exponent * Log2(Abs(base)));
+	if (base > 0.)
+		return result;
+
+	// Negative bases only have real powers for integer exponents
+	if (!integer)
+		return std::numeric_limits<double_t>::quiet_NaN();
+
+	return odd ? -result : result;
+}
+
+constexpr float_t Calc::FastRsqrt(const float_t x) noexcept
+{
+#ifdef MATH_SIMD_SSE
+	if (!std::is_constant_evaluated())
+		return _mm_cvtss_f32(Simd::Rsqrt(_mm_set_ss(x)));
+#endif
+
+	// Bit-level initial guess refined with two Newton-Raphson steps
+	float_t result = std::bit_cast<float_t>(0x5F375A86u - (std::bit_cast<uint32_t>(x) >> 1));
+	result *= 1.5f - 0.5f * x * SQ(result);
+	result *= 1.5f - 0.5f * x * SQ(result);
+	return result;
+}
+
+constexpr void Calc::FastSinCos(const float_t angle, float_t* const sin, float_t* const cos) noexcept
+{
+	// Reduces the angle to [-Pi, Pi], 2 * Pi being split in two constants to keep the precision of the subtraction.
+	// Everything is kept branchless so that loops calling this can be vectorized.
+	const float_t turns = angle * (1.f / TwoPi);
+	const float_t quotient = static_cast<float_t>(static_cast<int32_t>(turns + (turns < 0.f ? -0.5f : 0.5f)));
+	float_t x = angle - quotient * 6.28125f - quotient * 1.9353071795864769e-3f;
+
+	// Then to [-Pi / 2, Pi / 2] using sin(Pi - x) = sin(x) and cos(Pi - x) = -cos(x)
+	const bool_t reflected = Abs(x) > PiOver2;
+	x = reflected ? (x < 0.f ? -Pi : Pi) - x : x;
+	const float_t cosSign = reflected ? -1.f : 1.f;
+
+	// Taylor series
+	const float_t x2 = x * x;
+	*sin = x * (1.f + x2 * (-1.6666667e-1f + x2 * (8.3333333e-3f + x2 * (-1.9841270e-4f + x2 * 2.7557319e-6f))));
+	*cos = cosSign * (1.f + x2 * (-0.5f + x2 * (4.1666667e-2f + x2 * (-1.3888889e-3f + x2 * (2.4801587e-5f + x2 * -2.7557319e-7f)))));
+}
+
+constexpr float_t Calc::FastSin(const float_t angle) noexcept
+{
+	float_t sin, cos;
+	FastSinCos(angle, &sin, &cos);
+	return sin;
+}
+
+constexpr float_t Calc::FastCos(const float_t angle) noexcept
+{
+	float_t sin, cos;
+	FastSinCos(angle, &sin, &cos);
+	return cos;
+}
+
+constexpr float_t Calc::FastAcos(const float_t x) noexcept
+{
+	// Abramowitz and Stegun, formula 4.4.45, using acos(-x) = Pi - acos(x)
+	const float_t absX = Abs(x);
+	const float_t polynomial = 1.5707288f + absX * (-0.2121144f + absX * (0.0742610f + absX * -0.0187293f));
+	const float_t oneMinusX = 1.f - absX;
+	const float_t result = oneMinusX > 0.f ? oneMinusX * FastRsqrt(oneMinusX) * polynomial : 0.f;
+	return x < 0.f ? Pi - result : result;
+}
+
+constexpr float_t Calc::FastExp2(float_t x) noexcept
+{
+	x = Clamp(x, -126.f, 127.f);
+
+	// 2^x = 2^n * 2^f, with n an integer and f in [-0.5, 0.5]
+	const int32_t n = static_cast<int32_t>(x < 0.f ? x - 0.5f : x + 0.5f);
+	const float_t f = x - static_cast<float_t>(n);
+
+	// Taylor series of e^(f * ln(2))
+	const float_t fraction = 1.f + f * (6.9314718e-1f + f * (2.4022651e-1f + f * (5.5504109e-2f + f * (9.6181291e-3f + f * (1.3333558e-3f + f * 1.5403530e-4f)))));
+	return fraction * std::bit_cast<float_t>(static_cast<uint32_t>(n + 127) << 23);
+}
+
 // Undef windows macro to be able to use std::min without conflicts
 #undef min
 
@@ -497,7 +1273,7 @@ constexpr void Calc::Approach(float_t &value, const float_t target, const float_
 	if (!Equals(value, target))
 	{
 		const float_t difference = target - value;
-		value += std::min(step, Abs(difference)) * Sign(difference);
+		value = MATH_CHECK_DENORMALS(value + std::min(step, Abs(difference)) * Sign(difference), value, target, step);
 	}
 }
 
@@ -548,9 +1324,35 @@ constexpr bool_t Calc::Equals(const Vector2 a, const Vector2 b) noexcept { retur
 
 constexpr bool_t Calc::Equals(const Vector3& a, const Vector3& b) noexcept { return Equals(a.x, b.x) && Equals(a.y, b.y) && Equals(a.z, b.z); }
 
+constexpr bool_t Calc::Equals(const Vector3A& a, const Vector3A& b) noexcept { return Equals(a.x, b.x) && Equals(a.y, b.y) && Equals(a.z, b.z); }
+
 constexpr bool_t Calc::Equals(const Vector4& a, const Vector4& b) noexcept { return Equals(a.x, b.x) && Equals(a.y, b.y) && Equals(a.z, b.z) && Equals(a.w, b.w); }
 
-constexpr float_t Calc::Lerp(const float_t value, const float_t target, const float_t time) { return value + (target - value) * time; }
+template <size_t N, typename T>
+constexpr bool_t Calc::Equals(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+	if constexpr (std::integral<T>)
+	{
+		return a == b;
+	}
+	else
+	{
+		const std::array<T, N> lhs = GetVectorComponents(a);
+		const std::array<T, N> rhs = GetVectorComponents(b);
+		for (size_t i = 0; i < N; i++)
+		{
+			if (Abs(lhs[i] - rhs[i]) > static_cast<T>(Zero))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+constexpr float_t Calc::Lerp(const float_t value, const float_t target, const float_t time)
+{
+	return MATH_CHECK_DENORMALS(value + (target - value) * time, value, target, time);
+}
 
 constexpr float_t Calc::Lerp(const float_t value, const float_t target, const float_t time, const Easing::Easer easer)
 {
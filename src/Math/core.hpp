@@ -2,28 +2,123 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 
 /// @file core.hpp
 /// @brief File containing various macros used in the library.
 ///
 /// When <b>NOT</b> building a DLL using this library, define @c MATH_NO_DLL.
 /// When building a DLL, instead define @c MATH_EXPORT.
+/// To use this library without building it, define @c MATH_HEADER_ONLY and include @c math.hpp.
 
 //#define MATH_NO_DLL
 //#define MATH_EXPORT
+//#define MATH_HEADER_ONLY
 
 /// @brief Macro preceding all declarations of this library. Used when integrating this library in a DLL.
 ///
 /// When <b>NOT</b> building a DLL using this library, define @c MATH_NO_DLL.
 /// When building a DLL, instead define @c MATH_EXPORT.
-#ifndef MATH_NO_DLL
+/// Outside of Windows, this gives the declarations the default visibility instead.
+#if defined(MATH_NO_DLL) || defined(MATH_HEADER_ONLY)
+    #define MATH_TOOLBOX
+#elif defined(_WIN32)
     #ifdef MATH_EXPORT
         #define MATH_TOOLBOX __declspec(dllexport)
     #else
         #define MATH_TOOLBOX __declspec(dllimport)
     #endif
 #else
-    #define MATH_TOOLBOX
+    #define MATH_TOOLBOX [[gnu::visibility("default")]]
+#endif
+
+/// @brief Macro preceding the definitions of the source files of this library.
+///
+/// When @c MATH_HEADER_ONLY is defined, @c math.hpp includes those source files and this expands to @c inline,
+/// so that every function can be inlined at its call sites.
+#ifdef MATH_HEADER_ONLY
+    #define MATH_INLINE inline
+#else
+    #define MATH_INLINE
+#endif
+
+/// @brief Forces a function to be inlined, where supported.
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define MATH_FORCE_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+    #define MATH_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define MATH_FORCE_INLINE inline
+#endif
+
+/// @brief Tells the compiler that @p condition is always true, so that it can optimize accordingly.
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define MATH_ASSUME(condition) __assume(condition)
+#elif defined(__clang__)
+    #define MATH_ASSUME(condition) __builtin_assume(condition)
+#elif defined(__GNUC__)
+    #define MATH_ASSUME(condition) do { if (!(condition)) __builtin_unreachable(); } while (false)
+#else
+    #define MATH_ASSUME(condition) ((void) 0)
+#endif
+
+/// @brief Defined when the library is compiled without exceptions, e.g. with @c -fno-exceptions or without @c /EHsc.
+///
+/// It can also be defined manually. In this mode, the functions that would throw an exception call @c std::abort instead,
+/// so use their @c Try variants, like Matrix::TryInverted, or the @c UncheckedAt accessors where the input isn't known to be valid.
+#if !defined(MATH_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+    #define MATH_NO_EXCEPTIONS
+#endif
+
+/// @brief Throws @p exception, or calls @c std::abort when @c MATH_NO_EXCEPTIONS is defined.
+#ifdef MATH_NO_EXCEPTIONS
+    #define MATH_THROW(exception) std::abort()
+#else
+    #define MATH_THROW(exception) throw exception
+#endif
+
+/// @brief Defined when SSE intrinsics are available and used by the library.
+///
+/// Define @c MATH_NO_SIMD to force every function to use its scalar implementation.
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__))
+    #define MATH_SIMD_SSE
+#endif
+
+/// @brief Defined when AVX intrinsics are available and used by the library, e.g. when compiling with @c /arch:AVX or above.
+#if defined(MATH_SIMD_SSE) && defined(__AVX__)
+    #define MATH_SIMD_AVX
+#endif
+
+/// @brief Defined when fused multiply-add instructions are available and used by the library.
+///
+/// MSVC doesn't define @c __FMA__, but @c /arch:AVX2 implies FMA3 support.
+#if defined(MATH_SIMD_AVX) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+    #define MATH_SIMD_FMA
+#endif
+
+/// @brief Allows a function to use the instructions of @p isa regardless of the compilation flags, e.g. @c MATH_TARGET("avx2,fma").
+///
+/// Only such functions may use those instructions, and they must only be called after checking that the CPU supports them.
+/// MSVC allows any intrinsic to be used in any function, so this expands to nothing there.
+#if defined(__GNUC__) || defined(__clang__)
+    #define MATH_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define MATH_TARGET(isa)
+#endif
+
+/// @brief Define @c MATH_SIMD_ALIGN to make Vector4, Quaternion and Matrix 16-byte aligned, their operations then running on SIMD registers.
+///
+/// This changes the alignment of those types, so it must be defined the same way when building the library and the code using it.
+/// It has no effect when @c MATH_SIMD_SSE isn't defined.
+#if defined(MATH_SIMD_ALIGN) && !defined(MATH_SIMD_SSE)
+    #undef MATH_SIMD_ALIGN
+#endif
+
+/// @brief Macro placed in the declaration of the types stored in SIMD registers when @c MATH_SIMD_ALIGN is defined.
+#ifdef MATH_SIMD_ALIGN
+    #define MATH_SIMD_ALIGNAS alignas(16)
+#else
+    #define MATH_SIMD_ALIGNAS
 #endif
 
 // ReSharper disable once CppEnforceTypeAliasCodeStyle
@@ -0,0 +1,94 @@
+#include "Math/denormals.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#ifdef MATH_SIMD_SSE
+#include <immintrin.h>
+#endif
+
+/// @private
+namespace Calc::Internal
+{
+#ifdef MATH_SIMD_SSE
+    /// @brief The flush-to-zero (bit 15) and denormals-are-zero (bit 6) bits of the MXCSR register.
+    constexpr uint32_t FlushDenormalsBits = 0x8040;
+#endif
+
+    /// @brief The head of the list of all the DenormalCounter, which are never destroyed before the end of the program.
+    MATH_INLINE std::atomic<DenormalCounter*>& DenormalCounters() noexcept
+    {
+        static std::atomic<DenormalCounter*> head = nullptr;
+        return head;
+    }
+}
+
+MATH_INLINE Calc::FlushDenormalsScope::FlushDenormalsScope() noexcept
+{
+#ifdef MATH_SIMD_SSE
+    m_PreviousState = _mm_getcsr();
+    _mm_setcsr(m_PreviousState | Internal::FlushDenormalsBits);
+#endif
+}
+
+MATH_INLINE Calc::FlushDenormalsScope::~FlushDenormalsScope() noexcept
+{
+#ifdef MATH_SIMD_SSE
+    // Only restores the denormal bits, in case the rounding mode or the exception masks changed in the meantime
+    _mm_setcsr((_mm_getcsr() & ~Internal::FlushDenormalsBits) | (m_PreviousState & Internal::FlushDenormalsBits));
+#endif
+}
+
+MATH_INLINE bool_t Calc::AreDenormalsFlushed() noexcept
+{
+#ifdef MATH_SIMD_SSE
+    return (_mm_getcsr() & Internal::FlushDenormalsBits) == Internal::FlushDenormalsBits;
+#else
+    return false;
+#endif
+}
+
+MATH_INLINE std::vector<Calc::DenormalCount> Calc::GetDenormalCounts()
+{
+    // A function can have several counters, e.g. one per template instantiation, so they are merged by name
+    std::vector<DenormalCount> counts;
+    for (const Internal::DenormalCounter* counter = Internal::DenormalCounters().load(std::memory_order_acquire); counter != nullptr; counter = counter->next)
+    {
+        const uint64_t calls = counter->calls.load(std::memory_order_relaxed);
+        if (calls == 0)
+            continue;
+
+        const auto sameFunction = [counter](const DenormalCount& count) { return std::string_view(count.function) == counter->function; };
+        auto it = std::ranges::find_if(counts, sameFunction);
+        if (it == counts.end())
+        {
+            counts.push_back({ counter->function, 0, 0, 0 });
+            it = counts.end() - 1;
+        }
+
+        it->calls += calls;
+        it->inputs += counter->inputs.load(std::memory_order_relaxed);
+        it->outputs += counter->outputs.load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+MATH_INLINE void Calc::ResetDenormalCounts() noexcept
+{
+    for (Internal::DenormalCounter* counter = Internal::DenormalCounters().load(std::memory_order_acquire); counter != nullptr; counter = counter->next)
+    {
+        counter->calls.store(0, std::memory_order_relaxed);
+        counter->inputs.store(0, std::memory_order_relaxed);
+        counter->outputs.store(0, std::memory_order_relaxed);
+    }
+}
+
+MATH_INLINE Calc::Internal::DenormalCounter::DenormalCounter(const char_t* const function) noexcept
+    : function(function)
+{
+    std::atomic<DenormalCounter*>& head = DenormalCounters();
+    // On failure, next is updated to the new head and the exchange is tried again
+    next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed))
+        ;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <source_location>
+#include <type_traits>
+#include <vector>
+
+#include "Math/core.hpp"
+
+/// @file denormals.hpp
+/// @brief Defines the control of the denormal floating-point values, and their counters.
+///
+/// Operations on denormal values, i.e. values smaller than @c std::numeric_limits<T>::min() but not zero, can be up to 100 times slower on some CPUs.
+/// They typically come from values decaying toward zero, like the exponential easing functions or long-running Calc::Approach loops.
+///
+/// Define @c MATH_COUNT_DENORMALS when building the library to count the denormal inputs and outputs of its functions,
+/// which can then be retrieved using Calc::GetDenormalCounts to find where they come from.
+/// This slows the library down, so it is meant to be used for profiling only.
+
+namespace Calc
+{
+    /// @brief Returns whether @p value is a denormal value, i.e. neither zero nor a normal value.
+    ///
+    /// This compares the bits of @p value, so that it also detects denormals while they are treated as zero, see FlushDenormalsScope.
+    ///
+    /// @param value The floating-point value to check.
+    /// @returns @c true if @p value is denormal, @c false otherwise.
+    template <std::floating_point T>
+    [[nodiscard]]
+    MATH_TOOLBOX constexpr bool_t IsDenormal(T value) noexcept;
+
+    /// @brief Makes the current thread flush the denormal values to zero while it exists, and restores the previous mode when destroyed.
+    ///
+    /// On x64, this sets both the flush-to-zero (FTZ) and the denormals-are-zero (DAZ) bits of the MXCSR register:
+    /// denormal results of SSE and AVX instructions are replaced by zero, and denormal inputs are treated as zero.
+    /// This only affects the current thread. Without SSE, this does nothing.
+    ///
+    /// @code
+    /// {
+    ///     Calc::FlushDenormalsScope flushDenormals;
+    ///     UpdateAnimations();
+    /// }
+    /// @endcode
+    class MATH_TOOLBOX FlushDenormalsScope
+    {
+    public:
+        /// @brief Enables the flush-to-zero and denormals-are-zero modes for the current thread.
+        FlushDenormalsScope() noexcept;
+
+        FlushDenormalsScope(const FlushDenormalsScope&) = delete;
+        FlushDenormalsScope(FlushDenormalsScope&&) = delete;
+
+        /// @brief Restores the modes that were in use when this FlushDenormalsScope was created.
+        ~FlushDenormalsScope() noexcept;
+
+        FlushDenormalsScope& operator=(const FlushDenormalsScope&) = delete;
+        FlushDenormalsScope& operator=(FlushDenormalsScope&&) = delete;
+
+    private:
+        uint32_t m_PreviousState = 0;
+    };
+
+    /// @brief Returns whether the denormal values are currently flushed to zero on this thread, e.g. by a FlushDenormalsScope.
+    [[nodiscard]]
+    MATH_TOOLBOX bool_t AreDenormalsFlushed() noexcept;
+
+    /// @brief The number of denormal values counted for a library function when @c MATH_COUNT_DENORMALS is defined.
+    struct DenormalCount
+    {
+        /// @brief The signature of the function.
+        const char_t* function;
+        /// @brief The number of calls to the function.
+        uint64_t calls;
+        /// @brief The number of denormal arguments the function was called with.
+        uint64_t inputs;
+        /// @brief The number of denormal values the function returned.
+        uint64_t outputs;
+    };
+
+    /// @brief Returns the denormal counts of all the functions called since the last call to ResetDenormalCounts.
+    ///
+    /// This is always empty when @c MATH_COUNT_DENORMALS isn't defined.
+    [[nodiscard]]
+    MATH_TOOLBOX std::vector<DenormalCount> GetDenormalCounts();
+
+    /// @brief Resets all the denormal counts to zero.
+    MATH_TOOLBOX void ResetDenormalCounts() noexcept;
+
+    /// @private
+    namespace Internal
+    {
+        /// @brief The counts of a single function, registered on construction in a global list.
+        class MATH_TOOLBOX DenormalCounter
+        {
+        public:
+            explicit DenormalCounter(const char_t* function) noexcept;
+
+            DenormalCounter(const DenormalCounter&) = delete;
+            DenormalCounter& operator=(const DenormalCounter&) = delete;
+
+            /// @brief Counts a call to the function, returning @p output.
+            template <std::floating_point T, std::floating_point... Args>
+            T Count(T output, Args... arguments) noexcept;
+
+            const char_t* function;
+            std::atomic<uint64_t> calls = 0;
+            std::atomic<uint64_t> inputs = 0;
+            std::atomic<uint64_t> outputs = 0;
+            DenormalCounter* next = nullptr;
+        };
+    }
+}
+
+/// @brief Returns @p result, counting it and the following arguments with the denormal counters of the calling function.
+///
+/// This expands to @p result alone when @c MATH_COUNT_DENORMALS isn't defined, or in constant expressions.
+#ifdef MATH_COUNT_DENORMALS
+    #define MATH_CHECK_DENORMALS(result, ...) \
+        (std::is_constant_evaluated() ? (result) : [](const char_t* const function, const auto output, const auto... inputs) \
+        { \
+            static ::Calc::Internal::DenormalCounter counter(function); \
+            return counter.Count(output, inputs...); \
+        }(std::source_location::current().function_name(), result, __VA_ARGS__))
+#else
+    #define MATH_CHECK_DENORMALS(result, ...) (result)
+#endif
+
+template <std::floating_point T>
+constexpr bool_t Calc::IsDenormal(const T value) noexcept
+{
+    // The absolute value minus one wraps around for zero, and is greater than the largest denormal for normal values, infinities and NaNs
+    if constexpr (std::is_same_v<T, float_t>)
+        return (std::bit_cast<uint32_t>(value) & 0x7FFFFFFFu) - 1u < 0x007FFFFFu;
+    else if constexpr (std::is_same_v<T, double_t>)
+        return (std::bit_cast<uint64_t>(value) & 0x7FFFFFFFFFFFFFFFull) - 1ull < 0x000FFFFFFFFFFFFFull;
+    else
+        return value != 0 && (value < 0 ? -value : value) < std::numeric_limits<T>::min();
+}
+
+template <std::floating_point T, std::floating_point... Args>
+T Calc::Internal::DenormalCounter::Count(const T output, Args... arguments) noexcept
+{
+    calls.fetch_add(1, std::memory_order_relaxed);
+
+    const uint64_t denormalInputs = (static_cast<uint64_t>(IsDenormal(arguments)) + ... + 0);
+    if (denormalInputs != 0)
+        inputs.fetch_add(denormalInputs, std::memory_order_relaxed);
+
+    if (IsDenormal(output))
+        outputs.fetch_add(1, std::memory_order_relaxed);
+
+    return output;
+}
@@ -0,0 +1,1270 @@
+#include "Math/dispatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+#include "Math/calc.hpp"
+#include "Math/simd.hpp"
+
+#ifdef MATH_SIMD_SSE
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/// @private
+namespace Dispatch::Internal
+{
+    /// @brief The rounding performed by the RoundValues kernels. @c Down and @c Up match the @c _MM_FROUND_TO_NEG_INF and @c _MM_FROUND_TO_POS_INF modes.
+    enum class Rounding : int32_t
+    {
+        HalfAwayFromZero = -1,
+        Down = 1,
+        Up = 2
+    };
+
+    /// @brief The transformation performed by the TransformVectors3 kernels.
+    enum class Transform : uint8_t
+    {
+        Point,
+        Direction,
+        ProjectivePoint
+    };
+
+    namespace Scalar
+    {
+        MATH_INLINE void MultiplyMatrices(const float_t* lhs, const float_t* rhs, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, lhs += 16, rhs += 16, result += 16)
+            {
+                float_t product[16];
+                for (size_t column = 0; column < 4; column++)
+                {
+                    for (size_t row = 0; row < 4; row++)
+                    {
+                        product[column * 4 + row] = lhs[row] * rhs[column * 4]
+                            + lhs[4 + row] * rhs[column * 4 + 1]
+                            + lhs[8 + row] * rhs[column * 4 + 2]
+                            + lhs[12 + row] * rhs[column * 4 + 3];
+                    }
+                }
+                std::copy_n(product, 16, result);
+            }
+        }
+
+        MATH_INLINE void MultiplyMatricesByMatrix(const float_t* matrices, const float_t* matrix, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+                MultiplyMatrices(matrices, matrix, result, 1);
+        }
+
+        MATH_INLINE bool_t InvertMatrices(const float_t* m, float_t* result, const size_t count) noexcept
+        {
+            // Cofactor expansion using the 2x2 determinants of the first two and last two columns.
+            // The inverse of the transpose is the transpose of the inverse, so the storage order doesn't matter here.
+            bool_t invertible = true;
+            for (size_t i = 0; i < count; i++, m += 16, result += 16)
+            {
+                const float_t s0 = m[0] * m[5] - m[4] * m[1];
+                const float_t s1 = m[0] * m[6] - m[4] * m[2];
+                const float_t s2 = m[0] * m[7] - m[4] * m[3];
+                const float_t s3 = m[1] * m[6] - m[5] * m[2];
+                const float_t s4 = m[1] * m[7] - m[5] * m[3];
+                const float_t s5 = m[2] * m[7] - m[6] * m[3];
+
+                const float_t c0 = m[8] * m[13] - m[12] * m[9];
+                const float_t c1 = m[8] * m[14] - m[12] * m[10];
+                const float_t c2 = m[8] * m[15] - m[12] * m[11];
+                const float_t c3 = m[9] * m[14] - m[13] * m[10];
+                const float_t c4 = m[9] * m[15] - m[13] * m[11];
+                const float_t c5 = m[10] * m[15] - m[14] * m[11];
+
+                const float_t determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+                if (determinant == 0.f) [[unlikely]]
+                {
+                    invertible = false;
+                    continue;
+                }
+
+                const float_t invDeterminant = 1.f / determinant;
+                const float_t inverse[16] = {
+                    (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDeterminant,
+                    (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDeterminant,
+                    (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDeterminant,
+                    (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDeterminant,
+
+                    (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDeterminant,
+                    (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDeterminant,
+                    (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDeterminant,
+                    (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDeterminant,
+
+                    (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDeterminant,
+                    (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDeterminant,
+                    (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDeterminant,
+                    (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDeterminant,
+
+                    (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDeterminant,
+                    (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDeterminant,
+                    (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDeterminant,
+                    (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDeterminant
+                };
+                std::copy_n(inverse, 16, result);
+            }
+            return invertible;
+        }
+
+        MATH_INLINE void InvertRigidMatrices(const float_t* m, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, m += 16, result += 16)
+            {
+                const float_t inverse[16] = {
+                    m[0], m[4], m[8], 0.f,
+                    m[1], m[5], m[9], 0.f,
+                    m[2], m[6], m[10], 0.f,
+                    -(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]),
+                    -(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]),
+                    -(m[8] * m[12] + m[9] * m[13] + m[10] * m[14]),
+                    1.f
+                };
+                std::copy_n(inverse, 16, result);
+            }
+        }
+
+        MATH_INLINE void TransformVectors4(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, vectors += 4, result += 4)
+            {
+                const float_t x = vectors[0], y = vectors[1], z = vectors[2], w = vectors[3];
+                for (size_t row = 0; row < 4; row++)
+                    result[row] = matrix[row] * x + matrix[4 + row] * y + matrix[8 + row] * z + matrix[12 + row] * w;
+            }
+        }
+
+        template <Transform Mode>
+        MATH_INLINE void TransformVectors3(const float_t* m, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, vectors += 3, result += 3)
+            {
+                // Reads the whole vector first, result being allowed to be the same as vectors
+                const float_t x = vectors[0], y = vectors[1], z = vectors[2];
+
+                float_t transformed[3];
+                for (size_t row = 0; row < 3; row++)
+                {
+                    transformed[row] = m[row] * x + m[4 + row] * y + m[8 + row] * z;
+                    if constexpr (Mode != Transform::Direction)
+                        transformed[row] += m[12 + row];
+                }
+
+                if constexpr (Mode == Transform::ProjectivePoint)
+                {
+                    const float_t invW = 1.f / (m[3] * x + m[7] * y + m[11] * z + m[15]);
+                    for (float_t& component : transformed)
+                        component *= invW;
+                }
+
+                std::copy_n(transformed, 3, result);
+            }
+        }
+
+        template <size_t Rows, bool_t Inverted>
+        MATH_INLINE void ComposeTrs(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, translations += 3, rotations += 4, scales += 3, result += Rows * 4)
+            {
+                // The conjugate of the rotation gives the transposed rotation matrix
+                const float_t x = rotations[0], y = rotations[1], z = rotations[2], w = Inverted ? -rotations[3] : rotations[3];
+
+                const float_t xx = x * x, yy = y * y, zz = z * z;
+                const float_t xy = x * y, wz = z * w, xz = z * x, wy = y * w, yz = y * z, wx = x * w;
+
+                const float_t rotation[3][3] = {
+                    { 1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy) },
+                    { 2.f * (xy - wz), 1.f - 2.f * (zz + xx), 2.f * (yz + wx) },
+                    { 2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (yy + xx) }
+                };
+
+                // The scaling applies to the columns of the rotation, or to the rows of the inverted one
+                float_t factors[3];
+                for (size_t k = 0; k < 3; k++)
+                    factors[k] = Inverted ? 1.f / scales[k] : scales[k];
+
+                for (size_t column = 0; column < 3; column++)
+                {
+                    for (size_t row = 0; row < 3; row++)
+                        result[column * Rows + row] = rotation[column][row] * factors[Inverted ? row : column];
+                    if constexpr (Rows == 4)
+                        result[column * 4 + 3] = 0.f;
+                }
+
+                for (size_t row = 0; row < 3; row++)
+                {
+                    if constexpr (Inverted)
+                        result[3 * Rows + row] = -(result[row] * translations[0] + result[Rows + row] * translations[1] + result[2 * Rows + row] * translations[2]);
+                    else
+                        result[3 * Rows + row] = translations[row];
+                }
+                if constexpr (Rows == 4)
+                    result[15] = 1.f;
+            }
+        }
+
+        template <size_t Components>
+        MATH_INLINE void NormalizeVectors(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, vectors += Components, result += Components)
+            {
+                float_t squaredLength = 0.f;
+                for (size_t j = 0; j < Components; j++)
+                    squaredLength += SQ(vectors[j]);
+
+                const float_t length = std::sqrt(squaredLength);
+                if (Calc::IsZero(length))
+                {
+                    std::fill_n(result, Components, 0.f);
+                    continue;
+                }
+
+                const float_t invLength = 1.f / length;
+                for (size_t j = 0; j < Components; j++)
+                    result[j] = vectors[j] * invLength;
+            }
+        }
+
+        template <Rounding Mode>
+        MATH_INLINE void RoundValues(const float_t* values, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if constexpr (Mode == Rounding::Down)
+                    result[i] = std::floor(values[i]);
+                else if constexpr (Mode == Rounding::Up)
+                    result[i] = std::ceil(values[i]);
+                else
+                    result[i] = std::round(values[i]);
+            }
+        }
+
+        MATH_INLINE constexpr Kernels Table = {
+            InstructionSet::Scalar,
+            MultiplyMatrices,
+            MultiplyMatricesByMatrix,
+            InvertMatrices,
+            InvertRigidMatrices,
+            TransformVectors4,
+            TransformVectors3<Transform::Point>,
+            TransformVectors3<Transform::Direction>,
+            TransformVectors3<Transform::ProjectivePoint>,
+            ComposeTrs<4, false>,
+            ComposeTrs<3, false>,
+            ComposeTrs<4, true>,
+            NormalizeVectors<2>,
+            NormalizeVectors<3>,
+            NormalizeVectors<4>,
+            RoundValues<Rounding::HalfAwayFromZero>,
+            RoundValues<Rounding::Down>,
+            RoundValues<Rounding::Up>
+        };
+    }
+
+#ifdef MATH_SIMD_SSE
+    namespace Sse41
+    {
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void MultiplyMatrices(const float_t* lhs, const float_t* rhs, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, lhs += 16, rhs += 16, result += 16)
+                Simd::MultiplyMatrix4(lhs, rhs, result);
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void MultiplyMatricesByMatrix(const float_t* matrices, const float_t* matrix, float_t* result, const size_t count) noexcept
+        {
+            // Each column of the result combines the columns of matrices[i] by the components of the same column of matrix
+            __m128 factors[16];
+            for (size_t j = 0; j < 16; j++)
+                factors[j] = _mm_set1_ps(matrix[j]);
+
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+            {
+                const __m128 c0 = _mm_loadu_ps(matrices);
+                const __m128 c1 = _mm_loadu_ps(matrices + 4);
+                const __m128 c2 = _mm_loadu_ps(matrices + 8);
+                const __m128 c3 = _mm_loadu_ps(matrices + 12);
+
+                __m128 product[4];
+                for (size_t column = 0; column < 4; column++)
+                {
+                    const __m128* f = factors + column * 4;
+                    product[column] = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(c0, f[0]), _mm_mul_ps(c1, f[1])),
+                        _mm_add_ps(_mm_mul_ps(c2, f[2]), _mm_mul_ps(c3, f[3]))
+                    );
+                }
+
+                for (size_t column = 0; column < 4; column++)
+                    _mm_storeu_ps(result + column * 4, product[column]);
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        bool_t InvertMatrices(const float_t* matrices, float_t* result, const size_t count) noexcept
+        {
+            bool_t invertible = true;
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+                invertible &= Simd::InvertMatrix4(matrices, result);
+            return invertible;
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void InvertRigidMatrices(const float_t* matrices, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+                Simd::InvertRigidMatrix4(matrices, result);
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void TransformVectors4(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            const __m128 c0 = _mm_loadu_ps(matrix);
+            const __m128 c1 = _mm_loadu_ps(matrix + 4);
+            const __m128 c2 = _mm_loadu_ps(matrix + 8);
+            const __m128 c3 = _mm_loadu_ps(matrix + 12);
+
+            for (size_t i = 0; i < count; i++, vectors += 4, result += 4)
+                _mm_storeu_ps(result, Simd::LinearCombination(_mm_loadu_ps(vectors), c0, c1, c2, c3));
+        }
+
+        template <Transform Mode>
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void TransformVectors3(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            const __m128 c0 = _mm_loadu_ps(matrix);
+            const __m128 c1 = _mm_loadu_ps(matrix + 4);
+            const __m128 c2 = _mm_loadu_ps(matrix + 8);
+            const __m128 c3 = _mm_loadu_ps(matrix + 12);
+
+            // Loads (x, y) and z separately to never read past the last vector
+            for (size_t i = 0; i < count; i++, vectors += 3, result += 3)
+            {
+                const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(vectors)));
+                const __m128 v = _mm_movelh_ps(xy, _mm_load_ss(vectors + 2));
+
+                __m128 transformed = Simd::LinearCombination3(v, c0, c1, c2);
+                if constexpr (Mode != Transform::Direction)
+                    transformed = _mm_add_ps(transformed, c3);
+                if constexpr (Mode == Transform::ProjectivePoint)
+                    transformed = _mm_div_ps(transformed, _mm_shuffle_ps(transformed, transformed, _MM_SHUFFLE(3, 3, 3, 3)));
+
+                _mm_store_sd(reinterpret_cast<double*>(result), _mm_castps_pd(transformed));
+                _mm_store_ss(result + 2, _mm_movehl_ps(transformed, transformed));
+            }
+        }
+
+        /// @brief Loads 4 packed 3-component vectors into one register per component.
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void LoadVectors3(const float_t* vectors, __m128* x, __m128* y, __m128* z) noexcept
+        {
+            const __m128 m0 = _mm_loadu_ps(vectors);
+            const __m128 m1 = _mm_loadu_ps(vectors + 4);
+            const __m128 m2 = _mm_loadu_ps(vectors + 8);
+
+            const __m128 xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));
+            const __m128 yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));
+            *x = _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+            *y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            *z = _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));
+        }
+
+        template <size_t Rows, bool_t Inverted>
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void ComposeTrs(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, const size_t count) noexcept
+        {
+            constexpr size_t Size = Rows * 4;
+
+            // Four objects at a time, with one register per component of the inputs and of the matrices
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4, translations += 12, rotations += 16, scales += 12, result += 4 * Size)
+            {
+                __m128 x = _mm_loadu_ps(rotations);
+                __m128 y = _mm_loadu_ps(rotations + 4);
+                __m128 z = _mm_loadu_ps(rotations + 8);
+                __m128 w = _mm_loadu_ps(rotations + 12);
+                _MM_TRANSPOSE4_PS(x, y, z, w);
+                if constexpr (Inverted)
+                    w = _mm_sub_ps(_mm_setzero_ps(), w);
+
+                __m128 t[3], factors[3];
+                LoadVectors3(translations, &t[0], &t[1], &t[2]);
+                LoadVectors3(scales, &factors[0], &factors[1], &factors[2]);
+
+                const __m128 one = _mm_set1_ps(1.f);
+                if constexpr (Inverted)
+                {
+                    for (__m128& factor : factors)
+                        factor = _mm_div_ps(one, factor);
+                }
+
+                const __m128 x2 = _mm_add_ps(x, x), y2 = _mm_add_ps(y, y), z2 = _mm_add_ps(z, z);
+                const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+                const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+                const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+                const __m128 rotation[3][3] = {
+                    { _mm_sub_ps(one, _mm_add_ps(yy, zz)), _mm_add_ps(xy, wz), _mm_sub_ps(xz, wy) },
+                    { _mm_sub_ps(xy, wz), _mm_sub_ps(one, _mm_add_ps(zz, xx)), _mm_add_ps(yz, wx) },
+                    { _mm_add_ps(xz, wy), _mm_sub_ps(yz, wx), _mm_sub_ps(one, _mm_add_ps(yy, xx)) }
+                };
+
+                __m128 columns[Size];
+                for (size_t column = 0; column < 3; column++)
+                {
+                    for (size_t row = 0; row < 3; row++)
+                        columns[column * Rows + row] = _mm_mul_ps(rotation[column][row], factors[Inverted ? row : column]);
+                }
+
+                for (size_t row = 0; row < 3; row++)
+                {
+                    if constexpr (Inverted)
+                    {
+                        const __m128 translated = _mm_add_ps(
+                            _mm_add_ps(_mm_mul_ps(columns[row], t[0]), _mm_mul_ps(columns[Rows + row], t[1])),
+                            _mm_mul_ps(columns[2 * Rows + row], t[2])
+                        );
+                        columns[3 * Rows + row] = _mm_sub_ps(_mm_setzero_ps(), translated);
+                    }
+                    else
+                    {
+                        columns[3 * Rows + row] = t[row];
+                    }
+                }
+
+                if constexpr (Rows == 4)
+                {
+                    columns[3] = columns[7] = columns[11] = _mm_setzero_ps();
+                    columns[15] = one;
+                }
+
+                // Each group of four components, transposed, gives them for each of the four objects
+                for (size_t j = 0; j < Size; j += 4)
+                {
+                    _MM_TRANSPOSE4_PS(columns[j], columns[j + 1], columns[j + 2], columns[j + 3]);
+                    for (size_t k = 0; k < 4; k++)
+                        _mm_storeu_ps(result + k * Size + j, columns[j + k]);
+                }
+            }
+
+            if (i < count)
+                Scalar::ComposeTrs<Rows, Inverted>(translations, rotations, scales, result, count - i);
+        }
+
+        /// @brief Returns the inverse of the square root of each of the 4 values of @p squaredLength, or zero where the square root is zero according to Calc::IsZero.
+        MATH_INLINE MATH_TARGET("sse4.1")
+        __m128 InverseLength(const __m128 squaredLength) noexcept
+        {
+            // Calc::IsZero(length) is false for NaN, so NaN lengths must keep their inverse
+            const __m128 mask = _mm_cmpnle_ps(squaredLength, _mm_set1_ps(SQ(Calc::Zero)));
+            return _mm_and_ps(Simd::Rsqrt(squaredLength), mask);
+        }
+
+        /// @brief Divides @p v by its length, @p DotMask selecting the components used to compute it.
+        template <int32_t DotMask>
+        MATH_INLINE MATH_TARGET("sse4.1")
+        __m128 Normalize(const __m128 v) noexcept
+        {
+            return _mm_mul_ps(v, InverseLength(_mm_dp_ps(v, v, DotMask)));
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void NormalizeVectors2(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Two vectors at a time, the squares of each one being added to their swapped counterparts
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2, vectors += 4, result += 4)
+            {
+                const __m128 v = _mm_loadu_ps(vectors);
+                const __m128 squares = _mm_mul_ps(v, v);
+                const __m128 squaredLength = _mm_add_ps(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 3, 0, 1)));
+                _mm_storeu_ps(result, _mm_mul_ps(v, InverseLength(squaredLength)));
+            }
+
+            if (i < count)
+            {
+                const __m128 v = Normalize<0x33>(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(vectors))));
+                _mm_store_sd(reinterpret_cast<double*>(result), _mm_castps_pd(v));
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void NormalizeVectors3(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Loads (x, y) and z separately to never read past the last vector
+            for (size_t i = 0; i < count; i++, vectors += 3, result += 3)
+            {
+                const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(vectors)));
+                const __m128 v = Normalize<0x7F>(_mm_movelh_ps(xy, _mm_load_ss(vectors + 2)));
+                _mm_store_sd(reinterpret_cast<double*>(result), _mm_castps_pd(v));
+                _mm_store_ss(result + 2, _mm_movehl_ps(v, v));
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void NormalizeVectors4(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, vectors += 4, result += 4)
+                _mm_storeu_ps(result, Normalize<0xFF>(_mm_loadu_ps(vectors)));
+        }
+
+        /// @brief Rounds the 4 values of @p v according to @p Mode.
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("sse4.1")
+        __m128 Round(const __m128 v) noexcept
+        {
+            if constexpr (Mode != Rounding::HalfAwayFromZero)
+                return _mm_round_ps(v, static_cast<int32_t>(Mode) | _MM_FROUND_NO_EXC);
+            else
+            {
+                // roundps rounds halfway cases to even, so this adds the sign of v to the truncated value when its fractional part is at least 0.5
+                const __m128 signMask = _mm_set1_ps(-0.f);
+                const __m128 truncated = _mm_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                const __m128 halfOrMore = _mm_cmpge_ps(_mm_andnot_ps(signMask, _mm_sub_ps(v, truncated)), _mm_set1_ps(0.5f));
+                return _mm_add_ps(truncated, _mm_or_ps(_mm_and_ps(halfOrMore, _mm_set1_ps(1.f)), _mm_and_ps(v, signMask)));
+            }
+        }
+
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("sse4.1")
+        void RoundValues(const float_t* values, float_t* result, const size_t count) noexcept
+        {
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+                _mm_storeu_ps(result + i, Round<Mode>(_mm_loadu_ps(values + i)));
+
+            for (; i < count; i++)
+                _mm_store_ss(result + i, Round<Mode>(_mm_load_ss(values + i)));
+        }
+
+        MATH_INLINE constexpr Kernels Table = {
+            InstructionSet::Sse41,
+            MultiplyMatrices,
+            MultiplyMatricesByMatrix,
+            InvertMatrices,
+            InvertRigidMatrices,
+            TransformVectors4,
+            TransformVectors3<Transform::Point>,
+            TransformVectors3<Transform::Direction>,
+            TransformVectors3<Transform::ProjectivePoint>,
+            ComposeTrs<4, false>,
+            ComposeTrs<3, false>,
+            ComposeTrs<4, true>,
+            NormalizeVectors2,
+            NormalizeVectors3,
+            NormalizeVectors4,
+            RoundValues<Rounding::HalfAwayFromZero>,
+            RoundValues<Rounding::Down>,
+            RoundValues<Rounding::Up>
+        };
+    }
+
+    namespace Avx2
+    {
+        /// @brief Same as Simd::LinearCombination(__m256, __m256, __m256, __m256, __m256), but always using FMA.
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        __m256 LinearCombination(const __m256 v, const __m256 c0, const __m256 c1, const __m256 c2, const __m256 c3) noexcept
+        {
+            __m256 result = _mm256_mul_ps(c0, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+            result = _mm256_fmadd_ps(c1, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+            result = _mm256_fmadd_ps(c2, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+            return _mm256_fmadd_ps(c3, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void MultiplyMatrices(const float_t* lhs, const float_t* rhs, float_t* result, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++, lhs += 16, rhs += 16, result += 16)
+            {
+                const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs));
+                const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+                const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+                const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+
+                const __m256 rhs01 = _mm256_loadu_ps(rhs);
+                const __m256 rhs23 = _mm256_loadu_ps(rhs + 8);
+
+                _mm256_storeu_ps(result, LinearCombination(rhs01, c0, c1, c2, c3));
+                _mm256_storeu_ps(result + 8, LinearCombination(rhs23, c0, c1, c2, c3));
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void MultiplyMatricesByMatrix(const float_t* matrices, const float_t* matrix, float_t* result, const size_t count) noexcept
+        {
+            // Two columns of the result per register, the first in the lower lane
+            __m256 factors01[4], factors23[4];
+            for (size_t k = 0; k < 4; k++)
+            {
+                factors01[k] = _mm256_set_m128(_mm_set1_ps(matrix[4 + k]), _mm_set1_ps(matrix[k]));
+                factors23[k] = _mm256_set_m128(_mm_set1_ps(matrix[12 + k]), _mm_set1_ps(matrix[8 + k]));
+            }
+
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+            {
+                const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrices));
+                const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrices + 4));
+                const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrices + 8));
+                const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrices + 12));
+
+                const __m256 product01 = _mm256_fmadd_ps(c3, factors01[3], _mm256_fmadd_ps(c2, factors01[2], _mm256_fmadd_ps(c1, factors01[1], _mm256_mul_ps(c0, factors01[0]))));
+                const __m256 product23 = _mm256_fmadd_ps(c3, factors23[3], _mm256_fmadd_ps(c2, factors23[2], _mm256_fmadd_ps(c1, factors23[1], _mm256_mul_ps(c0, factors23[0]))));
+
+                _mm256_storeu_ps(result, product01);
+                _mm256_storeu_ps(result + 8, product23);
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void TransformVectors4(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix));
+            const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 4));
+            const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 8));
+            const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 12));
+
+            // Two vectors at a time, one per 128-bit lane
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2, vectors += 8, result += 8)
+                _mm256_storeu_ps(result, LinearCombination(_mm256_loadu_ps(vectors), c0, c1, c2, c3));
+
+            if (i < count)
+                Sse41::TransformVectors4(matrix, vectors, result, count - i);
+        }
+
+        /// @brief Loads 8 packed 3-component vectors into one register per component.
+        ///
+        /// Reference: https://www.intel.com/content/dam/develop/external/us/en/documents/normvec-181650.pdf
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void LoadVectors3(const float_t* vectors, __m256* x, __m256* y, __m256* z) noexcept
+        {
+            __m256 m03 = _mm256_castps128_ps256(_mm_loadu_ps(vectors));
+            __m256 m14 = _mm256_castps128_ps256(_mm_loadu_ps(vectors + 4));
+            __m256 m25 = _mm256_castps128_ps256(_mm_loadu_ps(vectors + 8));
+            m03 = _mm256_insertf128_ps(m03, _mm_loadu_ps(vectors + 12), 1);
+            m14 = _mm256_insertf128_ps(m14, _mm_loadu_ps(vectors + 16), 1);
+            m25 = _mm256_insertf128_ps(m25, _mm_loadu_ps(vectors + 20), 1);
+
+            const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+            const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+            *x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+            *y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            *z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+        }
+
+        /// @brief Stores the 8 3-component vectors whose components are in @p x, @p y and @p z as packed vectors, reverting LoadVectors3.
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void StoreVectors3(const __m256 x, const __m256 y, const __m256 z, float_t* result) noexcept
+        {
+            const __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+            const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+            const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+            _mm_storeu_ps(result, _mm256_castps256_ps128(r03));
+            _mm_storeu_ps(result + 4, _mm256_castps256_ps128(r14));
+            _mm_storeu_ps(result + 8, _mm256_castps256_ps128(r25));
+            _mm_storeu_ps(result + 12, _mm256_extractf128_ps(r03, 1));
+            _mm_storeu_ps(result + 16, _mm256_extractf128_ps(r14, 1));
+            _mm_storeu_ps(result + 20, _mm256_extractf128_ps(r25, 1));
+        }
+
+        /// @brief Transposes the 4x4 matrices formed by the lower and the upper 128-bit lanes of @p r0 to @p r3.
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void Transpose4(__m256& r0, __m256& r1, __m256& r2, __m256& r3) noexcept
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+            const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+            const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+            r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        template <size_t Rows, bool_t Inverted>
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void ComposeTrs(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, const size_t count) noexcept
+        {
+            constexpr size_t Size = Rows * 4;
+
+            // Eight objects at a time, the upper lane of each register holding the objects 4 to 7
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8, translations += 24, rotations += 32, scales += 24, result += 8 * Size)
+            {
+                __m256 q[4];
+                for (size_t k = 0; k < 4; k++)
+                    q[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(rotations + k * 4)), _mm_loadu_ps(rotations + 16 + k * 4), 1);
+                Transpose4(q[0], q[1], q[2], q[3]);
+                const __m256 x = q[0], y = q[1], z = q[2];
+                const __m256 w = Inverted ? _mm256_sub_ps(_mm256_setzero_ps(), q[3]) : q[3];
+
+                __m256 t[3], factors[3];
+                LoadVectors3(translations, &t[0], &t[1], &t[2]);
+                LoadVectors3(scales, &factors[0], &factors[1], &factors[2]);
+
+                const __m256 one = _mm256_set1_ps(1.f);
+                if constexpr (Inverted)
+                {
+                    for (__m256& factor : factors)
+                        factor = _mm256_div_ps(one, factor);
+                }
+
+                const __m256 x2 = _mm256_add_ps(x, x), y2 = _mm256_add_ps(y, y), z2 = _mm256_add_ps(z, z);
+                const __m256 xx = _mm256_mul_ps(x, x2), yy = _mm256_mul_ps(y, y2), zz = _mm256_mul_ps(z, z2);
+                const __m256 xy = _mm256_mul_ps(x, y2), xz = _mm256_mul_ps(x, z2), yz = _mm256_mul_ps(y, z2);
+
+                // The products by w are fused with the additions and subtractions
+                const __m256 rotation[3][3] = {
+                    { _mm256_sub_ps(one, _mm256_add_ps(yy, zz)), _mm256_fmadd_ps(w, z2, xy), _mm256_fnmadd_ps(w, y2, xz) },
+                    { _mm256_fnmadd_ps(w, z2, xy), _mm256_sub_ps(one, _mm256_add_ps(zz, xx)), _mm256_fmadd_ps(w, x2, yz) },
+                    { _mm256_fmadd_ps(w, y2, xz), _mm256_fnmadd_ps(w, x2, yz), _mm256_sub_ps(one, _mm256_add_ps(yy, xx)) }
+                };
+
+                __m256 columns[Size];
+                for (size_t column = 0; column < 3; column++)
+                {
+                    for (size_t row = 0; row < 3; row++)
+                        columns[column * Rows + row] = _mm256_mul_ps(rotation[column][row], factors[Inverted ? row : column]);
+                }
+
+                for (size_t row = 0; row < 3; row++)
+                {
+                    if constexpr (Inverted)
+                    {
+                        const __m256 translated = _mm256_fmadd_ps(columns[row], t[0], _mm256_fmadd_ps(columns[Rows + row], t[1], _mm256_mul_ps(columns[2 * Rows + row], t[2])));
+                        columns[3 * Rows + row] = _mm256_sub_ps(_mm256_setzero_ps(), translated);
+                    }
+                    else
+                    {
+                        columns[3 * Rows + row] = t[row];
+                    }
+                }
+
+                if constexpr (Rows == 4)
+                {
+                    columns[3] = columns[7] = columns[11] = _mm256_setzero_ps();
+                    columns[15] = one;
+                }
+
+                for (size_t j = 0; j < Size; j += 4)
+                {
+                    Transpose4(columns[j], columns[j + 1], columns[j + 2], columns[j + 3]);
+                    for (size_t k = 0; k < 4; k++)
+                    {
+                        _mm_storeu_ps(result + k * Size + j, _mm256_castps256_ps128(columns[j + k]));
+                        _mm_storeu_ps(result + (k + 4) * Size + j, _mm256_extractf128_ps(columns[j + k], 1));
+                    }
+                }
+            }
+
+            if (i < count)
+                Sse41::ComposeTrs<Rows, Inverted>(translations, rotations, scales, result, count - i);
+        }
+
+        template <Transform Mode>
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void TransformVectors3(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Each row of the matrix is applied to the x, y and z registers of 8 vectors at once
+            __m256 m[16];
+            for (size_t j = 0; j < 16; j++)
+                m[j] = _mm256_set1_ps(matrix[j]);
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8, vectors += 24, result += 24)
+            {
+                __m256 x, y, z;
+                LoadVectors3(vectors, &x, &y, &z);
+
+                __m256 transformed[3];
+                for (size_t row = 0; row < 3; row++)
+                {
+                    const __m256 offset = Mode == Transform::Direction ? _mm256_setzero_ps() : m[12 + row];
+                    transformed[row] = _mm256_fmadd_ps(m[row], x, _mm256_fmadd_ps(m[4 + row], y, _mm256_fmadd_ps(m[8 + row], z, offset)));
+                }
+
+                if constexpr (Mode == Transform::ProjectivePoint)
+                {
+                    const __m256 w = _mm256_fmadd_ps(m[3], x, _mm256_fmadd_ps(m[7], y, _mm256_fmadd_ps(m[11], z, m[15])));
+                    for (__m256& component : transformed)
+                        component = _mm256_div_ps(component, w);
+                }
+
+                StoreVectors3(transformed[0], transformed[1], transformed[2], result);
+            }
+
+            if (i < count)
+                Sse41::TransformVectors3<Mode>(matrix, vectors, result, count - i);
+        }
+
+        /// @brief Same as Sse41::InverseLength, for 8 values.
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        __m256 InverseLength(const __m256 squaredLength) noexcept
+        {
+            // r * (1.5 - 0.5 * squaredLength * r * r)
+            const __m256 r = _mm256_rsqrt_ps(squaredLength);
+            const __m256 halfSquaredLength = _mm256_mul_ps(_mm256_set1_ps(0.5f), squaredLength);
+            const __m256 inverse = _mm256_mul_ps(r, _mm256_fnmadd_ps(_mm256_mul_ps(halfSquaredLength, r), r, _mm256_set1_ps(1.5f)));
+            // Calc::IsZero(length) is false for NaN, so NaN lengths must keep their inverse
+            const __m256 mask = _mm256_cmp_ps(squaredLength, _mm256_set1_ps(SQ(Calc::Zero)), _CMP_NLE_UQ);
+            return _mm256_and_ps(inverse, mask);
+        }
+
+        /// @brief Divides each component of @p x, @p y and @p z by the length of the vector it belongs to, vectors of length zero becoming zero.
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void Normalize(__m256& x, __m256& y, __m256& z) noexcept
+        {
+            const __m256 squaredLength = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+            const __m256 invLength = InverseLength(squaredLength);
+
+            x = _mm256_mul_ps(x, invLength);
+            y = _mm256_mul_ps(y, invLength);
+            z = _mm256_mul_ps(z, invLength);
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void NormalizeVectors2(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Four vectors at a time, the squares of each one being added to their swapped counterparts
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4, vectors += 8, result += 8)
+            {
+                const __m256 v = _mm256_loadu_ps(vectors);
+                const __m256 squares = _mm256_mul_ps(v, v);
+                const __m256 squaredLength = _mm256_add_ps(squares, _mm256_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1)));
+                _mm256_storeu_ps(result, _mm256_mul_ps(v, InverseLength(squaredLength)));
+            }
+
+            if (i < count)
+                Sse41::NormalizeVectors2(vectors, result, count - i);
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void NormalizeVectors3(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Eight vectors at a time, converted from (x, y, z) triplets to one register per component and back
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8, vectors += 24, result += 24)
+            {
+                __m256 x, y, z;
+                LoadVectors3(vectors, &x, &y, &z);
+                Normalize(x, y, z);
+                StoreVectors3(x, y, z, result);
+            }
+
+            if (i < count)
+                Sse41::NormalizeVectors3(vectors, result, count - i);
+        }
+
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void NormalizeVectors4(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Two vectors at a time, one per 128-bit lane
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2, vectors += 8, result += 8)
+            {
+                const __m256 v = _mm256_loadu_ps(vectors);
+                _mm256_storeu_ps(result, _mm256_mul_ps(v, InverseLength(_mm256_dp_ps(v, v, 0xFF))));
+            }
+
+            if (i < count)
+                Sse41::NormalizeVectors4(vectors, result, count - i);
+        }
+
+        /// @brief Same as Sse41::Round, for 8 values.
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        __m256 Round(const __m256 v) noexcept
+        {
+            if constexpr (Mode != Rounding::HalfAwayFromZero)
+                return _mm256_round_ps(v, static_cast<int32_t>(Mode) | _MM_FROUND_NO_EXC);
+            else
+            {
+                const __m256 signMask = _mm256_set1_ps(-0.f);
+                const __m256 truncated = _mm256_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                const __m256 halfOrMore = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(v, truncated)), _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+                return _mm256_add_ps(truncated, _mm256_or_ps(_mm256_and_ps(halfOrMore, _mm256_set1_ps(1.f)), _mm256_and_ps(v, signMask)));
+            }
+        }
+
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("avx2,fma")
+        void RoundValues(const float_t* values, float_t* result, const size_t count) noexcept
+        {
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+                _mm256_storeu_ps(result + i, Round<Mode>(_mm256_loadu_ps(values + i)));
+
+            if (i < count)
+                Sse41::RoundValues<Mode>(values + i, result + i, count - i);
+        }
+
+        MATH_INLINE constexpr Kernels Table = {
+            InstructionSet::Avx2,
+            MultiplyMatrices,
+            MultiplyMatricesByMatrix,
+            Sse41::InvertMatrices,
+            Sse41::InvertRigidMatrices,
+            TransformVectors4,
+            TransformVectors3<Transform::Point>,
+            TransformVectors3<Transform::Direction>,
+            TransformVectors3<Transform::ProjectivePoint>,
+            ComposeTrs<4, false>,
+            ComposeTrs<3, false>,
+            ComposeTrs<4, true>,
+            NormalizeVectors2,
+            NormalizeVectors3,
+            NormalizeVectors4,
+            RoundValues<Rounding::HalfAwayFromZero>,
+            RoundValues<Rounding::Down>,
+            RoundValues<Rounding::Up>
+        };
+    }
+
+    namespace Avx512
+    {
+        /// @brief Multiplies the matrix of columns @p c0 to @p c3 by the four vectors of @p v, one per 128-bit lane.
+        MATH_INLINE MATH_TARGET("avx512f")
+        __m512 LinearCombination(const __m512 v, const __m512 c0, const __m512 c1, const __m512 c2, const __m512 c3) noexcept
+        {
+            __m512 result = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+            result = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+            result = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+            return _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+        }
+
+        MATH_INLINE MATH_TARGET("avx512f")
+        void MultiplyMatrices(const float_t* lhs, const float_t* rhs, float_t* result, const size_t count) noexcept
+        {
+            // A whole matrix per register, each column of rhs giving a column of the result
+            for (size_t i = 0; i < count; i++, lhs += 16, rhs += 16, result += 16)
+            {
+                const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs));
+                const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 4));
+                const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 8));
+                const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(lhs + 12));
+
+                _mm512_storeu_ps(result, LinearCombination(_mm512_loadu_ps(rhs), c0, c1, c2, c3));
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("avx512f")
+        void MultiplyMatricesByMatrix(const float_t* matrices, const float_t* matrix, float_t* result, const size_t count) noexcept
+        {
+            // A whole matrix per register, factors[k] holding the k-th component of each column of matrix in the matching 128-bit lane
+            __m512 factors[4];
+            for (size_t k = 0; k < 4; k++)
+            {
+                factors[k] = _mm512_setr_ps(
+                    matrix[k], matrix[k], matrix[k], matrix[k],
+                    matrix[4 + k], matrix[4 + k], matrix[4 + k], matrix[4 + k],
+                    matrix[8 + k], matrix[8 + k], matrix[8 + k], matrix[8 + k],
+                    matrix[12 + k], matrix[12 + k], matrix[12 + k], matrix[12 + k]
+                );
+            }
+
+            for (size_t i = 0; i < count; i++, matrices += 16, result += 16)
+            {
+                const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrices));
+                const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrices + 4));
+                const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrices + 8));
+                const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrices + 12));
+
+                _mm512_storeu_ps(result, _mm512_fmadd_ps(c3, factors[3], _mm512_fmadd_ps(c2, factors[2], _mm512_fmadd_ps(c1, factors[1], _mm512_mul_ps(c0, factors[0])))));
+            }
+        }
+
+        MATH_INLINE MATH_TARGET("avx512f")
+        void TransformVectors4(const float_t* matrix, const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrix));
+            const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrix + 4));
+            const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrix + 8));
+            const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(matrix + 12));
+
+            // Four vectors at a time, one per 128-bit lane
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4, vectors += 16, result += 16)
+                _mm512_storeu_ps(result, LinearCombination(_mm512_loadu_ps(vectors), c0, c1, c2, c3));
+
+            if (i < count)
+                Sse41::TransformVectors4(matrix, vectors, result, count - i);
+        }
+
+        /// @brief Same as Sse41::InverseLength, for 16 values, the mask of the non-zero lengths being returned in @p nonZero.
+        MATH_INLINE MATH_TARGET("avx512f")
+        __m512 InverseLength(const __m512 squaredLength, __mmask16* nonZero) noexcept
+        {
+            // The 14-bit estimate of rsqrt14 makes the Newton-Raphson step precise to the last bits
+            const __m512 r = _mm512_rsqrt14_ps(squaredLength);
+            const __m512 halfSquaredLength = _mm512_mul_ps(_mm512_set1_ps(0.5f), squaredLength);
+            // Calc::IsZero(length) is false for NaN, so NaN lengths must keep their inverse
+            *nonZero = _mm512_cmp_ps_mask(squaredLength, _mm512_set1_ps(SQ(Calc::Zero)), _CMP_NLE_UQ);
+            return _mm512_mul_ps(r, _mm512_fnmadd_ps(_mm512_mul_ps(halfSquaredLength, r), r, _mm512_set1_ps(1.5f)));
+        }
+
+        MATH_INLINE MATH_TARGET("avx512f")
+        void NormalizeVectors2(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Eight vectors at a time, the squares of each one being added to their swapped counterparts
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8, vectors += 16, result += 16)
+            {
+                const __m512 v = _mm512_loadu_ps(vectors);
+                const __m512 squares = _mm512_mul_ps(v, v);
+                const __m512 squaredLength = _mm512_add_ps(squares, _mm512_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1)));
+
+                __mmask16 nonZero;
+                const __m512 invLength = InverseLength(squaredLength, &nonZero);
+                _mm512_storeu_ps(result, _mm512_maskz_mul_ps(nonZero, v, invLength));
+            }
+
+            if (i < count)
+                Avx2::NormalizeVectors2(vectors, result, count - i);
+        }
+
+        MATH_INLINE MATH_TARGET("avx512f")
+        void NormalizeVectors4(const float_t* vectors, float_t* result, const size_t count) noexcept
+        {
+            // Four vectors at a time, one per 128-bit lane
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4, vectors += 16, result += 16)
+            {
+                const __m512 v = _mm512_loadu_ps(vectors);
+                const __m512 squares = _mm512_mul_ps(v, v);
+                const __m512 pairs = _mm512_add_ps(squares, _mm512_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1)));
+                const __m512 squaredLength = _mm512_add_ps(pairs, _mm512_permute_ps(pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                __mmask16 nonZero;
+                const __m512 invLength = InverseLength(squaredLength, &nonZero);
+                _mm512_storeu_ps(result, _mm512_maskz_mul_ps(nonZero, v, invLength));
+            }
+
+            if (i < count)
+                Sse41::NormalizeVectors4(vectors, result, count - i);
+        }
+
+        /// @brief Same as Sse41::Round, for 16 values.
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("avx512f")
+        __m512 Round(const __m512 v) noexcept
+        {
+            if constexpr (Mode != Rounding::HalfAwayFromZero)
+                return _mm512_roundscale_ps(v, static_cast<int32_t>(Mode) | _MM_FROUND_NO_EXC);
+            else
+            {
+                // AVX-512F has no floating-point bitwise operations, so the sign is applied using masks
+                const __m512 truncated = _mm512_roundscale_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                const __mmask16 halfOrMore = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(v, truncated)), _mm512_set1_ps(0.5f), _CMP_GE_OQ);
+                const __mmask16 negative = _mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_LT_OQ);
+                const __m512 one = _mm512_mask_mov_ps(_mm512_set1_ps(1.f), negative, _mm512_set1_ps(-1.f));
+                return _mm512_mask_add_ps(truncated, halfOrMore, truncated, one);
+            }
+        }
+
+        template <Rounding Mode>
+        MATH_INLINE MATH_TARGET("avx512f")
+        void RoundValues(const float_t* values, float_t* result, const size_t count) noexcept
+        {
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+                _mm512_storeu_ps(result + i, Round<Mode>(_mm512_loadu_ps(values + i)));
+
+            if (i < count)
+                Avx2::RoundValues<Mode>(values + i, result + i, count - i);
+        }
+
+        MATH_INLINE constexpr Kernels Table = {
+            InstructionSet::Avx512,
+            MultiplyMatrices,
+            MultiplyMatricesByMatrix,
+            Sse41::InvertMatrices,
+            Sse41::InvertRigidMatrices,
+            TransformVectors4,
+            Avx2::TransformVectors3<Transform::Point>,
+            Avx2::TransformVectors3<Transform::Direction>,
+            Avx2::TransformVectors3<Transform::ProjectivePoint>,
+            Avx2::ComposeTrs<4, false>,
+            Avx2::ComposeTrs<3, false>,
+            Avx2::ComposeTrs<4, true>,
+            NormalizeVectors2,
+            Avx2::NormalizeVectors3,
+            NormalizeVectors4,
+            RoundValues<Rounding::HalfAwayFromZero>,
+            RoundValues<Rounding::Down>,
+            RoundValues<Rounding::Up>
+        };
+    }
+
+    MATH_INLINE void Cpuid(int32_t (&registers)[4], const int32_t leaf, const int32_t subLeaf) noexcept
+    {
+#ifdef _MSC_VER
+        __cpuidex(registers, leaf, subLeaf);
+#else
+        uint32_t eax, ebx, ecx, edx;
+        __cpuid_count(leaf, subLeaf, eax, ebx, ecx, edx);
+        registers[0] = static_cast<int32_t>(eax);
+        registers[1] = static_cast<int32_t>(ebx);
+        registers[2] = static_cast<int32_t>(ecx);
+        registers[3] = static_cast<int32_t>(edx);
+#endif
+    }
+
+    /// @brief Returns the register states the OS saves on context switches, e.g. the XCR0 register.
+    MATH_INLINE uint64_t EnabledRegisterStates() noexcept
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return static_cast<uint64_t>(edx) << 32 | eax;
+#endif
+    }
+#endif
+
+    MATH_INLINE InstructionSet Detect() noexcept
+    {
+#ifdef MATH_SIMD_SSE
+        constexpr int32_t Sse41Bit = 1 << 19;
+        constexpr int32_t FmaBit = 1 << 12;
+        constexpr int32_t OsXsaveBit = 1 << 27;
+        constexpr int32_t AvxBit = 1 << 28;
+        constexpr int32_t Avx2Bit = 1 << 5;
+        constexpr int32_t Avx512FBit = 1 << 16;
+        // SSE and AVX registers
+        constexpr uint64_t AvxStates = 0x6;
+        // AVX-512 opmask and upper ZMM registers in addition to the AVX ones
+        constexpr uint64_t Avx512States = 0xE6;
+
+        int32_t registers[4];
+        Cpuid(registers, 0, 0);
+        const int32_t maxLeaf = registers[0];
+
+        Cpuid(registers, 1, 0);
+        const int32_t features = registers[2];
+        if (!(features & Sse41Bit))
+            return InstructionSet::Scalar;
+
+        if (!(features & OsXsaveBit) || !(features & AvxBit) || !(features & FmaBit) || maxLeaf < 7)
+            return InstructionSet::Sse41;
+
+        const uint64_t states = EnabledRegisterStates();
+        if ((states & AvxStates) != AvxStates)
+            return InstructionSet::Sse41;
+
+        Cpuid(registers, 7, 0);
+        const int32_t extendedFeatures = registers[1];
+        if (!(extendedFeatures & Avx2Bit))
+            return InstructionSet::Sse41;
+
+        if (!(extendedFeatures & Avx512FBit) || (states & Avx512States) != Avx512States)
+            return InstructionSet::Avx2;
+
+        return InstructionSet::Avx512;
+#else
+        return InstructionSet::Scalar;
+#endif
+    }
+
+    /// @brief Returns the InstructionSet named by the @c MATH_TOOLBOX_SIMD environment variable, or @p fallback if it isn't set or invalid.
+    MATH_INLINE InstructionSet FromEnvironment(const InstructionSet fallback)
+    {
+        std::string value;
+#ifdef _MSC_VER
+        char_t* buffer = nullptr;
+        size_t size = 0;
+        if (_dupenv_s(&buffer, &size, EnvironmentVariable) != 0 || buffer == nullptr)
+            return fallback;
+        value = buffer;
+        std::free(buffer);
+#else
+        const char_t* buffer = std::getenv(EnvironmentVariable);
+        if (buffer == nullptr)
+            return fallback;
+        value = buffer;
+#endif
+
+        std::ranges::transform(value, value.begin(), [](const char_t c) { return static_cast<char_t>(std::tolower(static_cast<unsigned char>(c))); });
+
+        for (const InstructionSet instructionSet : { InstructionSet::Scalar, InstructionSet::Sse41, InstructionSet::Avx2, InstructionSet::Avx512 })
+        {
+            if (value == ToString(instructionSet))
+                return instructionSet;
+        }
+        return fallback;
+    }
+
+    MATH_INLINE const Kernels& KernelsOf(const InstructionSet instructionSet) noexcept
+    {
+        switch (instructionSet)
+        {
+#ifdef MATH_SIMD_SSE
+            case InstructionSet::Sse41:
+                return Sse41::Table;
+            case InstructionSet::Avx2:
+                return Avx2::Table;
+            case InstructionSet::Avx512:
+                return Avx512::Table;
+#endif
+            default:
+                return Scalar::Table;
+        }
+    }
+
+    MATH_INLINE std::atomic<const Kernels*>& CurrentKernels() noexcept
+    {
+        static std::atomic current = &KernelsOf(std::min(FromEnvironment(SupportedInstructionSet()), SupportedInstructionSet()));
+        return current;
+    }
+}
+
+MATH_INLINE Dispatch::InstructionSet Dispatch::SupportedInstructionSet() noexcept
+{
+    static const InstructionSet supported = Internal::Detect();
+    return supported;
+}
+
+MATH_INLINE Dispatch::InstructionSet Dispatch::CurrentInstructionSet() noexcept { return GetKernels().instructionSet; }
+
+MATH_INLINE Dispatch::InstructionSet Dispatch::SetInstructionSet(const InstructionSet instructionSet) noexcept
+{
+    const Kernels& kernels = Internal::KernelsOf(std::min(instructionSet, SupportedInstructionSet()));
+    Internal::CurrentKernels().store(&kernels, std::memory_order_release);
+    return kernels.instructionSet;
+}
+
+MATH_INLINE const Dispatch::Kernels& Dispatch::GetKernels() noexcept { return *Internal::CurrentKernels().load(std::memory_order_acquire); }
+
+MATH_INLINE const char_t* Dispatch::ToString(const InstructionSet instructionSet) noexcept
+{
+    switch (instructionSet)
+    {
+        case InstructionSet::Scalar:
+            return "scalar";
+        case InstructionSet::Sse41:
+            return "sse4.1";
+        case InstructionSet::Avx2:
+            return "avx2";
+        case InstructionSet::Avx512:
+            return "avx512";
+    }
+    return "unknown";
+}
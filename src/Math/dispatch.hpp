@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Math/core.hpp"
+
+/// @file dispatch.hpp
+/// @brief Defines the run-time selection of the SIMD kernels used by the library.
+///
+/// The kernels are chosen once, the first time they are needed, according to the instruction sets supported by the CPU and the OS.
+/// Setting the @c MATH_TOOLBOX_SIMD environment variable to @c scalar, @c sse4.1, @c avx2 or @c avx512 forces a specific set instead,
+/// which is useful when benchmarking or debugging. A set that isn't supported by the machine falls back to the best supported one.
+
+/// @namespace Dispatch
+/// @brief This namespace contains the CPU feature detection and the table of the kernels selected at run-time.
+namespace Dispatch
+{
+    /// @brief The name of the environment variable used to force an InstructionSet.
+    constexpr const char_t* EnvironmentVariable = "MATH_TOOLBOX_SIMD";
+
+    /// @brief The instruction sets the kernels can be implemented with, from the least to the most capable.
+    enum class InstructionSet : uint8_t
+    {
+        /// @brief Plain C++ code, available everywhere.
+        Scalar,
+        /// @brief SSE up to SSE4.1.
+        Sse41,
+        /// @brief AVX2 and FMA3.
+        Avx2,
+        /// @brief AVX-512 Foundation.
+        Avx512
+    };
+
+    /// @brief The table of the kernels implemented with a specific InstructionSet.
+    ///
+    /// All the kernels work on arrays of column-major matrices and of packed vectors.
+    /// Their @c result parameter can either point to the same memory as their inputs, or to memory that doesn't overlap with them.
+    struct Kernels
+    {
+        /// @brief The instruction set these kernels are implemented with.
+        InstructionSet instructionSet;
+
+        /// @brief Computes <c>result[i] = lhs[i] * rhs[i]</c> for @p count 4x4 matrices.
+        void (*multiplyMatrices)(const float_t* lhs, const float_t* rhs, float_t* result, size_t count) noexcept;
+
+        /// @brief Computes <c>result[i] = matrices[i] * matrix</c> for @p count 4x4 matrices, @p matrix staying in registers.
+        ///
+        /// The product by a shared matrix on the left, <c>matrix * matrices[i]</c>, is @ref transformVectors4 applied to the <c>4 * count</c> columns of @p matrices.
+        void (*multiplyMatricesByMatrix)(const float_t* matrices, const float_t* matrix, float_t* result, size_t count) noexcept;
+
+        /// @brief Inverts @p count 4x4 matrices.
+        ///
+        /// @returns @c false if at least one of the matrices isn't invertible, in which case its result is left untouched.
+        bool_t (*invertMatrices)(const float_t* matrices, float_t* result, size_t count) noexcept;
+
+        /// @brief Inverts @p count rigid 4x4 matrices, e.g. matrices made of a rotation and a translation only, by transposing their rotation.
+        void (*invertRigidMatrices)(const float_t* matrices, float_t* result, size_t count) noexcept;
+
+        /// @brief Computes <c>result[i] = matrix * vectors[i]</c> for @p count 4-component vectors.
+        void (*transformVectors4)(const float_t* matrix, const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Computes <c>result[i] = matrix * (vectors[i], 1)</c> for @p count 3-component points, ignoring the last row of the matrix.
+        void (*transformPoints3)(const float_t* matrix, const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Computes <c>result[i] = matrix * (vectors[i], 0)</c> for @p count 3-component directions, ignoring the last row and column of the matrix.
+        void (*transformDirections3)(const float_t* matrix, const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Computes <c>matrix * (vectors[i], 1)</c> for @p count 3-component points, and divides the @c x, @c y and @c z components of each result by its @c w component.
+        void (*transformPointsProjective3)(const float_t* matrix, const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Creates @p count column-major 4x4 Translation-Rotation-Scaling matrices from packed 3-component translations, @c x, @c y, @c z, @c w quaternions and 3-component scales.
+        ///
+        /// @p result must not overlap with the inputs.
+        void (*composeTrs4x4)(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, size_t count) noexcept;
+
+        /// @brief Same as @ref composeTrs4x4, but without the last row of the matrices, like AffineTransform.
+        void (*composeTrs3x4)(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, size_t count) noexcept;
+
+        /// @brief Creates the inverse of the matrices created by @ref composeTrs4x4, without inverting them.
+        ///
+        /// Scales with a zero component give infinite or NaN components.
+        void (*composeInvertedTrs4x4)(const float_t* translations, const float_t* rotations, const float_t* scales, float_t* result, size_t count) noexcept;
+
+        /// @brief Normalizes @p count 2-component vectors, vectors with a length of zero staying zero.
+        ///
+        /// The SIMD implementations multiply by an approximate inverse square root refined with a Newton-Raphson step,
+        /// so that the length of the results is within 1e-6 of one.
+        void (*normalizeVectors2)(const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Same as @ref normalizeVectors2, for 3-component vectors.
+        void (*normalizeVectors3)(const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Same as @ref normalizeVectors2, for 4-component vectors.
+        void (*normalizeVectors4)(const float_t* vectors, float_t* result, size_t count) noexcept;
+
+        /// @brief Rounds @p count values to the nearest integer, halfway cases away from zero, like @c std::round.
+        void (*roundValues)(const float_t* values, float_t* result, size_t count) noexcept;
+
+        /// @brief Rounds @p count values down, like @c std::floor.
+        void (*floorValues)(const float_t* values, float_t* result, size_t count) noexcept;
+
+        /// @brief Rounds @p count values up, like @c std::ceil.
+        void (*ceilValues)(const float_t* values, float_t* result, size_t count) noexcept;
+    };
+
+    /// @brief Returns the most capable InstructionSet supported by both the CPU and the OS.
+    [[nodiscard]]
+    MATH_TOOLBOX InstructionSet SupportedInstructionSet() noexcept;
+
+    /// @brief Returns the InstructionSet of the kernels currently in use.
+    [[nodiscard]]
+    MATH_TOOLBOX InstructionSet CurrentInstructionSet() noexcept;
+
+    /// @brief Forces the kernels of a specific InstructionSet to be used.
+    ///
+    /// @param instructionSet The instruction set to use. If it isn't supported, the most capable supported one is used instead.
+    /// @returns The InstructionSet actually in use.
+    MATH_TOOLBOX InstructionSet SetInstructionSet(InstructionSet instructionSet) noexcept;
+
+    /// @brief Returns the kernels currently in use.
+    [[nodiscard]]
+    MATH_TOOLBOX const Kernels& GetKernels() noexcept;
+
+    /// @brief Returns the name of an InstructionSet, as accepted by the @c MATH_TOOLBOX_SIMD environment variable.
+    [[nodiscard]]
+    MATH_TOOLBOX const char_t* ToString(InstructionSet instructionSet) noexcept;
+
+    /// @brief The minimum number of elements given to each thread by the batch functions accepting a thread count, below which fewer threads are used.
+    constexpr size_t MinimumCountPerThread = 1024;
+}
@@ -2,99 +2,127 @@
 
 #include "Math/calc.hpp"
 
-float_t Easing::SineIn(const float_t t)
+MATH_INLINE float_t Easing::ElasticIn(const float_t t)
 {
-    return 1.f + std::sin(Calc::PiOver2 * (t - 1));
+    const float_t t2 = t * t;
+    return MATH_CHECK_DENORMALS(t2 * t2 * std::sin(t * Calc::Pi * 4.5f), t);
 }
 
-float_t Easing::SineOut(const float_t t)
+MATH_INLINE float_t Easing::ElasticOut(const float_t t)
 {
-    return std::sin(Calc::PiOver2 * t);
+    const float_t t2 = (t - 1.f) * (t - 1.f);
+    return MATH_CHECK_DENORMALS(1.f - t2 * t2 * std::cos(t * Calc::Pi * 4.5f), t);
 }
 
-float_t Easing::SineInOut(const float_t t)
+MATH_INLINE float_t Easing::ElasticInOut(const float_t t)
 {
-    return 0.5f * (1.f + std::sin(Calc::Pi * (t - 0.5f)));
+    float_t t2;
+    if (t < 0.45f)
+    {
+        t2 = t * t;
+        return MATH_CHECK_DENORMALS(8.f * t2 * t2 * std::sin(t * Calc::Pi * 9.f), t);
+    }
+
+    if (t < 0.55f)
+        return MATH_CHECK_DENORMALS(0.5f + 0.75f * std::sin(t * Calc::Pi * 4.f), t);
+
+    t2 = (t - 1.f) * (t - 1.f);
+    return MATH_CHECK_DENORMALS(1.f - 8.f * t2 * t2 * std::sin(t * Calc::Pi * 9.f), t);
 }
 
-float_t Easing::ExpoIn(const float_t t)
+MATH_INLINE float_t Easing::BounceIn(const float_t t)
 {
-    return (std::pow(2.f, 8.f * t) - 1.f) / 255.f;
+    return MATH_CHECK_DENORMALS(std::pow(2.f, 6.f * (t - 1.f)) * std::abs(std::sin(t * Calc::Pi * 3.5f)), t);
 }
 
-float_t Easing::ExpoOut(const float_t t)
+MATH_INLINE float_t Easing::BounceOut(const float_t t)
 {
-    return 1.f - std::pow(2.f, -8.f * t);
+    return MATH_CHECK_DENORMALS(1.f - std::pow(2.f, -6.f * t) * std::abs(std::cos(t * Calc::Pi * 3.5f)), t);
 }
 
-float_t Easing::ExpoInOut(const float_t t)
+MATH_INLINE float_t Easing::BounceInOut(const float_t t)
 {
     if (t < 0.5f)
-        return (std::pow(2.f, 16.f * t) - 1.f) / 510.f;
+        return MATH_CHECK_DENORMALS(8.f * std::pow(2.f, 8.f * (t - 1.f)) * std::abs(std::sin(t * Calc::Pi * 7.f)), t);
+
+    return MATH_CHECK_DENORMALS(1.f - 8.f * std::pow(2.f, -8.f * t) * std::abs(std::sin(t * Calc::Pi * 7.f)), t);
+}
+
+MATH_INLINE float_t Easing::Fast::SineIn(const float_t t)
+{
+    return 1.f + Calc::FastSin(Calc::PiOver2 * (t - 1));
+}
 
-    return 1.f - 0.5f * std::pow(2.f, -16.f * (t - 0.5f));
+MATH_INLINE float_t Easing::Fast::SineOut(const float_t t)
+{
+    return Calc::FastSin(Calc::PiOver2 * t);
+}
+
+MATH_INLINE float_t Easing::Fast::SineInOut(const float_t t)
+{
+    return 0.5f * (1.f + Calc::FastSin(Calc::Pi * (t - 0.5f)));
 }
 
-float_t Easing::CircIn(const float_t t)
+MATH_INLINE float_t Easing::Fast::ExpoIn(const float_t t)
 {
-    return 1.f - std::sqrt(1.f - t);
+    return MATH_CHECK_DENORMALS((Calc::FastExp2(8.f * t) - 1.f) / 255.f, t);
 }
 
-float_t Easing::CircOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::ExpoOut(const float_t t)
 {
-    return std::sqrt(t);
+    return MATH_CHECK_DENORMALS(1.f - Calc::FastExp2(-8.f * t), t);
 }
 
-float_t Easing::CircInOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::ExpoInOut(const float_t t)
 {
     if (t < 0.5f)
-        return (1.f - std::sqrt(1.f - 2.f * t)) * 0.5f;
+        return MATH_CHECK_DENORMALS((Calc::FastExp2(16.f * t) - 1.f) / 510.f, t);
 
-    return (1.f + std::sqrt(2.f * t - 1.f)) * 0.5f;
+    return MATH_CHECK_DENORMALS(1.f - 0.5f * Calc::FastExp2(-16.f * (t - 0.5f)), t);
 }
 
-float_t Easing::ElasticIn(const float_t t)
+MATH_INLINE float_t Easing::Fast::ElasticIn(const float_t t)
 {
     const float_t t2 = t * t;
-    return t2 * t2 * std::sin(t * Calc::Pi * 4.5f);
+    return MATH_CHECK_DENORMALS(t2 * t2 * Calc::FastSin(t * Calc::Pi * 4.5f), t);
 }
 
-float_t Easing::ElasticOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::ElasticOut(const float_t t)
 {
     const float_t t2 = (t - 1.f) * (t - 1.f);
-    return 1.f - t2 * t2 * std::cos(t * Calc::Pi * 4.5f);
+    return MATH_CHECK_DENORMALS(1.f - t2 * t2 * Calc::FastCos(t * Calc::Pi * 4.5f), t);
 }
 
-float_t Easing::ElasticInOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::ElasticInOut(const float_t t)
 {
     float_t t2;
     if (t < 0.45f)
     {
         t2 = t * t;
-        return 8.f * t2 * t2 * std::sin(t * Calc::Pi * 9.f);
+        return MATH_CHECK_DENORMALS(8.f * t2 * t2 * Calc::FastSin(t * Calc::Pi * 9.f), t);
     }
 
     if (t < 0.55f)
-        return 0.5f + 0.75f * std::sin(t * Calc::Pi * 4.f);
+        return MATH_CHECK_DENORMALS(0.5f + 0.75f * Calc::FastSin(t * Calc::Pi * 4.f), t);
 
     t2 = (t - 1.f) * (t - 1.f);
-    return 1.f - 8.f * t2 * t2 * std::sin(t * Calc::Pi * 9.f);
+    return MATH_CHECK_DENORMALS(1.f - 8.f * t2 * t2 * Calc::FastSin(t * Calc::Pi * 9.f), t);
 }
 
-float_t Easing::BounceIn(const float_t t)
+MATH_INLINE float_t Easing::Fast::BounceIn(const float_t t)
 {
-    return std::pow(2.f, 6.f * (t - 1.f)) * std::abs(std::sin(t * Calc::Pi * 3.5f));
+    return MATH_CHECK_DENORMALS(Calc::FastExp2(6.f * (t - 1.f)) * Calc::Abs(Calc::FastSin(t * Calc::Pi * 3.5f)), t);
 }
 
-float_t Easing::BounceOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::BounceOut(const float_t t)
 {
-    return 1.f - std::pow(2.f, -6.f * t) * std::abs(std::cos(t * Calc::Pi * 3.5f));
+    return MATH_CHECK_DENORMALS(1.f - Calc::FastExp2(-6.f * t) * Calc::Abs(Calc::FastCos(t * Calc::Pi * 3.5f)), t);
 }
 
-float_t Easing::BounceInOut(const float_t t)
+MATH_INLINE float_t Easing::Fast::BounceInOut(const float_t t)
 {
     if (t < 0.5f)
-        return 8.f * std::pow(2.f, 8.f * (t - 1.f)) * std::abs(std::sin(t * Calc::Pi * 7.f));
+        return MATH_CHECK_DENORMALS(8.f * Calc::FastExp2(8.f * (t - 1.f)) * Calc::Abs(Calc::FastSin(t * Calc::Pi * 7.f)), t);
 
-    return 1.f - 8.f * std::pow(2.f, -8.f * t) * std::abs(std::sin(t * Calc::Pi * 7.f));
+    return MATH_CHECK_DENORMALS(1.f - 8.f * Calc::FastExp2(-8.f * t) * Calc::Abs(Calc::FastSin(t * Calc::Pi * 7.f)), t);
 }
@@ -1,10 +1,20 @@
 #pragma once
 
+#include <numbers>
+
 #include "Math/core.hpp"
+#include "Math/denormals.hpp"
 
 /// @file easing.hpp
 /// @brief Defines the Easing namespace in which the common <a href="https://easings.net">easing functions</a> are defined.
 
+namespace Calc
+{
+    MATH_TOOLBOX constexpr float_t Sqrt(float_t x) noexcept;
+    MATH_TOOLBOX constexpr float_t Sin(float_t angle) noexcept;
+    MATH_TOOLBOX constexpr float_t Exp2(float_t x) noexcept;
+}
+
 /// @namespace Easing
 /// @brief This namespace contains common <a href="https://easings.net">easing functions</a>.
 namespace Easing
@@ -21,21 +31,21 @@ namespace Easing
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t SineIn(float_t t);
+    MATH_TOOLBOX constexpr float_t SineIn(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeOutSine">SineOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t SineOut(float_t t);
+    MATH_TOOLBOX constexpr float_t SineOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInOutSine">SineInOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t SineInOut(float_t t);
+    MATH_TOOLBOX constexpr float_t SineInOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInQuad">QuadIn</a> easing function.
     ///
@@ -126,42 +136,42 @@ namespace Easing
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t ExpoIn(float_t t);
+    MATH_TOOLBOX constexpr float_t ExpoIn(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeOutExpo">ExpoOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t ExpoOut(float_t t);
+    MATH_TOOLBOX constexpr float_t ExpoOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInOutExpo">ExpoInOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t ExpoInOut(float_t t);
+    MATH_TOOLBOX constexpr float_t ExpoInOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInCirc">CircIn</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t CircIn(float_t t);
+    MATH_TOOLBOX constexpr float_t CircIn(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeOutCirc">CircOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t CircOut(float_t t);
+    MATH_TOOLBOX constexpr float_t CircOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInOutCirc">CircInOut</a> easing function.
     ///
     /// @param t The current time. Must be between 0 and 1 inclusive.
     /// @return The transformed time.
     [[nodiscard]]
-    MATH_TOOLBOX float_t CircInOut(float_t t);
+    MATH_TOOLBOX constexpr float_t CircInOut(float_t t);
 
     /// @brief The <a href="https://easings.net/#easeInBack">BackIn</a> easing function.
     ///
@@ -225,6 +235,62 @@ namespace Easing
     /// @return The transformed time.
     [[nodiscard]]
     MATH_TOOLBOX float_t BounceInOut(float_t t);
+
+    /// @namespace Easing::Fast
+    /// @brief This namespace contains the easing functions that call trigonometric or exponential functions,
+    /// implemented with the fast approximations of @ref Calc::FastMathTag instead. Their error is below 1e-4.
+    ///
+    /// They have the same signature as their precise counterparts, so that they can be used as @ref Easer "Easers" too.
+    namespace Fast
+    {
+        /// @brief A fast approximation of @ref Easing::SineIn.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t SineIn(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::SineOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t SineOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::SineInOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t SineInOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ExpoIn.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ExpoIn(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ExpoOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ExpoOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ExpoInOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ExpoInOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ElasticIn.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ElasticIn(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ElasticOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ElasticOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::ElasticInOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t ElasticInOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::BounceIn.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t BounceIn(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::BounceOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t BounceOut(float_t t);
+
+        /// @brief A fast approximation of @ref Easing::BounceInOut.
+        [[nodiscard]]
+        MATH_TOOLBOX float_t BounceInOut(float_t t);
+    }
 }
 
 constexpr float_t Easing::Linear(const float_t t)
@@ -345,3 +411,54 @@ constexpr float_t Easing::BackInOut(float_t t)
         return 1.f + t * t * 2.f * (7.f * t + 2.5f);
     }
 }
+
+constexpr float_t Easing::SineIn(const float_t t)
+{
+    return 1.f + Calc::Sin(std::numbers::pi_v<float_t> / 2.f * (t - 1));
+}
+
+constexpr float_t Easing::SineOut(const float_t t)
+{
+    return Calc::Sin(std::numbers::pi_v<float_t> / 2.f * t);
+}
+
+constexpr float_t Easing::SineInOut(const float_t t)
+{
+    return 0.5f * (1.f + Calc::Sin(std::numbers::pi_v<float_t> * (t - 0.5f)));
+}
+
+constexpr float_t Easing::ExpoIn(const float_t t)
+{
+    return MATH_CHECK_DENORMALS((Calc::Exp2(8.f * t) - 1.f) / 255.f, t);
+}
+
+constexpr float_t Easing::ExpoOut(const float_t t)
+{
+    return MATH_CHECK_DENORMALS(1.f - Calc::Exp2(-8.f * t), t);
+}
+
+constexpr float_t Easing::ExpoInOut(const float_t t)
+{
+    if (t < 0.5f)
+        return MATH_CHECK_DENORMALS((Calc::Exp2(16.f * t) - 1.f) / 510.f, t);
+
+    return MATH_CHECK_DENORMALS(1.f - 0.5f * Calc::Exp2(-16.f * (t - 0.5f)), t);
+}
+
+constexpr float_t Easing::CircIn(const float_t t)
+{
+    return 1.f - Calc::Sqrt(1.f - t);
+}
+
+constexpr float_t Easing::CircOut(const float_t t)
+{
+    return Calc::Sqrt(t);
+}
+
+constexpr float_t Easing::CircInOut(const float_t t)
+{
+    if (t < 0.5f)
+        return (1.f - Calc::Sqrt(1.f - 2.f * t)) * 0.5f;
+
+    return (1.f + Calc::Sqrt(2.f * t - 1.f)) * 0.5f;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <concepts>
+#include <format>
+#include <type_traits>
+#include <utility>
+
+#include "Math/core.hpp"
+
+/// @file expression.hpp
+/// @brief Defines MatrixProduct, the lazy product of @ref Matrix "Matrices" or of @ref Matrix3 "Matrix3s" created by LazyProduct.
+
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT;
+using Matrix3 = MatrixT<3, 3, float_t>;
+using Matrix = MatrixT<4, 4, float_t>;
+
+template <typename LhsT, typename RhsT>
+struct MatrixProduct;
+
+/// @private
+template <typename T>
+struct MatrixOperandTraits
+{
+    static constexpr bool_t IsOperand = false;
+};
+
+/// @private
+template <>
+struct MatrixOperandTraits<Matrix>
+{
+    static constexpr bool_t IsOperand = true;
+    static constexpr bool_t IsProduct = false;
+    using MatrixType = Matrix;
+};
+
+/// @private
+template <>
+struct MatrixOperandTraits<Matrix3>
+{
+    static constexpr bool_t IsOperand = true;
+    static constexpr bool_t IsProduct = false;
+    using MatrixType = Matrix3;
+};
+
+/// @private
+template <typename LhsT, typename RhsT>
+struct MatrixOperandTraits<MatrixProduct<LhsT, RhsT>>
+{
+    static constexpr bool_t IsOperand = true;
+    static constexpr bool_t IsProduct = true;
+    using MatrixType = typename MatrixOperandTraits<std::remove_cvref_t<LhsT>>::MatrixType;
+};
+
+/// @brief A Matrix, a Matrix3, or a MatrixProduct of them.
+template <typename T>
+concept MatrixOperand = MatrixOperandTraits<std::remove_cvref_t<T>>::IsOperand;
+
+/// @brief The type of matrix a MatrixOperand evaluates to.
+template <MatrixOperand T>
+using MatrixOperandType = typename MatrixOperandTraits<std::remove_cvref_t<T>>::MatrixType;
+
+/// @private
+/// @brief How a MatrixProduct stores an operand: named matrices by reference, temporary matrices and products by value.
+template <MatrixOperand T>
+using MatrixOperandStorage = std::conditional_t<
+    std::is_lvalue_reference_v<T> && !MatrixOperandTraits<std::remove_cvref_t<T>>::IsProduct,
+    const std::remove_cvref_t<T>&,
+    std::remove_cvref_t<T>
+>;
+
+/// @brief The lazy product of two @ref Matrix "Matrices" or of two @ref Matrix3 "Matrix3s", as returned by LazyProduct.
+///
+/// Multiplying two matrices evaluates their product right away, so a MatrixProduct is only ever created explicitly.
+/// Multiplying it by other matrices builds a longer expression that is only evaluated when converted to its matrix type,
+/// e.g. when assigned to a @c Matrix variable or passed to a function taking a @c Matrix.
+/// Multiplying the expression by a vector instead applies its matrices to the vector one by one from right to left,
+/// so that @code LazyProduct(projection, view, model) * vertex@endcode costs three Matrix-vector products instead of two Matrix products.
+///
+/// The named matrices of the expression are referenced, and the temporary ones are copied into it.
+/// A MatrixProduct thus requires those named matrices to outlive it and to stay unchanged until it is evaluated.
+template <typename LhsT, typename RhsT>
+struct MatrixProduct
+{
+    /// @brief The type of matrix this product evaluates to.
+    using MatrixType = MatrixOperandType<LhsT>;
+
+    static_assert(std::same_as<MatrixType, MatrixOperandType<RhsT>>, "Both operands of a MatrixProduct must be of the same matrix type");
+
+    /// @brief The left-hand side of the product.
+    LhsT lhs;
+
+    /// @brief The right-hand side of the product.
+    RhsT rhs;
+
+    /// @brief Computes the result of this product.
+    [[nodiscard]]
+    constexpr MatrixType Evaluate() const noexcept;
+
+    /// @brief Computes the result of this product.
+    ///
+    /// @param result The output of the function. May be one of the matrices of this product.
+    constexpr void Evaluate(MatrixType* result) const noexcept;
+
+    /// @brief Computes the result of this product.
+    [[nodiscard]]
+    constexpr operator MatrixType() const noexcept; // NOLINT(google-explicit-constructor)
+};
+
+/// @brief Multiplies a MatrixProduct by a matrix or by another MatrixProduct, returning a longer lazy MatrixProduct.
+///
+/// Products of two @ref Matrix "Matrices" or of two @ref Matrix3 "Matrix3s" are instead evaluated right away by their own operator.
+template <MatrixOperand LhsT, MatrixOperand RhsT>
+    requires std::same_as<MatrixOperandType<LhsT>, MatrixOperandType<RhsT>>
+        && (MatrixOperandTraits<std::remove_cvref_t<LhsT>>::IsProduct || MatrixOperandTraits<std::remove_cvref_t<RhsT>>::IsProduct)
+[[nodiscard]]
+constexpr MatrixProduct<MatrixOperandStorage<LhsT>, MatrixOperandStorage<RhsT>> operator*(LhsT&& lhs, RhsT&& rhs) noexcept
+{
+    return { std::forward<LhsT>(lhs), std::forward<RhsT>(rhs) };
+}
+
+/// @brief Creates the lazy MatrixProduct of two or more @ref Matrix "Matrices" or @ref Matrix3 "Matrix3s", from left to right.
+///
+/// @code LazyProduct(projection, view, model) * vertex@endcode transforms @c vertex by each matrix in turn instead of multiplying the matrices together.
+/// The named matrices are referenced by the result, see MatrixProduct.
+template <MatrixOperand FirstT, MatrixOperand SecondT, MatrixOperand... OthersT>
+    requires std::same_as<MatrixOperandType<FirstT>, MatrixOperandType<SecondT>>
+[[nodiscard]]
+constexpr auto LazyProduct(FirstT&& first, SecondT&& second, OthersT&&... others) noexcept
+{
+    MatrixProduct<MatrixOperandStorage<FirstT>, MatrixOperandStorage<SecondT>> product { std::forward<FirstT>(first), std::forward<SecondT>(second) };
+    if constexpr (sizeof...(OthersT) == 0)
+        return product;
+    else
+        return LazyProduct(std::move(product), std::forward<OthersT>(others)...);
+}
+
+/// @private
+/// @brief Returns a reference to @p operand if it is a matrix, or its evaluation if it is a MatrixProduct.
+template <MatrixOperand T>
+constexpr decltype(auto) EvaluateMatrixOperand(const T& operand) noexcept
+{
+    if constexpr (MatrixOperandTraits<T>::IsProduct)
+        return operand.Evaluate();
+    else
+        return operand;
+}
+
+template <typename LhsT, typename RhsT>
+constexpr typename MatrixProduct<LhsT, RhsT>::MatrixType MatrixProduct<LhsT, RhsT>::Evaluate() const noexcept
+{
+    MatrixType result;
+    Evaluate(&result);
+    return result;
+}
+
+template <typename LhsT, typename RhsT>
+constexpr void MatrixProduct<LhsT, RhsT>::Evaluate(MatrixType* const result) const noexcept
+{
+    MatrixType::Multiply(EvaluateMatrixOperand(lhs), EvaluateMatrixOperand(rhs), result);
+}
+
+template <typename LhsT, typename RhsT>
+constexpr MatrixProduct<LhsT, RhsT>::operator MatrixType() const noexcept { return Evaluate(); }
+
+/// @brief Formats a MatrixProduct the same way as the matrix it evaluates to.
+template <typename LhsT, typename RhsT>
+struct std::formatter<MatrixProduct<LhsT, RhsT>> : std::formatter<typename MatrixProduct<LhsT, RhsT>::MatrixType>
+{
+    template <class FmtContext>
+    typename FmtContext::iterator format(const MatrixProduct<LhsT, RhsT>& product, FmtContext& ctx) const
+    {
+        return std::formatter<typename MatrixProduct<LhsT, RhsT>::MatrixType>::format(product.Evaluate(), ctx);
+    }
+};
@@ -0,0 +1,579 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+#include "Math/calc.hpp"
+#include "Math/core.hpp"
+#include "Math/simd.hpp"
+
+/// @file floatx8.hpp
+/// @brief Defines the Floatx8 and Maskx8 structs, the lanes of the packet types like Vector3x8.
+///
+/// Packet types hold one value per lane for 8 objects at once, so that code written for a single object runs on 8 of them,
+/// each operation being a single AVX instruction when @c MATH_SIMD_AVX is defined.
+/// Without AVX, the lanes are plain arrays, processed as two halves using SSE where the compiler wouldn't vectorize the loops by itself.
+/// Since their layout depends on @c MATH_SIMD_AVX, the packet types should not be shared between code compiled with different settings.
+
+struct Maskx8;
+
+/// @brief The Floatx8 struct represents 8 @c float_t values processed together, one per lane.
+///
+/// It can be implicitly created from a single value, which is then broadcast to all the lanes,
+/// so that it can be mixed with @c float_t values in expressions.
+struct alignas(32) Floatx8
+{
+    /// @brief The number of lanes of a Floatx8.
+    static constexpr size_t Size = 8;
+
+#ifdef MATH_SIMD_AVX
+    /// @brief The values of this Floatx8, as an AVX register.
+    __m256 value = _mm256_setzero_ps();
+#else
+    /// @brief The values of this Floatx8, one per lane.
+    float_t value[Size] = {};
+#endif
+
+    /// @brief Loads 8 values from @p data, which doesn't need to be aligned.
+    [[nodiscard]]
+    static Floatx8 Load(const float_t* data) noexcept;
+
+    /// @brief Returns, for each lane, the value of @p ifTrue if the lane of @p mask is set, or the value of @p ifFalse otherwise.
+    [[nodiscard]]
+    static Floatx8 Select(const Maskx8& mask, const Floatx8& ifTrue, const Floatx8& ifFalse) noexcept;
+
+    /// @brief Returns the minimum of @p a and @p b, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Min(const Floatx8& a, const Floatx8& b) noexcept;
+
+    /// @brief Returns the maximum of @p a and @p b, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Max(const Floatx8& a, const Floatx8& b) noexcept;
+
+    /// @brief Returns the absolute value of @p a, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Abs(const Floatx8& a) noexcept;
+
+    /// @brief Returns the square root of @p a, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Sqrt(const Floatx8& a) noexcept;
+
+    /// @brief Returns an approximation of @c 1 / Sqrt(a), lane by lane, with the same precision as @ref Calc::FastRsqrt.
+    [[nodiscard]]
+    static Floatx8 Rsqrt(const Floatx8& a) noexcept;
+
+    /// @brief Computes @p a * @p b + @p c, using a fused multiply-add instruction when available.
+    [[nodiscard]]
+    static Floatx8 MultiplyAdd(const Floatx8& a, const Floatx8& b, const Floatx8& c) noexcept;
+
+    /// @brief Constructs a Floatx8 with all its lanes set to 0.
+    Floatx8() = default;
+
+    /// @brief Constructs a Floatx8 with all its lanes set to @p value.
+    Floatx8(float_t value) noexcept;
+
+#ifdef MATH_SIMD_AVX
+    /// @brief Constructs a Floatx8 from an AVX register.
+    explicit Floatx8(__m256 value) noexcept;
+#endif
+
+    /// @brief Stores the 8 values of this Floatx8 to @p data, which doesn't need to be aligned.
+    void Store(float_t* data) const noexcept;
+
+    /// @brief Retrieves the value of the lane at index @p lane.
+    [[nodiscard]]
+    float_t operator[](size_t lane) const;
+};
+
+/// @brief The Maskx8 struct represents 8 booleans, one per lane, e.g. the result of a comparison between two @ref Floatx8 "Floatx8s".
+///
+/// Use it with the @c Select functions of the packet types to choose values lane by lane, instead of branching.
+struct alignas(32) Maskx8
+{
+#ifdef MATH_SIMD_AVX
+    /// @brief The lanes of this Maskx8, as an AVX register whose set lanes have all their bits set.
+    __m256 value = _mm256_setzero_ps();
+#else
+    /// @brief The lanes of this Maskx8, set lanes having all their bits set.
+    uint32_t value[Floatx8::Size] = {};
+#endif
+
+    /// @brief Constructs a Maskx8 with none of its lanes set.
+    Maskx8() = default;
+
+    /// @brief Constructs a Maskx8 with all its lanes set to @p value.
+    explicit Maskx8(bool_t value) noexcept;
+
+#ifdef MATH_SIMD_AVX
+    /// @brief Constructs a Maskx8 from an AVX register, whose lanes are expected to either have all their bits set or none of them.
+    explicit Maskx8(__m256 value) noexcept;
+#endif
+
+    /// @brief Returns the lanes of this Maskx8 as bits, the bit @c i being set if the lane @c i is set.
+    [[nodiscard]]
+    uint32_t Bits() const noexcept;
+
+    /// @brief Returns whether at least one lane is set.
+    [[nodiscard]]
+    bool_t Any() const noexcept;
+
+    /// @brief Returns whether all the lanes are set.
+    [[nodiscard]]
+    bool_t All() const noexcept;
+
+    /// @brief Retrieves whether the lane at index @p lane is set.
+    [[nodiscard]]
+    bool_t operator[](size_t lane) const;
+};
+
+/// @brief Returns the opposite of a Floatx8.
+[[nodiscard]]
+inline Floatx8 operator-(const Floatx8& a) noexcept;
+
+/// @brief Adds two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Floatx8 operator+(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Subtracts two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Floatx8 operator-(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Multiplies two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Floatx8 operator*(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Divides two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Floatx8 operator/(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Adds two @ref Floatx8 "Floatx8s" according to @ref operator+(const Floatx8&, const Floatx8&), placing the result in @p a.
+inline Floatx8& operator+=(Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Subtracts two @ref Floatx8 "Floatx8s" according to @ref operator-(const Floatx8&, const Floatx8&), placing the result in @p a.
+inline Floatx8& operator-=(Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Multiplies two @ref Floatx8 "Floatx8s" according to @ref operator*(const Floatx8&, const Floatx8&), placing the result in @p a.
+inline Floatx8& operator*=(Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Divides two @ref Floatx8 "Floatx8s" according to @ref operator/(const Floatx8&, const Floatx8&), placing the result in @p a.
+inline Floatx8& operator/=(Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator==(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane. Lanes holding NaN are always different.
+[[nodiscard]]
+inline Maskx8 operator!=(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator<(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator<=(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator>(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Compares two @ref Floatx8 "Floatx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator>=(const Floatx8& a, const Floatx8& b) noexcept;
+
+/// @brief Computes the logical AND of two @ref Maskx8 "Maskx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator&(const Maskx8& a, const Maskx8& b) noexcept;
+
+/// @brief Computes the logical OR of two @ref Maskx8 "Maskx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator|(const Maskx8& a, const Maskx8& b) noexcept;
+
+/// @brief Computes the logical XOR of two @ref Maskx8 "Maskx8s" lane by lane.
+[[nodiscard]]
+inline Maskx8 operator^(const Maskx8& a, const Maskx8& b) noexcept;
+
+/// @brief Computes the logical NOT of a Maskx8 lane by lane.
+[[nodiscard]]
+inline Maskx8 operator~(const Maskx8& a) noexcept;
+
+namespace Calc
+{
+    /// @brief Clamps each lane of @p number between the matching lanes of @p min and @p max.
+    [[nodiscard]]
+    inline Floatx8 Clamp(const Floatx8& number, const Floatx8& min, const Floatx8& max) noexcept;
+
+    /// @brief Linearly interpolates between @p value and @p target, lane by lane.
+    [[nodiscard]]
+    inline Floatx8 Lerp(const Floatx8& value, const Floatx8& target, const Floatx8& time) noexcept;
+}
+
+inline Floatx8 Floatx8::Load(const float_t* const data) noexcept
+{
+    Floatx8 result;
+#ifdef MATH_SIMD_AVX
+    result.value = _mm256_loadu_ps(data);
+#else
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = data[i];
+#endif
+    return result;
+}
+
+inline Floatx8 Floatx8::Select(const Maskx8& mask, const Floatx8& ifTrue, const Floatx8& ifFalse) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_blendv_ps(ifFalse.value, ifTrue.value, mask.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = std::bit_cast<float_t>((mask.value[i] & std::bit_cast<uint32_t>(ifTrue.value[i])) | (~mask.value[i] & std::bit_cast<uint32_t>(ifFalse.value[i])));
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::Min(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_min_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = a.value[i] < b.value[i] ? a.value[i] : b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::Max(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_max_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = a.value[i] > b.value[i] ? a.value[i] : b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::Abs(const Floatx8& a) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = std::abs(a.value[i]);
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::Sqrt(const Floatx8& a) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_sqrt_ps(a.value));
+#else
+    Floatx8 result;
+#ifdef MATH_SIMD_SSE
+    // std::sqrt may set errno, which prevents the loop from being vectorized
+    for (size_t i = 0; i < Size; i += 4)
+        _mm_storeu_ps(result.value + i, _mm_sqrt_ps(_mm_loadu_ps(a.value + i)));
+#else
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = std::sqrt(a.value[i]);
+#endif
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::Rsqrt(const Floatx8& a) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(Simd::Rsqrt(a.value));
+#else
+    Floatx8 result;
+#ifdef MATH_SIMD_SSE
+    for (size_t i = 0; i < Size; i += 4)
+        _mm_storeu_ps(result.value + i, Simd::Rsqrt(_mm_loadu_ps(a.value + i)));
+#else
+    for (size_t i = 0; i < Size; i++)
+        result.value[i] = Calc::FastRsqrt(a.value[i]);
+#endif
+    return result;
+#endif
+}
+
+inline Floatx8 Floatx8::MultiplyAdd(const Floatx8& a, const Floatx8& b, const Floatx8& c) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(Simd::MultiplyAdd(a.value, b.value, c.value));
+#else
+    return a * b + c;
+#endif
+}
+
+inline Floatx8::Floatx8(const float_t value) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    this->value = _mm256_set1_ps(value);
+#else
+    for (float_t& v : this->value)
+        v = value;
+#endif
+}
+
+#ifdef MATH_SIMD_AVX
+inline Floatx8::Floatx8(const __m256 value) noexcept : value(value) {}
+#endif
+
+inline void Floatx8::Store(float_t* const data) const noexcept
+{
+#ifdef MATH_SIMD_AVX
+    _mm256_storeu_ps(data, value);
+#else
+    for (size_t i = 0; i < Size; i++)
+        data[i] = value[i];
+#endif
+}
+
+inline float_t Floatx8::operator[](const size_t lane) const
+{
+    if (lane >= Size) [[unlikely]]
+        MATH_THROW(std::out_of_range("Floatx8 subscript out of range"));
+
+#ifdef MATH_SIMD_AVX
+    alignas(32) float_t values[Size];
+    _mm256_store_ps(values, value);
+    return values[lane];
+#else
+    return value[lane];
+#endif
+}
+
+inline Maskx8::Maskx8(const bool_t value) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    this->value = _mm256_castsi256_ps(_mm256_set1_epi32(value ? -1 : 0));
+#else
+    for (uint32_t& v : this->value)
+        v = value ? ~0u : 0u;
+#endif
+}
+
+#ifdef MATH_SIMD_AVX
+inline Maskx8::Maskx8(const __m256 value) noexcept : value(value) {}
+#endif
+
+inline uint32_t Maskx8::Bits() const noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return static_cast<uint32_t>(_mm256_movemask_ps(value));
+#else
+    uint32_t bits = 0;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        bits |= (value[i] & 1u) << i;
+    return bits;
+#endif
+}
+
+inline bool_t Maskx8::Any() const noexcept { return Bits() != 0; }
+
+inline bool_t Maskx8::All() const noexcept { return Bits() == 0xFF; }
+
+inline bool_t Maskx8::operator[](const size_t lane) const
+{
+    if (lane >= Floatx8::Size) [[unlikely]]
+        MATH_THROW(std::out_of_range("Maskx8 subscript out of range"));
+
+    return (Bits() >> lane) & 1u;
+}
+
+inline Floatx8 operator-(const Floatx8& a) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_xor_ps(a.value, _mm256_set1_ps(-0.f)));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = -a.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 operator+(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_add_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] + b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 operator-(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_sub_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] - b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 operator*(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_mul_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] * b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8 operator/(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Floatx8(_mm256_div_ps(a.value, b.value));
+#else
+    Floatx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] / b.value[i];
+    return result;
+#endif
+}
+
+inline Floatx8& operator+=(Floatx8& a, const Floatx8& b) noexcept { return a = a + b; }
+
+inline Floatx8& operator-=(Floatx8& a, const Floatx8& b) noexcept { return a = a - b; }
+
+inline Floatx8& operator*=(Floatx8& a, const Floatx8& b) noexcept { return a = a * b; }
+
+inline Floatx8& operator/=(Floatx8& a, const Floatx8& b) noexcept { return a = a / b; }
+
+inline Maskx8 operator==(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_EQ_OQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] == b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator!=(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_NEQ_UQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] != b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator<(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_LT_OQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] < b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator<=(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_LE_OQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] <= b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator>(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_GT_OQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] > b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator>=(const Floatx8& a, const Floatx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_cmp_ps(a.value, b.value, _CMP_GE_OQ));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] >= b.value[i] ? ~0u : 0u;
+    return result;
+#endif
+}
+
+inline Maskx8 operator&(const Maskx8& a, const Maskx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_and_ps(a.value, b.value));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] & b.value[i];
+    return result;
+#endif
+}
+
+inline Maskx8 operator|(const Maskx8& a, const Maskx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_or_ps(a.value, b.value));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] | b.value[i];
+    return result;
+#endif
+}
+
+inline Maskx8 operator^(const Maskx8& a, const Maskx8& b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return Maskx8(_mm256_xor_ps(a.value, b.value));
+#else
+    Maskx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        result.value[i] = a.value[i] ^ b.value[i];
+    return result;
+#endif
+}
+
+inline Maskx8 operator~(const Maskx8& a) noexcept { return a ^ Maskx8(true); }
+
+inline Floatx8 Calc::Clamp(const Floatx8& number, const Floatx8& min, const Floatx8& max) noexcept
+{
+    return Floatx8::Min(Floatx8::Max(number, min), max);
+}
+
+inline Floatx8 Calc::Lerp(const Floatx8& value, const Floatx8& target, const Floatx8& time) noexcept
+{
+    return Floatx8::MultiplyAdd(target - value, time, value);
+}
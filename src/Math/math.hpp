@@ -5,21 +5,59 @@
 /// A convenient way to include all math-related headers, e.g. include all headers of this library.
 ///
 /// When building a DLL using this library, see definitions.hpp.
+///
+/// When @c MATH_HEADER_ONLY is defined, this also includes the source files of the library, so that it doesn't need to be built.
 /// </summary>
 
 #include "Math/core.hpp"
 
 #include "Math/calc.hpp"
+#include "Math/denormals.hpp"
+#include "Math/dispatch.hpp"
 
 #include "Math/easing.hpp"
+#include "Math/expression.hpp"
 
+#include "Math/affinetransform.hpp"
 #include "Math/matrix.hpp"
 #include "Math/matrix2.hpp"
 #include "Math/matrix3.hpp"
+#include "Math/matrix3a.hpp"
+#include "Math/matrixt.hpp"
 
 #include "Math/vector2.hpp"
 #include "Math/vector2i.hpp"
 #include "Math/vector3.hpp"
+#include "Math/vector3a.hpp"
 #include "Math/vector4.hpp"
+#include "Math/vectort.hpp"
 
 #include "Math/quaternion.hpp"
+#include "Math/quaterniont.hpp"
+
+#include "Math/floatx8.hpp"
+#include "Math/quaternionx8.hpp"
+#include "Math/vector2x8.hpp"
+#include "Math/vector3x8.hpp"
+
+#ifdef MATH_HEADER_ONLY
+#include "Math/calc.cpp"
+#include "Math/denormals.cpp"
+#include "Math/dispatch.cpp"
+
+#include "Math/easing.cpp"
+
+#include "Math/affinetransform.cpp"
+#include "Math/matrix.cpp"
+#include "Math/matrix2.cpp"
+#include "Math/matrix3.cpp"
+#include "Math/matrix3a.cpp"
+
+#include "Math/vector2.cpp"
+#include "Math/vector2i.cpp"
+#include "Math/vector3.cpp"
+#include "Math/vector3a.cpp"
+#include "Math/vector4.cpp"
+
+#include "Math/quaternion.cpp"
+#endif
@@ -1,155 +1,227 @@
 #include "Math/matrix.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
-Matrix Matrix::Rotation(const float_t angle, const Vector3& axis) noexcept
+/// @private
+namespace Dispatch::Internal
 {
-    return Rotation(std::cos(angle), std::sin(angle), axis);
-}
+    /// @brief Calls <c>function(begin, end)</c> on consecutive chunks of <c>[0, count)</c>, one per thread, the first chunk on the calling thread.
+    ///
+    /// @param count The number of elements to process.
+    /// @param threadCount The maximum number of threads to use, or 0 to use one per hardware thread.
+    /// @param function The function processing a chunk.
+    template <typename FunctionT>
+    void ParallelFor(const size_t count, size_t threadCount, const FunctionT& function)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        threadCount = std::min(threadCount, std::max<size_t>(count / MinimumCountPerThread, 1));
 
-void Matrix::Rotation(const float_t angle, const Vector3& axis, Matrix* result) noexcept
-{
-    Rotation(std::cos(angle), std::sin(angle), axis, result);
-}
+        if (threadCount <= 1)
+        {
+            if (count != 0)
+                function(size_t{0}, count);
+            return;
+        }
 
-Matrix Matrix::RotationX(const float_t angle) noexcept
-{
-    return RotationX(std::cos(angle), std::sin(angle));
-}
+        const size_t chunkSize = (count + threadCount - 1) / threadCount;
 
-void Matrix::RotationX(const float_t angle, Matrix* result) noexcept
-{
-    RotationX(std::cos(angle), std::sin(angle), result);
+        // The threads are joined when the vector is destroyed
+        std::vector<std::jthread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize)
+            threads.emplace_back(function, begin, std::min(begin + chunkSize, count));
+
+        function(size_t{0}, chunkSize);
+    }
 }
 
-Matrix Matrix::RotationY(const float_t angle) noexcept
+MATH_INLINE void Matrix::Rotation(const std::span<const Vector3> rotations, const std::span<Matrix> results)
 {
-    return RotationY(std::cos(angle), std::sin(angle));
+    if (results.size() < rotations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the rotation range"));
+
+    // The sines and cosines are computed by chunks to stay on the stack
+    constexpr size_t ChunkSize = 64;
+    Vector3 sines[ChunkSize], cosines[ChunkSize];
+
+    for (size_t i = 0; i < rotations.size(); i += ChunkSize)
+    {
+        const size_t count = std::min(ChunkSize, rotations.size() - i);
+        Calc::SinCos(rotations.subspan(i, count), sines, cosines);
+
+        for (size_t j = 0; j < count; j++)
+            Rotation(cosines[j], sines[j], &results[i + j]);
+    }
 }
 
-void Matrix::RotationY(const float_t angle, Matrix* result) noexcept
+MATH_INLINE void Matrix::Trs(
+    const std::span<const Vector3> translations,
+    const std::span<const Quaternion> rotations,
+    const std::span<const Vector3> scales,
+    const std::span<Matrix> results
+)
 {
-    RotationY(std::cos(angle), std::sin(angle), result);
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float_t), "Quaternion must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(Matrix) == 16 * sizeof(float_t), "Matrix must be tightly packed to be used as an array of float_t");
+
+    if (rotations.size() != translations.size() || scales.size() != translations.size())
+        MATH_THROW(std::invalid_argument("The translation, rotation and scaling ranges must have the same size"));
+
+    if (results.size() < translations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the translation range"));
+
+    if (translations.empty())
+        return;
+
+    Dispatch::GetKernels().composeTrs4x4(translations.front().Data(), rotations.front().Data(), scales.front().Data(), results.front().Data(), translations.size());
 }
 
-Matrix Matrix::RotationZ(const float_t angle) noexcept
+MATH_INLINE void Matrix::InvertedTrs(
+    const std::span<const Vector3> translations,
+    const std::span<const Quaternion> rotations,
+    const std::span<const Vector3> scales,
+    const std::span<Matrix> results
+)
 {
-    return RotationZ(std::cos(angle), std::sin(angle));
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float_t), "Quaternion must be tightly packed to be used as an array of float_t");
+    static_assert(sizeof(Matrix) == 16 * sizeof(float_t), "Matrix must be tightly packed to be used as an array of float_t");
+
+    if (rotations.size() != translations.size() || scales.size() != translations.size())
+        MATH_THROW(std::invalid_argument("The translation, rotation and scaling ranges must have the same size"));
+
+    if (results.size() < translations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the translation range"));
+
+    if (translations.empty())
+        return;
+
+    Dispatch::GetKernels().composeInvertedTrs4x4(translations.front().Data(), rotations.front().Data(), scales.front().Data(), results.front().Data(), translations.size());
 }
 
-void Matrix::RotationZ(const float_t angle, Matrix* result) noexcept
+MATH_INLINE void Matrix::InvertedRigid(const std::span<const Matrix> matrices, const std::span<Matrix> results)
 {
-    RotationZ(std::cos(angle), std::sin(angle), result);
+    static_assert(sizeof(Matrix) == 16 * sizeof(float_t), "Matrix must be tightly packed to be used as an array of float_t");
+
+    if (results.size() < matrices.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the matrix range"));
+
+    if (matrices.empty())
+        return;
+
+    Dispatch::GetKernels().invertRigidMatrices(matrices.front().Data(), results.front().Data(), matrices.size());
 }
 
-Matrix Matrix::Rotation(const Vector3& rotation) noexcept
+MATH_INLINE void Matrix::CameraRelative(const std::span<const Matrixd> transformations, const Vector3d& cameraPosition, const std::span<Matrix> results)
 {
-    return RotationZ(rotation.z)
-         * RotationY(rotation.y)
-         * RotationX(rotation.x);
+    if (results.size() < transformations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the transformation range"));
+
+    for (size_t i = 0; i < transformations.size(); i++)
+        CameraRelative(transformations[i], cameraPosition, &results[i]);
 }
 
-void Matrix::Rotation(const Vector3& rotation, Matrix* result) noexcept
+MATH_INLINE void Matrix::CameraRelativeTrs(
+    const std::span<const Vector3d> translations,
+    const std::span<const Quaterniond> rotations,
+    const std::span<const Vector3d> scales,
+    const Vector3d& cameraPosition,
+    const std::span<Matrix> results
+)
 {
-    RotationZ(rotation.z, result);
-    Matrix temp;
-    RotationY(rotation.y, &temp);
-    *result *= temp;
-    RotationX(rotation.x, &temp);
-    *result *= temp;
+    if (rotations.size() != translations.size() || scales.size() != translations.size())
+        MATH_THROW(std::invalid_argument("The translation, rotation and scaling ranges must have the same size"));
+
+    if (results.size() < translations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the translation range"));
+
+    for (size_t i = 0; i < translations.size(); i++)
+        CameraRelativeTrs(translations[i], rotations[i], scales[i], cameraPosition, &results[i]);
 }
 
-Matrix Matrix::Rotation(const float_t cos, const float_t sin, const Vector3& axis) noexcept
+MATH_INLINE void Matrix::Multiply(const Matrix& lhs, const std::span<const Matrix> rhs, const std::span<Matrix> results, const size_t threadCount)
 {
-    const float_t c2 = 1.f - cos;
-    Vector3 v = axis.Normalized();
-
-    return Matrix(
-        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin, 0.f,
-        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin, 0.f,
-        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos, 0.f,
-        0.f, 0.f, 0.f,                                                              1.f
+    static_assert(sizeof(Matrix) == 16 * sizeof(float_t), "Matrix must be tightly packed to be used as an array of float_t");
+
+    if (results.size() < rhs.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the matrix range"));
+
+    // lhs may be one of the results, which another chunk could overwrite while it is still being read
+    const Matrix shared = lhs;
+
+    // Each column of a product is lhs times the same column of rhs, so all the columns are transformed at once
+    const Dispatch::Kernels& kernels = Dispatch::GetKernels();
+    Dispatch::Internal::ParallelFor(
+        rhs.size(),
+        threadCount,
+        [&](const size_t begin, const size_t end) { kernels.transformVectors4(shared.Data(), rhs[begin].Data(), results[begin].Data(), (end - begin) * 4); }
     );
 }
 
-void Matrix::Rotation(const float_t cos, const float_t sin, const Vector3& axis, Matrix* result) noexcept
+MATH_INLINE void Matrix::Multiply(const std::span<const Matrix> lhs, const Matrix& rhs, const std::span<Matrix> results, const size_t threadCount)
 {
-    const float_t c2 = 1.f - cos;
-    Vector3 v = axis.Normalized();
-
-    *result = Matrix(
-        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin, 0.f,
-        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin, 0.f,
-        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos, 0.f,
-        0.f, 0.f, 0.f,                                                              1.f
+    static_assert(sizeof(Matrix) == 16 * sizeof(float_t), "Matrix must be tightly packed to be used as an array of float_t");
+
+    if (results.size() < lhs.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the matrix range"));
+
+    // rhs may be one of the results, which another chunk could overwrite while it is still being read
+    const Matrix shared = rhs;
+
+    const Dispatch::Kernels& kernels = Dispatch::GetKernels();
+    Dispatch::Internal::ParallelFor(
+        lhs.size(),
+        threadCount,
+        [&](const size_t begin, const size_t end) { kernels.multiplyMatricesByMatrix(lhs[begin].Data(), shared.Data(), results[begin].Data(), end - begin); }
     );
 }
 
-Matrix Matrix::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept
+MATH_INLINE void Matrix::TransformPoints(const std::span<const Vector3> points, const std::span<Vector3> results) const
 {
-    return Trs(translation, Rotation(rotation), scale);
-}
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
 
-void Matrix::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, Matrix* result) noexcept
-{
-    Trs(translation, Rotation(rotation), scale, result);
-}
+    if (results.size() < points.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the point range"));
 
-Matrix Matrix::Trs(const Vector3& translation, const float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept
-{
-    return Trs(translation, Rotation(rotationAngle, rotationAxis), scale);
-}
+    if (points.empty())
+        return;
 
-void Matrix::Trs(const Vector3& translation, const float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale, Matrix* result) noexcept
-{
-    Trs(translation, Rotation(rotationAngle, rotationAxis), scale, result);
+    Dispatch::GetKernels().transformPoints3(Data(), points.front().Data(), results.front().Data(), points.size());
 }
 
-Matrix Matrix::LookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept
+MATH_INLINE void Matrix::TransformDirections(const std::span<const Vector3> directions, const std::span<Vector3> results) const
 {
-    Matrix result;
-    LookAt(eye, center, up, &result);
-    return result;
-}
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
 
-void Matrix::LookAt(const Vector3& eye, const Vector3& center, const Vector3& up, Matrix* result) noexcept
-{
-    const Vector3 f((center - eye).Normalized());
-    const Vector3 s(Vector3::Cross(f, up).Normalized());
-    const Vector3 u(Vector3::Cross(s, f));
-
-    *result = Matrix(
-        s.x, s.y, s.z, -Vector3::Dot(s, eye),
-        u.x, u.y, u.z, -Vector3::Dot(u, eye),
-        -f.x, -f.y, -f.z, Vector3::Dot(f, eye),
-        0.f, 0.f, 0.f, 1.f
-    );
-}
+    if (results.size() < directions.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the direction range"));
 
-Matrix Matrix::Perspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far)
-{
-    Matrix result;
-    Perspective(fov, aspectRatio, near, far, &result);
-    return result;
+    if (directions.empty())
+        return;
+
+    Dispatch::GetKernels().transformDirections3(Data(), directions.front().Data(), results.front().Data(), directions.size());
 }
 
-void Matrix::Perspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far, Matrix* result)
+MATH_INLINE void Matrix::TransformPointsProjective(const std::span<const Vector3> points, const std::span<Vector3> results) const
 {
-    if (near > far) [[unlikely]]
-        throw std::invalid_argument("Near must be smaller than far.");
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
 
-    const float_t range = far - near;
-    const float_t tanHalfFov = std::tan(fov / 2.f);
+    if (results.size() < points.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the point range"));
 
-    *result = Matrix(
-        1.f / (tanHalfFov * aspectRatio), 0.f, 0.f, 0.f,
-        0.f, 1.f / tanHalfFov, 0.f, 0.f,
-        0.f, 0.f, -(far + near) / range, -(2.f * far * near) / range,
-        0.f, 0.f, -1.f, 0.f
-    );
+    if (points.empty())
+        return;
+
+    Dispatch::GetKernels().transformPointsProjective3(Data(), points.front().Data(), results.front().Data(), points.size());
 }
 
-bool_t Matrix::Decompose(
+MATH_INLINE bool_t Matrix::Decompose(
     Vector3* const translation,
     Quaternion* const orientation,
     Vector3* const scale,
@@ -286,7 +358,7 @@ bool_t Matrix::Decompose(
     return true;
 }
 
-void Matrix::DebugPrint() const noexcept
+MATH_INLINE void Matrix::DebugPrint() const noexcept
 {
     std::cout << "{ "
         << m00 << ' ' << m10 << ' ' << m20 << ' ' << m30 << " }\n{ "
@@ -295,7 +367,7 @@ void Matrix::DebugPrint() const noexcept
         << m03 << ' ' << m13 << ' ' << m23 << ' ' << m33 << " }\n";
 }
 
-std::ostream& operator<<(std::ostream &out, const Matrix &m)
+MATH_INLINE std::ostream& operator<<(std::ostream &out, const Matrix &m)
 {
     return out << "{ { " << m.m00 << ' ' << m.m01 << ' ' << m.m02 << ' ' << m.m03 << " } { "
                         << m.m10 << ' ' << m.m11 << ' ' << m.m12 << ' ' << m.m13 << " } { "
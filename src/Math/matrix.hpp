@@ -1,13 +1,19 @@
 #pragma once
 
 #include <format>
+#include <optional>
 #include <sstream>
 
 #include <ostream>
+#include <type_traits>
 
 #include "Math/calc.hpp"
+#include "Math/dispatch.hpp"
+#include "Math/expression.hpp"
 #include "Math/matrix3.hpp"
+#include "Math/matrixt.hpp"
 #include "Math/quaternion.hpp"
+#include "Math/simd.hpp"
 #include "Math/vector3.hpp"
 #include "Math/vector4.hpp"
 
@@ -17,7 +23,10 @@
 /// @brief The Matrix struct represents a 4x4 array mainly used for mathematical operations.
 ///
 /// Matrices are stored using the column-major convention.
-struct MATH_TOOLBOX Matrix
+/// This is the 4x4 float specialization of MatrixT, which provides the other shapes and value types.
+/// When @c MATH_SIMD_ALIGN is defined, this struct is 16-byte aligned so that its columns can be used as aligned @ref Vector4 "Vector4s".
+template <>
+struct MATH_TOOLBOX MATH_SIMD_ALIGNAS MatrixT<4, 4, float_t>
 {
     /// @brief The component at position [0, 0] of a Matrix.
     float_t m00 = 0.f;
@@ -90,26 +99,26 @@ struct MATH_TOOLBOX Matrix
     /// @param angle The angle in radians.
     /// @param axis The axis around which the rotation occurs.
     [[nodiscard]]
-    static Matrix Rotation(float_t angle, const Vector3& axis) noexcept;
+    static constexpr Matrix Rotation(float_t angle, const Vector3& axis) noexcept;
 
     /// @brief Creates a 3D rotation Matrix from the given angle and axis.
     ///
     /// @param angle The angle in radians.
     /// @param axis The axis around which the rotation occurs.
     /// @param result The output of the function.
-    static void Rotation(float_t angle, const Vector3& axis, Matrix* result) noexcept;
+    static constexpr void Rotation(float_t angle, const Vector3& axis, Matrix* result) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the X axis from the given angle.
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix RotationX(float_t angle) noexcept;
+    static constexpr Matrix RotationX(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the X axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationX(float_t angle, Matrix* result) noexcept;
+    static constexpr void RotationX(float_t angle, Matrix* result) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the X axis from the given angle.
     ///
@@ -129,13 +138,13 @@ struct MATH_TOOLBOX Matrix
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix RotationY(float_t angle) noexcept;
+    static constexpr Matrix RotationY(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the Y axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationY(float_t angle, Matrix* result) noexcept;
+    static constexpr void RotationY(float_t angle, Matrix* result) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the Y axis from the given angle.
     ///
@@ -155,13 +164,13 @@ struct MATH_TOOLBOX Matrix
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix RotationZ(float_t angle) noexcept;
+    static constexpr Matrix RotationZ(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the Z axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationZ(float_t angle, Matrix* result) noexcept;
+    static constexpr void RotationZ(float_t angle, Matrix* result) noexcept;
 
     /// @brief Creates a 3D rotation Matrix around the Z axis from the given angle.
     ///
@@ -179,10 +188,38 @@ struct MATH_TOOLBOX Matrix
 
     /// @brief Creates a 3D rotation Matrix from the given angle for each of the x, y, and z axis.
     [[nodiscard]]
-    static Matrix Rotation(const Vector3& rotation) noexcept;
+    static constexpr Matrix Rotation(const Vector3& rotation) noexcept;
 
     /// @brief Creates a 3D rotation Matrix from the given angle for each of the x, y, and z axis.
-    static void Rotation(const Vector3& rotation, Matrix* result) noexcept;
+    static constexpr void Rotation(const Vector3& rotation, Matrix* result) noexcept;
+
+    /// @brief Creates a 3D rotation Matrix from the cosines and sines of the angles around each of the x, y, and z axis.
+    ///
+    /// This is the closed form of @code RotationZ(z) * RotationY(y) * RotationX(x)@endcode.
+    ///
+    /// @param cos The cosines of the angles in radians.
+    /// @param sin The sines of the angles in radians.
+    [[nodiscard]]
+    static constexpr Matrix Rotation(const Vector3& cos, const Vector3& sin) noexcept;
+
+    /// @brief Creates a 3D rotation Matrix from the cosines and sines of the angles around each of the x, y, and z axis.
+    ///
+    /// This is the closed form of @code RotationZ(z) * RotationY(y) * RotationX(x)@endcode.
+    ///
+    /// @param cos The cosines of the angles in radians.
+    /// @param sin The sines of the angles in radians.
+    /// @param result The output of the function.
+    static constexpr void Rotation(const Vector3& cos, const Vector3& sin, Matrix* result) noexcept;
+
+    /// @brief Creates a 3D rotation Matrix for each of the given angles around the x, y, and z axis.
+    ///
+    /// The sines and cosines of all the angles are computed using @ref Calc::SinCos(std::span<const Vector3>, std::span<Vector3>, std::span<Vector3>).
+    ///
+    /// @param rotations The angles in radians.
+    /// @param results The output of the function.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p rotations.
+    static void Rotation(std::span<const Vector3> rotations, std::span<Matrix> results);
 
     /// @brief	Creates a 3D rotation Matrix from the given rotation Quaternion.
     [[nodiscard]]
@@ -197,7 +234,7 @@ struct MATH_TOOLBOX Matrix
     /// @param sin The sine of the angle in radians.
     /// @param axis The axis around which the rotation occurs.
     [[nodiscard]]
-    static Matrix Rotation(float_t cos, float_t sin, const Vector3& axis) noexcept;
+    static constexpr Matrix Rotation(float_t cos, float_t sin, const Vector3& axis) noexcept;
 
     /// @brief Creates a 3D rotation matrix from the given cosine, sine and axis.
     ///
@@ -205,7 +242,7 @@ struct MATH_TOOLBOX Matrix
     /// @param sin The sine of the angle in radians.
     /// @param axis The axis around which the rotation occurs.
     /// @param result The output of the function.
-    static void Rotation(float_t cos, float_t sin, const Vector3& axis, Matrix* result) noexcept;
+    static constexpr void Rotation(float_t cos, float_t sin, const Vector3& axis, Matrix* result) noexcept;
 
     /// @brief Creates a 3D scaling matrix from the given Vector3.
     [[nodiscard]]
@@ -216,17 +253,17 @@ struct MATH_TOOLBOX Matrix
 
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
     [[nodiscard]]
-    static Matrix Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept;
+    static constexpr Matrix Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept;
 
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
-    static void Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, Matrix* result) noexcept;
+    static constexpr void Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, Matrix* result) noexcept;
 
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
     [[nodiscard]]
-    static Matrix Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept;
+    static constexpr Matrix Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept;
 
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
-    static void Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale, Matrix* result) noexcept;
+    static constexpr void Trs(const Vector3& translation, float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale, Matrix* result) noexcept;
 
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
     [[nodiscard]]
@@ -242,23 +279,137 @@ struct MATH_TOOLBOX Matrix
     /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix from the given translation, rotation and scaling.
     static constexpr void Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, Matrix* result) noexcept;
 
+    /// @brief Creates a Translation-Rotation-Scaling (TRS) matrix for each of the given translations, rotations and scalings.
+    ///
+    /// The matrices are created 8 at a time using the best instruction set of the CPU, see Dispatch::GetKernels,
+    /// which makes this a good fit for animation outputs stored as separate ranges.
+    ///
+    /// @param translations The translations.
+    /// @param rotations The rotations.
+    /// @param scales The scalings.
+    /// @param results The output of the function.
+    ///
+    /// @throws std::invalid_argument If @p translations, @p rotations and @p scales don't have the same size, or if @p results is smaller than them.
+    /// @see Trs(const Vector3&, const Quaternion&, const Vector3&)
+    static void Trs(std::span<const Vector3> translations, std::span<const Quaternion> rotations, std::span<const Vector3> scales, std::span<Matrix> results);
+
+    /// @brief Creates the inverse of the Translation-Rotation-Scaling (TRS) matrix of the given translation, rotation and scaling.
+    ///
+    /// This computes <c>Scaling(1 / scale) * Rotation(rotation.Conjugate()) * Translation(-translation)</c> directly,
+    /// which is a lot cheaper than <c>Trs(translation, rotation, scale).Inverted()</c> and never fails.
+    /// A scaling with a zero component gives infinite or NaN components.
+    ///
+    /// @param translation The translation.
+    /// @param rotation The rotation, which must be normalized.
+    /// @param scale The scaling.
+    [[nodiscard]]
+    static constexpr Matrix InvertedTrs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept;
+
+    /// @brief Creates the inverse of the Translation-Rotation-Scaling (TRS) matrix of the given translation, rotation and scaling.
+    ///
+    /// @see InvertedTrs(const Vector3&, const Quaternion&, const Vector3&)
+    static constexpr void InvertedTrs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, Matrix* result) noexcept;
+
+    /// @brief Creates the inverse of the Translation-Rotation-Scaling (TRS) matrix for each of the given translations, rotations and scalings.
+    ///
+    /// The matrices are created 8 at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+    ///
+    /// @throws std::invalid_argument If @p translations, @p rotations and @p scales don't have the same size, or if @p results is smaller than them.
+    /// @see InvertedTrs(const Vector3&, const Quaternion&, const Vector3&)
+    static void InvertedTrs(std::span<const Vector3> translations, std::span<const Quaternion> rotations, std::span<const Vector3> scales, std::span<Matrix> results);
+
+    /// @brief Converts a double world transformation into a float transformation relative to the camera.
+    ///
+    /// This is @code Translation(-cameraPosition) * transformation@endcode, computed in double before the conversion to float,
+    /// so that objects far away from the origin keep their precision when they are close to the camera.
+    ///
+    /// @param transformation The world transformation.
+    /// @param cameraPosition The world position of the camera.
+    [[nodiscard]]
+    static constexpr Matrix CameraRelative(const Matrixd& transformation, const Vector3d& cameraPosition) noexcept;
+
+    /// @brief Converts a double world transformation into a float transformation relative to the camera.
+    ///
+    /// @param transformation The world transformation.
+    /// @param cameraPosition The world position of the camera.
+    /// @param result The output of the function.
+    /// @see CameraRelative(const Matrixd&, const Vector3d&)
+    static constexpr void CameraRelative(const Matrixd& transformation, const Vector3d& cameraPosition, Matrix* result) noexcept;
+
+    /// @brief Converts each of the given double world transformations into a float transformation relative to the camera.
+    ///
+    /// @param transformations The world transformations.
+    /// @param cameraPosition The world position of the camera.
+    /// @param results The output of the function.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p transformations.
+    /// @see CameraRelative(const Matrixd&, const Vector3d&)
+    static void CameraRelative(std::span<const Matrixd> transformations, const Vector3d& cameraPosition, std::span<Matrix> results);
+
+    /// @brief Creates a float TRS matrix relative to the camera from a double world translation, rotation and scaling.
+    ///
+    /// The camera position is subtracted from the translation in double, so the world translation is never converted to float.
+    ///
+    /// @param translation The world translation.
+    /// @param rotation The world rotation.
+    /// @param scale The world scaling.
+    /// @param cameraPosition The world position of the camera.
+    [[nodiscard]]
+    static constexpr Matrix CameraRelativeTrs(const Vector3d& translation, const Quaterniond& rotation, const Vector3d& scale, const Vector3d& cameraPosition) noexcept;
+
+    /// @brief Creates a float TRS matrix relative to the camera from a double world translation, rotation and scaling.
+    ///
+    /// @param translation The world translation.
+    /// @param rotation The world rotation.
+    /// @param scale The world scaling.
+    /// @param cameraPosition The world position of the camera.
+    /// @param result The output of the function.
+    /// @see CameraRelativeTrs(const Vector3d&, const Quaterniond&, const Vector3d&, const Vector3d&)
+    static constexpr void CameraRelativeTrs(const Vector3d& translation, const Quaterniond& rotation, const Vector3d& scale, const Vector3d& cameraPosition, Matrix* result) noexcept;
+
+    /// @brief Creates a float TRS matrix relative to the camera for each of the given double world translations, rotations and scalings.
+    ///
+    /// @param translations The world translations.
+    /// @param rotations The world rotations.
+    /// @param scales The world scalings.
+    /// @param cameraPosition The world position of the camera.
+    /// @param results The output of the function.
+    ///
+    /// @throws std::invalid_argument If @p translations, @p rotations and @p scales don't have the same size, or if @p results is smaller than them.
+    /// @see CameraRelativeTrs(const Vector3d&, const Quaterniond&, const Vector3d&, const Vector3d&)
+    static void CameraRelativeTrs(
+        std::span<const Vector3d> translations,
+        std::span<const Quaterniond> rotations,
+        std::span<const Vector3d> scales,
+        const Vector3d& cameraPosition,
+        std::span<Matrix> results
+    );
+
     /// @brief Creates a view Matrix, looking from an @c eye to a @c center using an @c up vector.
     [[nodiscard]]
-    static Matrix LookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept;
+    static constexpr Matrix LookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept;
 
     /// @brief Creates a view Matrix, looking from an @c eye to a @c center using an @c up vector.
-    static void LookAt(const Vector3& eye, const Vector3& center, const Vector3& up, Matrix* result) noexcept;
+    static constexpr void LookAt(const Vector3& eye, const Vector3& center, const Vector3& up, Matrix* result) noexcept;
 
     /// @brief Creates a perspective projection Matrix from the given @c fov (Field Of View) and aspect ratio.
     ///
     ///	Anything closer than @c near or further than @c far is discarded.
     [[nodiscard]]
-    static Matrix Perspective(float_t fov, float_t aspectRatio, float_t near, float_t far);
+    static constexpr Matrix Perspective(float_t fov, float_t aspectRatio, float_t near, float_t far);
 
     /// @brief Creates a perspective projection Matrix from the given @c fov (Field Of View) and aspect ratio.
     ///
     ///	Anything closer than @c near or further than @c far is discarded.
-    static void Perspective(float_t fov, float_t aspectRatio, float_t near, float_t far, Matrix* result);
+    static constexpr void Perspective(float_t fov, float_t aspectRatio, float_t near, float_t far, Matrix* result);
+
+    /// @brief Creates a perspective projection Matrix like Perspective(), but returns @c std::nullopt instead of throwing if @p near is greater than @p far.
+    [[nodiscard]]
+    static constexpr std::optional<Matrix> TryPerspective(float_t fov, float_t aspectRatio, float_t near, float_t far) noexcept;
+
+    /// @brief Creates a perspective projection Matrix like Perspective(), but returns @c false instead of throwing if @p near is greater than @p far, leaving @p result unchanged.
+    [[nodiscard]]
+    static constexpr bool_t TryPerspective(float_t fov, float_t aspectRatio, float_t near, float_t far, Matrix* result) noexcept;
 
     /// @brief Creates an orthographic projection Matrix from the given @c left, @c right, @c bottom, and @c top screen positions.
     ///
@@ -271,21 +422,65 @@ struct MATH_TOOLBOX Matrix
     ///	Anything closer than @c near or further than @c far is discarded.
     static constexpr void Orthographic(float_t left, float_t right, float_t bottom, float_t top, float_t near, float_t far, Matrix* result);
 
+    /// @brief Creates an orthographic projection Matrix like Orthographic(), but returns @c std::nullopt instead of throwing if @p near is greater than @p far.
+    [[nodiscard]]
+    static constexpr std::optional<Matrix> TryOrthographic(float_t left, float_t right, float_t bottom, float_t top, float_t near, float_t far) noexcept;
+
+    /// @brief Creates an orthographic projection Matrix like Orthographic(), but returns @c false instead of throwing if @p near is greater than @p far, leaving @p result unchanged.
+    [[nodiscard]]
+    static constexpr bool_t TryOrthographic(float_t left, float_t right, float_t bottom, float_t top, float_t near, float_t far, Matrix* result) noexcept;
+
+    /// @brief Multiplies two @ref Matrix "Matrices", e.g. computes @p lhs * @p rhs right away.
+    ///
+    /// Both @ref operator*(const Matrix&, const Matrix&) and the evaluation of a MatrixProduct rely on this.
+    /// Uses SIMD instructions when @c MATH_SIMD_SSE is defined and the call isn't constant-evaluated.
+    ///
+    /// @param lhs The left-hand side of the product.
+    /// @param rhs The right-hand side of the product.
+    /// @param result The output of the function. May be @p lhs or @p rhs.
+    static constexpr void Multiply(const Matrix& lhs, const Matrix& rhs, Matrix* result) noexcept;
+
+    /// @brief Multiplies a shared Matrix by each of the given @ref Matrix "Matrices", e.g. computes <c>lhs * rhs[i]</c>, like <c>viewProjection * models[i]</c>.
+    ///
+    /// @p lhs stays in registers while the products are computed using the best instruction set of the CPU, see Dispatch::GetKernels.
+    /// Large ranges can be split across several threads, each of them being given at least Dispatch::MinimumCountPerThread matrices.
+    ///
+    /// @param lhs The left-hand side of every product. It is copied first, so it may be one of the @p results.
+    /// @param rhs The right-hand sides of the products.
+    /// @param results The output of the function. May be @p rhs.
+    /// @param threadCount The maximum number of threads to use, or 0 to use one per hardware thread.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p rhs.
+    static void Multiply(const Matrix& lhs, std::span<const Matrix> rhs, std::span<Matrix> results, size_t threadCount = 1);
+
+    /// @brief Multiplies each of the given @ref Matrix "Matrices" by a shared Matrix, e.g. computes <c>lhs[i] * rhs</c>.
+    ///
+    /// @p rhs stays in registers while the products are computed using the best instruction set of the CPU, see Dispatch::GetKernels.
+    /// Large ranges can be split across several threads, each of them being given at least Dispatch::MinimumCountPerThread matrices.
+    ///
+    /// @param lhs The left-hand sides of the products.
+    /// @param rhs The right-hand side of every product. It is copied first, so it may be one of the @p results.
+    /// @param results The output of the function. May be @p lhs.
+    /// @param threadCount The maximum number of threads to use, or 0 to use one per hardware thread.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p lhs.
+    static void Multiply(std::span<const Matrix> lhs, const Matrix& rhs, std::span<Matrix> results, size_t threadCount = 1);
+
     /// @brief Creates a Matrix with all its values set to 0.
-    constexpr Matrix() = default;
+    constexpr MatrixT() = default;
 
     /// @brief Creates a Matrix with all its values set to this default value.
-    constexpr explicit Matrix(float_t defaultValue) noexcept;
+    constexpr explicit MatrixT(float_t defaultValue) noexcept;
 
     /// @brief Constructs a Matrix with its components set to the data pointed by @c data.
     ///
     /// This constructor assumes that @c data is a valid pointer pointing to at least 16 @c float_t values.
     ///
     /// @param data The data where the values for this matrix's components are located.
-    constexpr explicit Matrix(const float_t* data) noexcept;
+    constexpr explicit MatrixT(const float_t* data) noexcept;
 
     /// @brief Constructs a Matrix with 4 column vectors.
-    constexpr Matrix(
+    constexpr MatrixT(
         const Vector4& c0,
         const Vector4& c1,
         const Vector4& c2,
@@ -293,7 +488,7 @@ struct MATH_TOOLBOX Matrix
     ) noexcept;
 
     /// @brief Constructs a Matrix with 16 float_t values.
-    constexpr Matrix(
+    constexpr MatrixT(
         float_t m00, float_t m01, float_t m02, float_t m03,
         float_t m10, float_t m11, float_t m12, float_t m13,
         float_t m20, float_t m21, float_t m22, float_t m23,
@@ -366,6 +561,55 @@ struct MATH_TOOLBOX Matrix
     /// @brief Computes the invert of this Matrix, e.g. @c *this * Inverted() == Identity() is true.
     constexpr void Inverted(Matrix* result) const;
 
+    /// @brief Computes the invert of this Matrix like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<Matrix> TryInverted() const noexcept;
+
+    /// @brief Computes the invert of this Matrix like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(Matrix* result) const noexcept;
+
+    /// @brief Computes the invert of this Matrix assuming it is affine, e.g. its last row is (0, 0, 0, 1).
+    ///
+    /// This only inverts the upper-left 3x3 part and transforms the translation accordingly,
+    /// which is a lot cheaper than Inverted(). Use it for model and view matrices.
+    [[nodiscard]]
+    constexpr Matrix InvertedAffine() const;
+
+    /// @brief Computes the invert of this Matrix assuming it is affine, e.g. its last row is (0, 0, 0, 1).
+    ///
+    /// This only inverts the upper-left 3x3 part and transforms the translation accordingly,
+    /// which is a lot cheaper than Inverted(). Use it for model and view matrices.
+    constexpr void InvertedAffine(Matrix* result) const;
+
+    /// @brief Computes the invert of this Matrix like InvertedAffine(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<Matrix> TryInvertedAffine() const noexcept;
+
+    /// @brief Computes the invert of this Matrix like InvertedAffine(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInvertedAffine(Matrix* result) const noexcept;
+
+    /// @brief Computes the invert of this Matrix assuming it is rigid, e.g. it is only made of a rotation and a translation, like a view matrix.
+    ///
+    /// The inverse is the transposed rotation with the opposite of the rotated translation,
+    /// so this never fails and is a lot cheaper than InvertedAffine(). Use InvertedTrs() for matrices with a scaling.
+    [[nodiscard]]
+    constexpr Matrix InvertedRigid() const noexcept;
+
+    /// @brief Computes the invert of this Matrix assuming it is rigid, e.g. it is only made of a rotation and a translation, like a view matrix.
+    ///
+    /// @p result may point to this Matrix.
+    constexpr void InvertedRigid(Matrix* result) const noexcept;
+
+    /// @brief Computes the invert of each of the given rigid @ref Matrix "Matrices", like InvertedRigid() const.
+    ///
+    /// @param matrices The matrices to invert.
+    /// @param results The output of the function. May be @p matrices.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p matrices.
+    static void InvertedRigid(std::span<const Matrix> matrices, std::span<Matrix> results);
+
     /// @brief Decomposes this Matrix (assuming this is a model matrix) into its components.
     ///
     /// This is a heavy operation, try to avoid using this each frame.
@@ -378,6 +622,38 @@ struct MATH_TOOLBOX Matrix
     /// @return @c false if the operation failed
     bool_t Decompose(Vector3* translation, Quaternion* orientation, Vector3* scale, Vector3* skew, Vector4* perspective) const;
 
+    /// @brief Transforms each of the given points by this Matrix, e.g. computes <c>*this * points[i]</c> with an implicit @c w of 1.
+    ///
+    /// The last row of this Matrix is ignored, so it should be affine. Use TransformPointsProjective() otherwise.
+    /// The points are transformed 8 at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+    ///
+    /// @param points The points to transform.
+    /// @param results The output of the function. May be @p points.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p points.
+    void TransformPoints(std::span<const Vector3> points, std::span<Vector3> results) const;
+
+    /// @brief Transforms each of the given directions by this Matrix, e.g. computes <c>*this * directions[i]</c> with an implicit @c w of 0.
+    ///
+    /// The translation of this Matrix is ignored, as well as its last row.
+    ///
+    /// @param directions The directions to transform.
+    /// @param results The output of the function. May be @p directions.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p directions.
+    void TransformDirections(std::span<const Vector3> directions, std::span<Vector3> results) const;
+
+    /// @brief Transforms each of the given points by this Matrix with an implicit @c w of 1, and divides the result by its @c w component.
+    ///
+    /// This is how a projection Matrix maps points to normalized device coordinates.
+    /// Points whose transformed @c w is zero give infinite or NaN components.
+    ///
+    /// @param points The points to transform.
+    /// @param results The output of the function. May be @p points.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p points.
+    void TransformPointsProjective(std::span<const Vector3> points, std::span<Vector3> results) const;
+
     /// @brief Retrieves this matrix's value at position @c [col, row].
     ///
     /// @param row The index of the col to get.
@@ -394,6 +670,16 @@ struct MATH_TOOLBOX Matrix
     [[nodiscard]]
     constexpr float_t& At(size_t row, size_t col);
 
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t row, size_t col) noexcept;
+
     /// @brief Retrieves this matrix's column vector at position @c col.
     ///
     ///	If you want to get a value of this matrix, consider using <see cref="At(size_t, size_t)"/>
@@ -425,7 +711,7 @@ static_assert(std::is_move_constructible_v<Matrix>, "Class Matrix must be move c
 static_assert(std::is_copy_assignable_v<Matrix>, "Class Matrix must be copy assignable.");
 static_assert(std::is_move_assignable_v<Matrix>, "Class Matrix must be move assignable.");
 
-constexpr Matrix::Matrix(const float_t defaultValue) noexcept
+constexpr Matrix::MatrixT(const float_t defaultValue) noexcept
     : m00(defaultValue), m10(defaultValue), m20(defaultValue), m30(defaultValue)
     , m01(defaultValue), m11(defaultValue), m21(defaultValue), m31(defaultValue)
     , m02(defaultValue), m12(defaultValue), m22(defaultValue), m32(defaultValue)
@@ -433,7 +719,7 @@ constexpr Matrix::Matrix(const float_t defaultValue) noexcept
 {
 }
 
-constexpr Matrix::Matrix(const float_t* const data) noexcept
+constexpr Matrix::MatrixT(const float_t* const data) noexcept
     : m00(data[0]), m10(data[1]), m20(data[2]), m30(data[3])
     , m01(data[4]), m11(data[5]), m21(data[6]), m31(data[7])
     , m02(data[8]), m12(data[9]), m22(data[10]), m32(data[11])
@@ -441,7 +727,7 @@ constexpr Matrix::Matrix(const float_t* const data) noexcept
 {
 }
 
-constexpr Matrix::Matrix(const Vector4& c0, const Vector4& c1, const Vector4& c2, const Vector4& c3) noexcept
+constexpr Matrix::MatrixT(const Vector4& c0, const Vector4& c1, const Vector4& c2, const Vector4& c3) noexcept
     : m00(c0.x), m10(c1.x), m20(c2.x), m30(c3.x)
     , m01(c0.y), m11(c1.y), m21(c2.y), m31(c3.y)
     , m02(c0.z), m12(c1.z), m22(c2.z), m32(c3.z)
@@ -449,7 +735,7 @@ constexpr Matrix::Matrix(const Vector4& c0, const Vector4& c1, const Vector4& c2
 {
 }
 
-constexpr Matrix::Matrix(
+constexpr Matrix::MatrixT(
     const float_t m00, const float_t m01, const float_t m02, const float_t m03,
     const float_t m10, const float_t m11, const float_t m12, const float_t m13,
     const float_t m20, const float_t m21, const float_t m22, const float_t m23,
@@ -539,42 +825,67 @@ constexpr Vector3 operator*(const Matrix& m, const Vector3& v) noexcept
 }
 
 /// @brief Multiplies a Vector4 by a Matrix.
+///
+/// Uses SIMD instructions when @c MATH_SIMD_SSE is defined and the call isn't constant-evaluated.
 [[nodiscard]]
 constexpr Vector4 operator*(const Matrix& m, const Vector4& v) noexcept
 {
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Vector4 result;
+        Simd::TransformVector4(m.Data(), v.Data(), result.Data());
+        return result;
+    }
+#endif
+
     return Vector4(
-        v.x * m.m00 + v.y * m.m01 + v.z * m.m02 + m.m03,
-        v.x * m.m10 + v.y * m.m11 + v.z * m.m12 + m.m13,
-        v.x * m.m20 + v.y * m.m21 + v.z * m.m22 + m.m23,
-        v.x * m.m30 + v.y * m.m31 + v.z * m.m32 + m.m33
+        v.x * m.m00 + v.y * m.m01 + v.z * m.m02 + v.w * m.m03,
+        v.x * m.m10 + v.y * m.m11 + v.z * m.m12 + v.w * m.m13,
+        v.x * m.m20 + v.y * m.m21 + v.z * m.m22 + v.w * m.m23,
+        v.x * m.m30 + v.y * m.m31 + v.z * m.m32 + v.w * m.m33
     );
 }
 
 /// @brief Multiplies two @ref Matrix "Matrices".
+///
+/// Uses SIMD instructions when @c MATH_SIMD_SSE is defined and the call isn't constant-evaluated.
 [[nodiscard]]
 constexpr Matrix operator*(const Matrix& m1, const Matrix& m2) noexcept
 {
-    return Matrix(
-        m1.m00 * m2.m00 + m1.m01 * m2.m10 + m1.m02 * m2.m20 + m1.m03 * m2.m30,
-        m1.m00 * m2.m01 + m1.m01 * m2.m11 + m1.m02 * m2.m21 + m1.m03 * m2.m31,
-        m1.m00 * m2.m02 + m1.m01 * m2.m12 + m1.m02 * m2.m22 + m1.m03 * m2.m32,
-        m1.m00 * m2.m03 + m1.m01 * m2.m13 + m1.m02 * m2.m23 + m1.m03 * m2.m33,
-
-        m1.m10 * m2.m00 + m1.m11 * m2.m10 + m1.m12 * m2.m20 + m1.m13 * m2.m30,
-        m1.m10 * m2.m01 + m1.m11 * m2.m11 + m1.m12 * m2.m21 + m1.m13 * m2.m31,
-        m1.m10 * m2.m02 + m1.m11 * m2.m12 + m1.m12 * m2.m22 + m1.m13 * m2.m32,
-        m1.m10 * m2.m03 + m1.m11 * m2.m13 + m1.m12 * m2.m23 + m1.m13 * m2.m33,
-
-        m1.m20 * m2.m00 + m1.m21 * m2.m10 + m1.m22 * m2.m20 + m1.m23 * m2.m30,
-        m1.m20 * m2.m01 + m1.m21 * m2.m11 + m1.m22 * m2.m21 + m1.m23 * m2.m31,
-        m1.m20 * m2.m02 + m1.m21 * m2.m12 + m1.m22 * m2.m22 + m1.m23 * m2.m32,
-        m1.m20 * m2.m03 + m1.m21 * m2.m13 + m1.m22 * m2.m23 + m1.m23 * m2.m33,
-
-        m1.m30 * m2.m00 + m1.m31 * m2.m10 + m1.m32 * m2.m20 + m1.m33 * m2.m30,
-        m1.m30 * m2.m01 + m1.m31 * m2.m11 + m1.m32 * m2.m21 + m1.m33 * m2.m31,
-        m1.m30 * m2.m02 + m1.m31 * m2.m12 + m1.m32 * m2.m22 + m1.m33 * m2.m32,
-        m1.m30 * m2.m03 + m1.m31 * m2.m13 + m1.m32 * m2.m23 + m1.m33 * m2.m33
-    );
+    Matrix result;
+    Matrix::Multiply(m1, m2, &result);
+    return result;
+}
+
+/// @brief Multiplies a Vector4 by a MatrixProduct of @ref Matrix "Matrices", applying them to the vector one by one from right to left.
+template <typename LhsT, typename RhsT>
+    requires std::same_as<typename MatrixProduct<LhsT, RhsT>::MatrixType, Matrix>
+[[nodiscard]]
+constexpr Vector4 operator*(const MatrixProduct<LhsT, RhsT>& product, const Vector4& v) noexcept { return product.lhs * (product.rhs * v); }
+
+/// @brief Multiplies a Vector3 by a MatrixProduct of @ref Matrix "Matrices", applying them to the vector one by one from right to left.
+///
+/// Like @ref operator*(const Matrix&, const Vector3&), the vector is extended with a @c w component of 1.
+template <typename LhsT, typename RhsT>
+    requires std::same_as<typename MatrixProduct<LhsT, RhsT>::MatrixType, Matrix>
+[[nodiscard]]
+constexpr Vector3 operator*(const MatrixProduct<LhsT, RhsT>& product, const Vector3& v) noexcept
+{
+    const Vector4 result = product * Vector4(v.x, v.y, v.z, 1.f);
+    return Vector3(result.x, result.y, result.z);
+}
+
+/// @brief Multiplies a Vector2 by a MatrixProduct of @ref Matrix "Matrices", applying them to the vector one by one from right to left.
+///
+/// Like @ref operator*(const Matrix&, Vector2), the vector is extended with @c z and @c w components of 1.
+template <typename LhsT, typename RhsT>
+    requires std::same_as<typename MatrixProduct<LhsT, RhsT>::MatrixType, Matrix>
+[[nodiscard]]
+constexpr Vector2 operator*(const MatrixProduct<LhsT, RhsT>& product, const Vector2 v) noexcept
+{
+    const Vector4 result = product * Vector4(v.x, v.y, 1.f, 1.f);
+    return Vector2(result.x, result.y);
 }
 
 /// @brief Adds two @ref Matrix "Matrices" according to @ref operator+(const Matrix&, const Matrix&), placing the result in @p m1.
@@ -586,8 +897,12 @@ constexpr Matrix& operator-=(Matrix& m1, const Matrix& m2) noexcept { return m1
 /// @brief Multiplies a Matrix by a @p scalar according to @ref operator*(const Matrix&, const float_t), placing the result in @p m.
 constexpr Matrix& operator*=(Matrix& m, const float_t scalar) noexcept { return m = m * scalar; }
 
-/// @brief Multiplies two @ref Matrix "Matrices" according to @ref operator*(const Matrix&, const Matrix&), placing the result in @p m1.
-constexpr Matrix& operator*=(Matrix& m1, const Matrix& m2) noexcept { return m1 = m1 * m2; }
+/// @brief Multiplies two @ref Matrix "Matrices" according to @ref Matrix::Multiply, placing the result in @p m1.
+constexpr Matrix& operator*=(Matrix& m1, const Matrix& m2) noexcept
+{
+    Matrix::Multiply(m1, m2, &m1);
+    return m1;
+}
 
 /// @brief	Checks if two Matrices are equal.
 [[nodiscard]]
@@ -643,6 +958,200 @@ constexpr void Matrix::Translation(const Vector3& translation, Matrix* result) n
     );
 }
 
+constexpr Matrix Matrix::Rotation(const float_t angle, const Vector3& axis) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return Rotation(cos, sin, axis);
+}
+
+constexpr void Matrix::Rotation(const float_t angle, const Vector3& axis, Matrix* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    Rotation(cos, sin, axis, result);
+}
+
+constexpr Matrix Matrix::RotationX(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationX(cos, sin);
+}
+
+constexpr void Matrix::RotationX(const float_t angle, Matrix* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationX(cos, sin, result);
+}
+
+constexpr Matrix Matrix::RotationY(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationY(cos, sin);
+}
+
+constexpr void Matrix::RotationY(const float_t angle, Matrix* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationY(cos, sin, result);
+}
+
+constexpr Matrix Matrix::RotationZ(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationZ(cos, sin);
+}
+
+constexpr void Matrix::RotationZ(const float_t angle, Matrix* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationZ(cos, sin, result);
+}
+
+constexpr Matrix Matrix::Rotation(const Vector3& rotation) noexcept
+{
+    Matrix result;
+    Rotation(rotation, &result);
+    return result;
+}
+
+constexpr void Matrix::Rotation(const Vector3& rotation, Matrix* result) noexcept
+{
+    Vector3 sin, cos;
+    Calc::SinCos(rotation, &sin, &cos);
+    Rotation(cos, sin, result);
+}
+
+constexpr Matrix Matrix::Rotation(const float_t cos, const float_t sin, const Vector3& axis) noexcept
+{
+    const float_t c2 = 1.f - cos;
+    Vector3 v = axis.Normalized();
+
+    return Matrix(
+        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin, 0.f,
+        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin, 0.f,
+        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos, 0.f,
+        0.f, 0.f, 0.f,                                                              1.f
+    );
+}
+
+constexpr void Matrix::Rotation(const float_t cos, const float_t sin, const Vector3& axis, Matrix* result) noexcept
+{
+    const float_t c2 = 1.f - cos;
+    Vector3 v = axis.Normalized();
+
+    *result = Matrix(
+        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin, 0.f,
+        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin, 0.f,
+        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos, 0.f,
+        0.f, 0.f, 0.f,                                                              1.f
+    );
+}
+
+constexpr Matrix Matrix::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale) noexcept
+{
+    Matrix result;
+    Trs(translation, rotation, scale, &result);
+    return result;
+}
+
+constexpr void Matrix::Trs(const Vector3& translation, const Vector3& rotation, const Vector3& scale, Matrix* result) noexcept
+{
+    Vector3 sin, cos;
+    Calc::SinCos(rotation, &sin, &cos);
+    Rotation(cos, sin, result);
+
+    // Closed form of Translation * Rotation * Scaling: the rotation columns are scaled and the translation is the last column
+    result->m00 *= scale.x;
+    result->m10 *= scale.x;
+    result->m20 *= scale.x;
+    result->m01 *= scale.y;
+    result->m11 *= scale.y;
+    result->m21 *= scale.y;
+    result->m02 *= scale.z;
+    result->m12 *= scale.z;
+    result->m22 *= scale.z;
+    result->m03 = translation.x;
+    result->m13 = translation.y;
+    result->m23 = translation.z;
+}
+
+constexpr Matrix Matrix::Trs(const Vector3& translation, const float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale) noexcept
+{
+    return Trs(translation, Rotation(rotationAngle, rotationAxis), scale);
+}
+
+constexpr void Matrix::Trs(const Vector3& translation, const float_t rotationAngle, const Vector3& rotationAxis, const Vector3& scale, Matrix* result) noexcept
+{
+    Trs(translation, Rotation(rotationAngle, rotationAxis), scale, result);
+}
+
+constexpr Matrix Matrix::LookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept
+{
+    Matrix result;
+    LookAt(eye, center, up, &result);
+    return result;
+}
+
+constexpr void Matrix::LookAt(const Vector3& eye, const Vector3& center, const Vector3& up, Matrix* result) noexcept
+{
+    const Vector3 f((center - eye).Normalized());
+    const Vector3 s(Vector3::Cross(f, up).Normalized());
+    const Vector3 u(Vector3::Cross(s, f));
+
+    *result = Matrix(
+        s.x, s.y, s.z, -Vector3::Dot(s, eye),
+        u.x, u.y, u.z, -Vector3::Dot(u, eye),
+        -f.x, -f.y, -f.z, Vector3::Dot(f, eye),
+        0.f, 0.f, 0.f, 1.f
+    );
+}
+
+constexpr Matrix Matrix::Perspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far)
+{
+    Matrix result;
+    Perspective(fov, aspectRatio, near, far, &result);
+    return result;
+}
+
+constexpr void Matrix::Perspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far, Matrix* result)
+{
+    if (!TryPerspective(fov, aspectRatio, near, far, result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Near must be smaller than far."));
+}
+
+constexpr std::optional<Matrix> Matrix::TryPerspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far) noexcept
+{
+    Matrix result;
+    if (!TryPerspective(fov, aspectRatio, near, far, &result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix::TryPerspective(const float_t fov, const float_t aspectRatio, const float_t near, const float_t far, Matrix* result) noexcept
+{
+    if (near > far) [[unlikely]]
+        return false;
+
+    const float_t range = far - near;
+    const float_t tanHalfFov = Calc::Tan(fov / 2.f);
+
+    *result = Matrix(
+        1.f / (tanHalfFov * aspectRatio), 0.f, 0.f, 0.f,
+        0.f, 1.f / tanHalfFov, 0.f, 0.f,
+        0.f, 0.f, -(far + near) / range, -(2.f * far * near) / range,
+        0.f, 0.f, -1.f, 0.f
+    );
+
+    return true;
+}
+
 constexpr Matrix Matrix::RotationX(const float_t cos, const float_t sin) noexcept
 {
     return Matrix(
@@ -751,14 +1260,170 @@ constexpr void Matrix::Scaling(const Vector3& scale, Matrix* result) noexcept
     );
 }
 
+constexpr void Matrix::Multiply(const Matrix& lhs, const Matrix& rhs, Matrix* result) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Simd::MultiplyMatrix4(lhs.Data(), rhs.Data(), result->Data());
+        return;
+    }
+#endif
+
+    *result = Matrix(
+        lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20 + lhs.m03 * rhs.m30,
+        lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21 + lhs.m03 * rhs.m31,
+        lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22 + lhs.m03 * rhs.m32,
+        lhs.m00 * rhs.m03 + lhs.m01 * rhs.m13 + lhs.m02 * rhs.m23 + lhs.m03 * rhs.m33,
+
+        lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20 + lhs.m13 * rhs.m30,
+        lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21 + lhs.m13 * rhs.m31,
+        lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22 + lhs.m13 * rhs.m32,
+        lhs.m10 * rhs.m03 + lhs.m11 * rhs.m13 + lhs.m12 * rhs.m23 + lhs.m13 * rhs.m33,
+
+        lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20 + lhs.m23 * rhs.m30,
+        lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21 + lhs.m23 * rhs.m31,
+        lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22 + lhs.m23 * rhs.m32,
+        lhs.m20 * rhs.m03 + lhs.m21 * rhs.m13 + lhs.m22 * rhs.m23 + lhs.m23 * rhs.m33,
+
+        lhs.m30 * rhs.m00 + lhs.m31 * rhs.m10 + lhs.m32 * rhs.m20 + lhs.m33 * rhs.m30,
+        lhs.m30 * rhs.m01 + lhs.m31 * rhs.m11 + lhs.m32 * rhs.m21 + lhs.m33 * rhs.m31,
+        lhs.m30 * rhs.m02 + lhs.m31 * rhs.m12 + lhs.m32 * rhs.m22 + lhs.m33 * rhs.m32,
+        lhs.m30 * rhs.m03 + lhs.m31 * rhs.m13 + lhs.m32 * rhs.m23 + lhs.m33 * rhs.m33
+    );
+}
+
+constexpr Matrix Matrix::Rotation(const Vector3& cos, const Vector3& sin) noexcept
+{
+    Matrix result;
+    Rotation(cos, sin, &result);
+    return result;
+}
+
+constexpr void Matrix::Rotation(const Vector3& cos, const Vector3& sin, Matrix* result) noexcept
+{
+    const float_t sinYCosX = sin.y * cos.x;
+    const float_t sinYSinX = sin.y * sin.x;
+
+    *result = Matrix(
+        cos.y * cos.z, cos.z * sinYSinX - sin.z * cos.x, cos.z * sinYCosX + sin.z * sin.x, 0.f,
+        cos.y * sin.z, sin.z * sinYSinX + cos.z * cos.x, sin.z * sinYCosX - cos.z * sin.x, 0.f,
+                -sin.y,                    cos.y * sin.x,                    cos.y * cos.x, 0.f,
+                   0.f,                              0.f,                              0.f, 1.f
+    );
+}
+
 constexpr Matrix Matrix::Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept { return Trs(translation, Rotation(rotation), scale); }
 
 constexpr void Matrix::Trs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, Matrix* result) noexcept { Trs(translation, Rotation(rotation), scale, result); }
 
+constexpr Matrix Matrix::InvertedTrs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept
+{
+    Matrix result;
+    InvertedTrs(translation, rotation, scale, &result);
+    return result;
+}
+
+constexpr void Matrix::InvertedTrs(const Vector3& translation, const Quaternion& rotation, const Vector3& scale, Matrix* result) noexcept
+{
+    const float_t xx = SQ(rotation.X());
+    const float_t yy = SQ(rotation.Y());
+    const float_t zz = SQ(rotation.Z());
+
+    const float_t xy = rotation.X() * rotation.Y();
+    const float_t wz = rotation.Z() * rotation.W();
+    const float_t xz = rotation.Z() * rotation.X();
+    const float_t wy = rotation.Y() * rotation.W();
+    const float_t yz = rotation.Y() * rotation.Z();
+    const float_t wx = rotation.X() * rotation.W();
+
+    const float_t invScaleX = 1.f / scale.x;
+    const float_t invScaleY = 1.f / scale.y;
+    const float_t invScaleZ = 1.f / scale.z;
+
+    // The rows of the inverse are the columns of the rotation, divided by the scaling
+    const float_t i00 = (1.f - 2.f * (yy + zz)) * invScaleX, i01 = 2.f * (xy + wz) * invScaleX, i02 = 2.f * (xz - wy) * invScaleX;
+    const float_t i10 = 2.f * (xy - wz) * invScaleY, i11 = (1.f - 2.f * (zz + xx)) * invScaleY, i12 = 2.f * (yz + wx) * invScaleY;
+    const float_t i20 = 2.f * (xz + wy) * invScaleZ, i21 = 2.f * (yz - wx) * invScaleZ, i22 = (1.f - 2.f * (yy + xx)) * invScaleZ;
+
+    *result = Matrix(
+        i00, i01, i02, -(i00 * translation.x + i01 * translation.y + i02 * translation.z),
+        i10, i11, i12, -(i10 * translation.x + i11 * translation.y + i12 * translation.z),
+        i20, i21, i22, -(i20 * translation.x + i21 * translation.y + i22 * translation.z),
+        0.f, 0.f, 0.f, 1.f
+    );
+}
+
+constexpr Matrix Matrix::CameraRelative(const Matrixd& transformation, const Vector3d& cameraPosition) noexcept
+{
+    Matrix result;
+    CameraRelative(transformation, cameraPosition, &result);
+    return result;
+}
+
+constexpr void Matrix::CameraRelative(const Matrixd& transformation, const Vector3d& cameraPosition, Matrix* result) noexcept
+{
+    const double_t camera[] = { cameraPosition.x, cameraPosition.y, cameraPosition.z };
+
+    // Translation(-cameraPosition) * transformation only changes the first three rows
+    Matrixd relative = transformation;
+    for (size_t col = 0; col < 4; col++)
+    {
+        for (size_t row = 0; row < 3; row++)
+            relative.components[col * 4 + row] -= camera[row] * transformation.components[col * 4 + 3];
+    }
+
+    *result = static_cast<Matrix>(relative);
+}
+
+constexpr Matrix Matrix::CameraRelativeTrs(
+    const Vector3d& translation,
+    const Quaterniond& rotation,
+    const Vector3d& scale,
+    const Vector3d& cameraPosition
+) noexcept
+{
+    Matrix result;
+    CameraRelativeTrs(translation, rotation, scale, cameraPosition, &result);
+    return result;
+}
+
+constexpr void Matrix::CameraRelativeTrs(
+    const Vector3d& translation,
+    const Quaterniond& rotation,
+    const Vector3d& scale,
+    const Vector3d& cameraPosition,
+    Matrix* result
+) noexcept
+{
+    const double_t x = rotation.imaginary.x, y = rotation.imaginary.y, z = rotation.imaginary.z, w = rotation.real;
+
+    const double_t xx = x * x;
+    const double_t yy = y * y;
+    const double_t zz = z * z;
+
+    const double_t xy = x * y;
+    const double_t wz = z * w;
+    const double_t xz = z * x;
+    const double_t wy = y * w;
+    const double_t yz = y * z;
+    const double_t wx = x * w;
+
+    const Vector3d relative = translation - cameraPosition;
+
+    // Same as Trs(translation, Rotation(rotation), scale) but with the translation relative to the camera
+    *result = static_cast<Matrix>(Matrixd(
+        (1. - 2. * (yy + zz)) * scale.x, 2. * (xy - wz) * scale.y, 2. * (xz + wy) * scale.z, relative.x,
+        2. * (xy + wz) * scale.x, (1. - 2. * (zz + xx)) * scale.y, 2. * (yz - wx) * scale.z, relative.y,
+        2. * (xz - wy) * scale.x, 2. * (yz + wx) * scale.y, (1. - 2. * (yy + xx)) * scale.z, relative.z,
+        0., 0., 0., 1.
+    ));
+}
+
 constexpr Matrix Matrix::Orthographic(const float_t left, const float_t right, const float_t bottom, const float_t top, const float_t near, const float_t far)
 {
     if (near > far) [[unlikely]]
-        throw std::invalid_argument("Near must be smaller than far.");
+        MATH_THROW(std::invalid_argument("Near must be smaller than far."));
 
     return Matrix(
         2.f / (right - left), 0.f, 0.f, -((right + left) / (right - left)),
@@ -769,9 +1434,23 @@ constexpr Matrix Matrix::Orthographic(const float_t left, const float_t right, c
 }
 
 constexpr void Matrix::Orthographic(const float_t left, const float_t right, const float_t bottom, const float_t top, const float_t near, const float_t far, Matrix* result)
+{
+    if (!TryOrthographic(left, right, bottom, top, near, far, result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Near must be smaller than far."));
+}
+
+constexpr std::optional<Matrix> Matrix::TryOrthographic(const float_t left, const float_t right, const float_t bottom, const float_t top, const float_t near, const float_t far) noexcept
+{
+    Matrix result;
+    if (!TryOrthographic(left, right, bottom, top, near, far, &result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix::TryOrthographic(const float_t left, const float_t right, const float_t bottom, const float_t top, const float_t near, const float_t far, Matrix* result) noexcept
 {
     if (near > far) [[unlikely]]
-        throw std::invalid_argument("Near must be smaller than far.");
+        return false;
 
     *result = Matrix(
         2.f / (right - left), 0.f, 0.f, -((right + left) / (right - left)),
@@ -779,6 +1458,8 @@ constexpr void Matrix::Orthographic(const float_t left, const float_t right, con
         0.f, 0.f, -2.f / (far - near), -((far + near) / (far - near)),
         0.f, 0.f, 0.f, 1.f
     );
+
+    return true;
 }
 
 constexpr const float_t* Matrix::Data() const noexcept { return &m00; }
@@ -875,8 +1556,27 @@ constexpr Matrix Matrix::Inverted() const
 
 constexpr void Matrix::Inverted(Matrix* result) const
 {
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Matrix isn't invertible"));
+}
+
+constexpr std::optional<Matrix> Matrix::TryInverted() const noexcept
+{
+    Matrix result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix::TryInverted(Matrix* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Dispatch::GetKernels().invertMatrices(Data(), result->Data(), 1);
+#endif
+
     if (Determinant() == 0.f) [[unlikely]]
-        throw std::invalid_argument("Matrix isn't invertible");
+        return false;
 
     // Definition from MonoGame/XNA: https://github.com/MonoGame/MonoGame/blob/b30122c99597eaf81b81f32ab1d467a7b4185c73/MonoGame.Framework/Matrix.cs
 
@@ -927,6 +1627,94 @@ constexpr void Matrix::Inverted(Matrix* result) const
         -(m00 * val30 - m01 * val32 + m02 * val33) * val27,
         (m00 * val36 - m01 * val38 + m02 * val39) * val27
     );
+
+    return true;
+}
+
+constexpr Matrix Matrix::InvertedAffine() const
+{
+    Matrix result;
+    InvertedAffine(&result);
+    return result;
+}
+
+constexpr void Matrix::InvertedAffine(Matrix* result) const
+{
+    if (!TryInvertedAffine(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Matrix isn't invertible"));
+}
+
+constexpr std::optional<Matrix> Matrix::TryInvertedAffine() const noexcept
+{
+    Matrix result;
+    if (!TryInvertedAffine(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix::TryInvertedAffine(Matrix* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::InvertAffineMatrix4(Data(), result->Data());
+#endif
+
+    const float_t cofactor00 = m11 * m22 - m12 * m21;
+    const float_t cofactor01 = m12 * m20 - m10 * m22;
+    const float_t cofactor02 = m10 * m21 - m11 * m20;
+
+    const float_t determinant = m00 * cofactor00 + m01 * cofactor01 + m02 * cofactor02;
+
+    if (determinant == 0.f) [[unlikely]]
+        return false;
+
+    const float_t invDeterminant = 1.f / determinant;
+
+    const float_t i00 = cofactor00 * invDeterminant;
+    const float_t i01 = (m02 * m21 - m01 * m22) * invDeterminant;
+    const float_t i02 = (m01 * m12 - m02 * m11) * invDeterminant;
+
+    const float_t i10 = cofactor01 * invDeterminant;
+    const float_t i11 = (m00 * m22 - m02 * m20) * invDeterminant;
+    const float_t i12 = (m02 * m10 - m00 * m12) * invDeterminant;
+
+    const float_t i20 = cofactor02 * invDeterminant;
+    const float_t i21 = (m01 * m20 - m00 * m21) * invDeterminant;
+    const float_t i22 = (m00 * m11 - m01 * m10) * invDeterminant;
+
+    *result = Matrix(
+        i00, i01, i02, -(i00 * m03 + i01 * m13 + i02 * m23),
+        i10, i11, i12, -(i10 * m03 + i11 * m13 + i12 * m23),
+        i20, i21, i22, -(i20 * m03 + i21 * m13 + i22 * m23),
+        0.f, 0.f, 0.f, 1.f
+    );
+
+    return true;
+}
+
+constexpr Matrix Matrix::InvertedRigid() const noexcept
+{
+    Matrix result;
+    InvertedRigid(&result);
+    return result;
+}
+
+constexpr void Matrix::InvertedRigid(Matrix* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Simd::InvertRigidMatrix4(Data(), result->Data());
+        return;
+    }
+#endif
+
+    *result = Matrix(
+        m00, m10, m20, -(m00 * m03 + m10 * m13 + m20 * m23),
+        m01, m11, m21, -(m01 * m03 + m11 * m13 + m21 * m23),
+        m02, m12, m22, -(m02 * m03 + m12 * m13 + m22 * m23),
+        0.f, 0.f, 0.f, 1.f
+    );
 }
 
 constexpr float_t Matrix::At(const size_t row, const size_t col) const
@@ -935,7 +1723,7 @@ constexpr float_t Matrix::At(const size_t row, const size_t col) const
         return Data()[row * 4 + col];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix subscript out of range"));
 }
 
 constexpr float_t& Matrix::At(const size_t row, const size_t col)
@@ -944,9 +1732,13 @@ constexpr float_t& Matrix::At(const size_t row, const size_t col)
         return Data()[row * 4 + col];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix subscript out of range"));
 }
 
+constexpr float_t Matrix::UncheckedAt(const size_t row, const size_t col) const noexcept { return Data()[row * 4 + col]; }
+
+constexpr float_t& Matrix::UncheckedAt(const size_t row, const size_t col) noexcept { return Data()[row * 4 + col]; }
+
 constexpr Vector4 Matrix::operator[](const size_t col) const
 {
     return Vector4(Data() + static_cast<ptrdiff_t>(col) * 4);
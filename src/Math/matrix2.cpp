@@ -2,24 +2,28 @@
 
 #include <iostream>
 
-Matrix2 Matrix2::RotationZ(const float_t angle) noexcept
+MATH_INLINE Matrix2 Matrix2::RotationZ(const float_t angle) noexcept
 {
-    return RotationZ(std::cos(angle), std::sin(angle));
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationZ(cos, sin);
 }
 
-void Matrix2::RotationZ(const float_t angle, Matrix2* result) noexcept
+MATH_INLINE void Matrix2::RotationZ(const float_t angle, Matrix2* result) noexcept
 {
-    RotationZ(std::cos(angle), std::sin(angle), result);
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationZ(cos, sin, result);
 }
 
-void Matrix2::DebugPrint() const noexcept
+MATH_INLINE void Matrix2::DebugPrint() const noexcept
 {
     std::cout << "{ "
         << m00 << ' ' << m10 << " }\n{ "
         << m01 << ' ' << m11 << " }\n";
 }
 
-Matrix2::operator Matrix3() const
+MATH_INLINE Matrix2::operator Matrix3() const
 {
     return Matrix3(
         m00, m01, 0.f,
@@ -28,7 +32,7 @@ Matrix2::operator Matrix3() const
     );
 }
 
-Matrix2::operator Matrix() const
+MATH_INLINE Matrix2::operator Matrix() const
 {
     return Matrix(
         m00, m01, 0.f, 0.f,
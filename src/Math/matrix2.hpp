@@ -1,6 +1,7 @@
 #pragma once
 
 #include <format>
+#include <optional>
 #include <sstream>
 
 #include <ostream>
@@ -8,6 +9,7 @@
 #include "Math/calc.hpp"
 #include "Math/matrix.hpp"
 #include "Math/matrix3.hpp"
+#include "Math/matrixt.hpp"
 #include "Math/vector2.hpp"
 
 /// @file matrix3.hpp
@@ -16,7 +18,9 @@
 /// @brief The Matrix2 struct represents a 3x3 array mainly used for mathematical operations.
 ///
 /// Matrices are stored using the column-major convention.
-struct MATH_TOOLBOX Matrix2
+/// This is the 2x2 float specialization of MatrixT, which provides the other shapes and value types.
+template <>
+struct MATH_TOOLBOX MatrixT<2, 2, float_t>
 {
     /// @brief The component at position [0, 0] of a Matrix2.
     float_t m00 = 0.f;
@@ -75,26 +79,26 @@ struct MATH_TOOLBOX Matrix2
     static constexpr void Scaling(const Vector2& scale, Matrix2* result) noexcept;
 
     /// @brief Creates a Matrix2 with all its values set to 0.
-    constexpr Matrix2() = default;
+    constexpr MatrixT() = default;
 
     /// @brief Creates a Matrix2 with all its values set to this default value.
-    constexpr explicit Matrix2(float_t defaultValue) noexcept;
+    constexpr explicit MatrixT(float_t defaultValue) noexcept;
 
     /// @brief Constructs a Matrix2 with its components set to the data pointed by @c data.
     ///
     /// This constructor assumes that @c data is a valid pointer pointing to at least 4 @c float_t values.
     ///
     /// @param data The data where the values for this matrix's components are located.
-    constexpr explicit Matrix2(const float_t* data) noexcept;
+    constexpr explicit MatrixT(const float_t* data) noexcept;
 
     /// @brief Constructs a Matrix2 with 2 column vectors.
-    constexpr Matrix2(
+    constexpr MatrixT(
             const Vector2& c0,
             const Vector2& c1
     ) noexcept;
 
     /// @brief Constructs a Matrix2 with 16 float_t values.
-    constexpr Matrix2(
+    constexpr MatrixT(
             float_t m00, float_t m01,
             float_t m10, float_t m11
     ) noexcept;
@@ -165,6 +169,14 @@ struct MATH_TOOLBOX Matrix2
     /// @brief Computes the invert of this Matrix2, e.g. @c *this * Inverted() == Identity() is true.
     constexpr void Inverted(Matrix2* result) const;
 
+    /// @brief Computes the invert of this Matrix2 like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<Matrix2> TryInverted() const noexcept;
+
+    /// @brief Computes the invert of this Matrix2 like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(Matrix2* result) const noexcept;
+
     /// @brief Retrieves this matrix's value at position @c [col, row].
     ///
     /// @param row The index of the col to get.
@@ -181,6 +193,16 @@ struct MATH_TOOLBOX Matrix2
     [[nodiscard]]
     constexpr float_t& At(size_t row, size_t col);
 
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t row, size_t col) noexcept;
+
     /// @brief	Retrieves this matrix's column vector at position @c col.
     ///
     ///	If you want to get a value of this matrix, consider using <see cref="At(size_t, size_t)"/>
@@ -216,25 +238,25 @@ static_assert(std::is_move_constructible_v<Matrix2>, "Class Matrix2 must be move
 static_assert(std::is_copy_assignable_v<Matrix2>, "Class Matrix2 must be copy assignable.");
 static_assert(std::is_move_assignable_v<Matrix2>, "Class Matrix2 must be move assignable.");
 
-constexpr Matrix2::Matrix2(const float_t defaultValue) noexcept
+constexpr Matrix2::MatrixT(const float_t defaultValue) noexcept
     : m00(defaultValue), m10(defaultValue)
     , m01(defaultValue), m11(defaultValue)
 {
 }
 
-constexpr Matrix2::Matrix2(const float_t* const data) noexcept
+constexpr Matrix2::MatrixT(const float_t* const data) noexcept
     : m00(data[0]), m10(data[1])
     , m01(data[2]), m11(data[3])
 {
 }
 
-constexpr Matrix2::Matrix2(const Vector2& c0, const Vector2& c1) noexcept
+constexpr Matrix2::MatrixT(const Vector2& c0, const Vector2& c1) noexcept
     : m00(c0.x), m10(c1.x)
     , m01(c0.y), m11(c1.y)
 {
 }
 
-constexpr Matrix2::Matrix2(
+constexpr Matrix2::MatrixT(
     const float_t m00, const float_t m01,
     const float_t m10, const float_t m11
 ) noexcept
@@ -451,13 +473,29 @@ constexpr Matrix2 Matrix2::Inverted() const
 }
 
 constexpr void Matrix2::Inverted(Matrix2* result) const
+{
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Matrix2 isn't invertible"));
+}
+
+constexpr std::optional<Matrix2> Matrix2::TryInverted() const noexcept
+{
+    Matrix2 result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix2::TryInverted(Matrix2* result) const noexcept
 {
     const float_t determinant = Determinant();
 
     if (determinant == 0.f) [[unlikely]]
-        throw std::invalid_argument("Matrix2 isn't invertible");
+        return false;
 
     *result = Matrix2(m11, -m10, -m01, m00) * (1.f / determinant);
+
+    return true;
 }
 
 constexpr float_t Matrix2::At(const size_t row, const size_t col) const
@@ -466,7 +504,7 @@ constexpr float_t Matrix2::At(const size_t row, const size_t col) const
         return Data()[col * 2 + row];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix2 subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix2 subscript out of range"));
 }
 
 constexpr float_t& Matrix2::At(const size_t row, const size_t col)
@@ -475,9 +513,13 @@ constexpr float_t& Matrix2::At(const size_t row, const size_t col)
         return Data()[col * 2 + row];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix2 subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix2 subscript out of range"));
 }
 
+constexpr float_t Matrix2::UncheckedAt(const size_t row, const size_t col) const noexcept { return Data()[col * 2 + row]; }
+
+constexpr float_t& Matrix2::UncheckedAt(const size_t row, const size_t col) noexcept { return Data()[col * 2 + row]; }
+
 constexpr Vector3 Matrix2::operator[](const size_t col) const
 {
     return Vector3(Data() + static_cast<ptrdiff_t>(col) * 2);
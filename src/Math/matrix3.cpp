@@ -1,91 +1,30 @@
 #include "Math/matrix3.hpp"
 
 #include <iostream>
+#include <stdexcept>
 
 #include "Math/matrix.hpp"
 
-Matrix3 Matrix3::Rotation(const float_t angle, const Vector3& axis) noexcept
+MATH_INLINE void Matrix3::Rotation(const std::span<const Vector3> rotations, const std::span<Matrix3> results)
 {
-    return Rotation(std::cos(angle), std::sin(angle), axis);
-}
-
-void Matrix3::Rotation(const float_t angle, const Vector3& axis, Matrix3* result) noexcept
-{
-    Rotation(std::cos(angle), std::sin(angle), axis, result);
-}
-
-Matrix3 Matrix3::RotationX(const float_t angle) noexcept
-{
-    return RotationX(std::cos(angle), std::sin(angle));
-}
-
-void Matrix3::RotationX(const float_t angle, Matrix3* result) noexcept
-{
-    RotationX(std::cos(angle), std::sin(angle), result);
-}
-
-Matrix3 Matrix3::RotationY(const float_t angle) noexcept
-{
-    return RotationY(std::cos(angle), std::sin(angle));
-}
-
-void Matrix3::RotationY(const float_t angle, Matrix3* result) noexcept
-{
-    RotationY(std::cos(angle), std::sin(angle), result);
-}
-
-Matrix3 Matrix3::RotationZ(const float_t angle) noexcept
-{
-    return RotationZ(std::cos(angle), std::sin(angle));
-}
+    if (results.size() < rotations.size())
+        MATH_THROW(std::invalid_argument("The output range must be at least as large as the rotation range"));
 
-void Matrix3::RotationZ(const float_t angle, Matrix3* result) noexcept
-{
-    RotationZ(std::cos(angle), std::sin(angle), result);
-}
+    // The sines and cosines are computed by chunks to stay on the stack
+    constexpr size_t ChunkSize = 64;
+    Vector3 sines[ChunkSize], cosines[ChunkSize];
 
-Matrix3 Matrix3::Rotation(const Vector3& rotation) noexcept
-{
-    return RotationZ(rotation.z)
-        * RotationY(rotation.y)
-        * RotationX(rotation.x);
-}
-
-void Matrix3::Rotation(const Vector3& rotation, Matrix3* result) noexcept
-{
-    RotationZ(rotation.z, result);
-    Matrix3 temp;
-    RotationY(rotation.y, &temp);
-    *result *= temp;
-    RotationX(rotation.x, &temp);
-    *result *= temp;
-}
+    for (size_t i = 0; i < rotations.size(); i += ChunkSize)
+    {
+        const size_t count = std::min(ChunkSize, rotations.size() - i);
+        Calc::SinCos(rotations.subspan(i, count), sines, cosines);
 
-Matrix3 Matrix3::Rotation(const float_t cos, const float_t sin, const Vector3& axis) noexcept
-{
-    const float_t c2 = 1.f - cos;
-    Vector3 v = axis.Normalized();
-
-    return Matrix3(
-        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin,
-        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin,
-        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos
-    );
-}
-
-void Matrix3::Rotation(const float_t cos, const float_t sin, const Vector3& axis, Matrix3* result) noexcept
-{
-    const float_t c2 = 1.f - cos;
-    Vector3 v = axis.Normalized();
-
-    *result = Matrix3(
-        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin,
-        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin,
-        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos
-    );
+        for (size_t j = 0; j < count; j++)
+            Rotation(cosines[j], sines[j], &results[i + j]);
+    }
 }
 
-void Matrix3::DebugPrint() const noexcept
+MATH_INLINE void Matrix3::DebugPrint() const noexcept
 {
     std::cout << "{ "
         << m00 << ' ' << m10 << ' ' << m20 << " }\n{ "
@@ -93,7 +32,7 @@ void Matrix3::DebugPrint() const noexcept
         << m02 << ' ' << m12 << ' ' << m22 << " }\n";
 }
 
-Matrix3::operator Matrix() const
+MATH_INLINE Matrix3::operator Matrix() const
 {
     return Matrix(
         m00, m01, m02, 0.f,
@@ -103,7 +42,7 @@ Matrix3::operator Matrix() const
     );
 }
 
-std::ostream& operator<<(std::ostream &out, const Matrix3 &m)
+MATH_INLINE std::ostream& operator<<(std::ostream &out, const Matrix3 &m)
 {
     return out << "{ { " << m.m00 << ' ' << m.m01 << ' ' << m.m02 << " } { "
         << m.m10 << ' ' << m.m11 << ' ' << m.m12 << " } { "
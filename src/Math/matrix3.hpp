@@ -1,11 +1,14 @@
 #pragma once
 
 #include <format>
+#include <optional>
 #include <sstream>
 
 #include <ostream>
 
 #include "Math/calc.hpp"
+#include "Math/expression.hpp"
+#include "Math/matrixt.hpp"
 #include "Math/quaternion.hpp"
 #include "Math/vector3.hpp"
 
@@ -15,7 +18,9 @@
 /// @brief The Matrix3 struct represents a 3x3 array mainly used for mathematical operations.
 ///
 /// Matrices are stored using the column-major convention.
-struct MATH_TOOLBOX Matrix3
+/// This is the 3x3 float specialization of MatrixT, which provides the other shapes and value types.
+template <>
+struct MATH_TOOLBOX MatrixT<3, 3, float_t>
 {
     /// @brief The component at position [0, 0] of a Matrix3.
     float_t m00 = 0.f;
@@ -60,26 +65,26 @@ struct MATH_TOOLBOX Matrix3
     /// @param angle The angle in radians.
     /// @param axis The axis around which the rotation occurs.
     [[nodiscard]]
-    static Matrix3 Rotation(float_t angle, const Vector3& axis) noexcept;
+    static constexpr Matrix3 Rotation(float_t angle, const Vector3& axis) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix from the given angle and axis.
     ///
     /// @param angle The angle in radians.
     /// @param axis The axis around which the rotation occurs.
     /// @param result The output of the function.
-    static void Rotation(float_t angle, const Vector3& axis, Matrix3* result) noexcept;
+    static constexpr void Rotation(float_t angle, const Vector3& axis, Matrix3* result) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the X axis from the given angle.
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix3 RotationX(float_t angle) noexcept;
+    static constexpr Matrix3 RotationX(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the X axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationX(float_t angle, Matrix3* result) noexcept;
+    static constexpr void RotationX(float_t angle, Matrix3* result) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the X axis from the given angle.
     ///
@@ -99,13 +104,13 @@ struct MATH_TOOLBOX Matrix3
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix3 RotationY(float_t angle) noexcept;
+    static constexpr Matrix3 RotationY(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the Y axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationY(float_t angle, Matrix3* result) noexcept;
+    static constexpr void RotationY(float_t angle, Matrix3* result) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the Y axis from the given angle.
     ///
@@ -125,13 +130,13 @@ struct MATH_TOOLBOX Matrix3
     ///
     /// @param angle The angle in radians.
     [[nodiscard]]
-    static Matrix3 RotationZ(float_t angle) noexcept;
+    static constexpr Matrix3 RotationZ(float_t angle) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the Z axis from the given angle.
     ///
     /// @param angle The angle in radians.
     /// @param result The output of the function.
-    static void RotationZ(float_t angle, Matrix3* result) noexcept;
+    static constexpr void RotationZ(float_t angle, Matrix3* result) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix around the Z axis from the given angle.
     ///
@@ -149,10 +154,38 @@ struct MATH_TOOLBOX Matrix3
 
     /// @brief Creates a 3D rotation %Matrix from the given angle for each of the x, y, and z axis.
     [[nodiscard]]
-    static Matrix3 Rotation(const Vector3& rotation) noexcept;
+    static constexpr Matrix3 Rotation(const Vector3& rotation) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix from the given angle for each of the x, y, and z axis.
-    static void Rotation(const Vector3& rotation, Matrix3* result) noexcept;
+    static constexpr void Rotation(const Vector3& rotation, Matrix3* result) noexcept;
+
+    /// @brief Creates a 3D rotation %Matrix from the cosines and sines of the angles around each of the x, y, and z axis.
+    ///
+    /// This is the closed form of @code RotationZ(z) * RotationY(y) * RotationX(x)@endcode.
+    ///
+    /// @param cos The cosines of the angles in radians.
+    /// @param sin The sines of the angles in radians.
+    [[nodiscard]]
+    static constexpr Matrix3 Rotation(const Vector3& cos, const Vector3& sin) noexcept;
+
+    /// @brief Creates a 3D rotation %Matrix from the cosines and sines of the angles around each of the x, y, and z axis.
+    ///
+    /// This is the closed form of @code RotationZ(z) * RotationY(y) * RotationX(x)@endcode.
+    ///
+    /// @param cos The cosines of the angles in radians.
+    /// @param sin The sines of the angles in radians.
+    /// @param result The output of the function.
+    static constexpr void Rotation(const Vector3& cos, const Vector3& sin, Matrix3* result) noexcept;
+
+    /// @brief Creates a 3D rotation %Matrix for each of the given angles around the x, y, and z axis.
+    ///
+    /// The sines and cosines of all the angles are computed using @ref Calc::SinCos(std::span<const Vector3>, std::span<Vector3>, std::span<Vector3>).
+    ///
+    /// @param rotations The angles in radians.
+    /// @param results The output of the function.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p rotations.
+    static void Rotation(std::span<const Vector3> rotations, std::span<Matrix3> results);
 
     /// @brief	Creates a 3D rotation %Matrix from the given rotation Quaternion.
     [[nodiscard]]
@@ -161,13 +194,22 @@ struct MATH_TOOLBOX Matrix3
     /// @brief	Creates a 3D rotation %Matrix from the given rotation Quaternion.
     static constexpr void Rotation(const Quaternion& rotation, Matrix3* result) noexcept;
 
+    /// @brief Multiplies two @ref Matrix3 "Matrices", e.g. computes @p lhs * @p rhs right away.
+    ///
+    /// Both @ref operator*(const Matrix3&, const Matrix3&) and the evaluation of a MatrixProduct rely on this.
+    ///
+    /// @param lhs The left-hand side of the product.
+    /// @param rhs The right-hand side of the product.
+    /// @param result The output of the function. May be @p lhs or @p rhs.
+    static constexpr void Multiply(const Matrix3& lhs, const Matrix3& rhs, Matrix3* result) noexcept;
+
     /// @brief Creates a 3D rotation %Matrix from the given cosine, sine and axis.
     ///
     /// @param cos The cosine of the angle in radians.
     /// @param sin The sine of the angle in radians.
     /// @param axis The axis around which the rotation occurs.
     [[nodiscard]]
-    static Matrix3 Rotation(float_t cos, float_t sin, const Vector3& axis) noexcept;
+    static constexpr Matrix3 Rotation(float_t cos, float_t sin, const Vector3& axis) noexcept;
 
     /// @brief Creates a 3D rotation %Matrix from the given cosine, sine and axis.
     ///
@@ -175,7 +217,7 @@ struct MATH_TOOLBOX Matrix3
     /// @param sin The sine of the angle in radians.
     /// @param axis The axis around which the rotation occurs.
     /// @param result The output of the function.
-    static void Rotation(float_t cos, float_t sin, const Vector3& axis, Matrix3* result) noexcept;
+    static constexpr void Rotation(float_t cos, float_t sin, const Vector3& axis, Matrix3* result) noexcept;
 
     /// @brief Creates a 3D scaling %Matrix from the given Vector3.
     [[nodiscard]]
@@ -185,27 +227,27 @@ struct MATH_TOOLBOX Matrix3
     static constexpr void Scaling(const Vector3& scale, Matrix3* result) noexcept;
 
     /// @brief Creates a Matrix3 with all its values set to 0.
-    constexpr Matrix3() = default;
+    constexpr MatrixT() = default;
 
     /// @brief Creates a Matrix3 with all its values set to this default value.
-    constexpr explicit Matrix3(float_t defaultValue) noexcept;
+    constexpr explicit MatrixT(float_t defaultValue) noexcept;
 
     /// @brief Constructs a Matrix3 with its components set to the data pointed by @c data.
     ///
     /// This constructor assumes that @c data is a valid pointer pointing to at least 9 @c float_t values.
     ///
     /// @param data The data where the values for this matrix's components are located.
-    constexpr explicit Matrix3(const float_t* data) noexcept;
+    constexpr explicit MatrixT(const float_t* data) noexcept;
 
     /// @brief Constructs a Matrix3 with 3 column vectors.
-    constexpr Matrix3(
+    constexpr MatrixT(
             const Vector3& c0,
             const Vector3& c1,
             const Vector3& c2
     ) noexcept;
 
     /// @brief Constructs a Matrix3 with 16 float_t values.
-    constexpr Matrix3(
+    constexpr MatrixT(
             float_t m00, float_t m01, float_t m02,
             float_t m10, float_t m11, float_t m12,
             float_t m20, float_t m21, float_t m22
@@ -277,6 +319,14 @@ struct MATH_TOOLBOX Matrix3
     /// @brief Computes the invert of this Matrix3, e.g. @c *this * Inverted() == Identity() is true.
     constexpr void Inverted(Matrix3* result) const;
 
+    /// @brief Computes the invert of this Matrix3 like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<Matrix3> TryInverted() const noexcept;
+
+    /// @brief Computes the invert of this Matrix3 like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(Matrix3* result) const noexcept;
+
     /// @brief Retrieves this matrix's value at position @c [col, row].
     ///
     /// @param row The index of the col to get.
@@ -293,6 +343,16 @@ struct MATH_TOOLBOX Matrix3
     [[nodiscard]]
     constexpr float_t& At(size_t row, size_t col);
 
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t row, size_t col) noexcept;
+
     /// @brief	Retrieves this matrix's column vector at position @c col.
     ///
     ///	If you want to get a value of this matrix, consider using <see cref="At(size_t, size_t)"/>
@@ -324,28 +384,28 @@ static_assert(std::is_move_constructible_v<Matrix3>, "Class Matrix3 must be move
 static_assert(std::is_copy_assignable_v<Matrix3>, "Class Matrix3 must be copy assignable.");
 static_assert(std::is_move_assignable_v<Matrix3>, "Class Matrix3 must be move assignable.");
 
-constexpr Matrix3::Matrix3(const float_t defaultValue) noexcept
+constexpr Matrix3::MatrixT(const float_t defaultValue) noexcept
     : m00(defaultValue), m10(defaultValue), m20(defaultValue)
     , m01(defaultValue), m11(defaultValue), m21(defaultValue)
     , m02(defaultValue), m12(defaultValue), m22(defaultValue)
 {
 }
 
-constexpr Matrix3::Matrix3(const float_t* const data) noexcept
+constexpr Matrix3::MatrixT(const float_t* const data) noexcept
     : m00(data[0]), m10(data[1]), m20(data[2])
     , m01(data[3]), m11(data[4]), m21(data[5])
     , m02(data[6]), m12(data[7]), m22(data[8])
 {
 }
 
-constexpr Matrix3::Matrix3(const Vector3& c0, const Vector3& c1, const Vector3& c2) noexcept
+constexpr Matrix3::MatrixT(const Vector3& c0, const Vector3& c1, const Vector3& c2) noexcept
     : m00(c0.x), m10(c1.x), m20(c2.x)
     , m01(c0.y), m11(c1.y), m21(c2.y)
     , m02(c0.z), m12(c1.z), m22(c2.z)
 {
 }
 
-constexpr Matrix3::Matrix3(
+constexpr Matrix3::MatrixT(
     const float_t m00, const float_t m01, const float_t m02,
     const float_t m10, const float_t m11, const float_t m12,
     const float_t m20, const float_t m21, const float_t m22
@@ -424,19 +484,27 @@ constexpr Vector3 operator*(const Matrix3& m, const Vector3& v) noexcept
 [[nodiscard]]
 constexpr Matrix3 operator*(const Matrix3& m1, const Matrix3& m2) noexcept
 {
-    return Matrix3(
-        m1.m00 * m2.m00 + m1.m01 * m2.m10 + m1.m02 * m2.m20,
-        m1.m00 * m2.m01 + m1.m01 * m2.m11 + m1.m02 * m2.m21,
-        m1.m00 * m2.m02 + m1.m01 * m2.m12 + m1.m02 * m2.m22,
+    Matrix3 result;
+    Matrix3::Multiply(m1, m2, &result);
+    return result;
+}
 
-        m1.m10 * m2.m00 + m1.m11 * m2.m10 + m1.m12 * m2.m20,
-        m1.m10 * m2.m01 + m1.m11 * m2.m11 + m1.m12 * m2.m21,
-        m1.m10 * m2.m02 + m1.m11 * m2.m12 + m1.m12 * m2.m22,
+/// @brief Multiplies a Vector3 by a MatrixProduct of @ref Matrix3 "Matrices", applying them to the vector one by one from right to left.
+template <typename LhsT, typename RhsT>
+    requires std::same_as<typename MatrixProduct<LhsT, RhsT>::MatrixType, Matrix3>
+[[nodiscard]]
+constexpr Vector3 operator*(const MatrixProduct<LhsT, RhsT>& product, const Vector3& v) noexcept { return product.lhs * (product.rhs * v); }
 
-        m1.m20 * m2.m00 + m1.m21 * m2.m10 + m1.m22 * m2.m20,
-        m1.m20 * m2.m01 + m1.m21 * m2.m11 + m1.m22 * m2.m21,
-        m1.m20 * m2.m02 + m1.m21 * m2.m12 + m1.m22 * m2.m22
-    );
+/// @brief Multiplies a Vector2 by a MatrixProduct of @ref Matrix3 "Matrices", applying them to the vector one by one from right to left.
+///
+/// Like @ref operator*(const Matrix3&, Vector2), the vector is extended with a @c z component of 1.
+template <typename LhsT, typename RhsT>
+    requires std::same_as<typename MatrixProduct<LhsT, RhsT>::MatrixType, Matrix3>
+[[nodiscard]]
+constexpr Vector2 operator*(const MatrixProduct<LhsT, RhsT>& product, const Vector2 v) noexcept
+{
+    const Vector3 result = product * Vector3(v.x, v.y, 1.f);
+    return Vector2(result.x, result.y);
 }
 
 /// @brief Adds two @ref Matrix3 "Matrices" according to @ref operator+(const Matrix&, const Matrix&), placing the result in @p m1.
@@ -454,8 +522,12 @@ constexpr Vector2& operator*=(const Matrix3& m, Vector2& v) noexcept { return v
 /// @brief Multiplies a Matrix by a Vector3 according to @ref operator*(const Matrix&, const Vector3&), placing the result in @p m.
 constexpr Vector3& operator*=(const Matrix3& m, Vector3& v) noexcept { return v = m * v; }
 
-/// @brief Multiplies two @ref Matrix3 "Matrices" according to @ref operator*(const Matrix&, const Matrix&), placing the result in @p m1.
-constexpr Matrix3& operator*=(Matrix3& m1, const Matrix3& m2) noexcept { return m1 = m1 * m2; }
+/// @brief Multiplies two @ref Matrix3 "Matrices" according to @ref Matrix3::Multiply, placing the result in @p m1.
+constexpr Matrix3& operator*=(Matrix3& m1, const Matrix3& m2) noexcept
+{
+    Matrix3::Multiply(m1, m2, &m1);
+    return m1;
+}
 
 /// @brief	Checks if two Matrices are equal.
 [[nodiscard]]
@@ -488,6 +560,100 @@ constexpr void Matrix3::Identity(Matrix3* result) noexcept
     );
 }
 
+constexpr Matrix3 Matrix3::Rotation(const float_t angle, const Vector3& axis) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return Rotation(cos, sin, axis);
+}
+
+constexpr void Matrix3::Rotation(const float_t angle, const Vector3& axis, Matrix3* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    Rotation(cos, sin, axis, result);
+}
+
+constexpr Matrix3 Matrix3::RotationX(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationX(cos, sin);
+}
+
+constexpr void Matrix3::RotationX(const float_t angle, Matrix3* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationX(cos, sin, result);
+}
+
+constexpr Matrix3 Matrix3::RotationY(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationY(cos, sin);
+}
+
+constexpr void Matrix3::RotationY(const float_t angle, Matrix3* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationY(cos, sin, result);
+}
+
+constexpr Matrix3 Matrix3::RotationZ(const float_t angle) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    return RotationZ(cos, sin);
+}
+
+constexpr void Matrix3::RotationZ(const float_t angle, Matrix3* result) noexcept
+{
+    float_t sin, cos;
+    Calc::SinCos(angle, &sin, &cos);
+    RotationZ(cos, sin, result);
+}
+
+constexpr Matrix3 Matrix3::Rotation(const Vector3& rotation) noexcept
+{
+    Matrix3 result;
+    Rotation(rotation, &result);
+    return result;
+}
+
+constexpr void Matrix3::Rotation(const Vector3& rotation, Matrix3* result) noexcept
+{
+    Vector3 sin, cos;
+    Calc::SinCos(rotation, &sin, &cos);
+    Rotation(cos, sin, result);
+}
+
+constexpr Matrix3 Matrix3::Rotation(const float_t cos, const float_t sin, const Vector3& axis) noexcept
+{
+    const float_t c2 = 1.f - cos;
+    Vector3 v = axis.Normalized();
+
+    return Matrix3(
+        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin,
+        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin,
+        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos
+    );
+}
+
+constexpr void Matrix3::Rotation(const float_t cos, const float_t sin, const Vector3& axis, Matrix3* result) noexcept
+{
+    const float_t c2 = 1.f - cos;
+    Vector3 v = axis.Normalized();
+
+    *result = Matrix3(
+        SQ(v.x) * c2 + cos, v.y * v.x * c2 - v.z * sin, v.z * v.x * c2 + v.y * sin,
+        v.x * v.y * c2 - v.z * sin, SQ(v.y) * c2 + cos, v.z * v.y * c2 - v.x * sin,
+        v.x * v.z * c2 - v.y * sin, v.y * v.z * c2 + v.x * sin, SQ(v.z) * c2 + cos
+    );
+}
+
 constexpr Matrix3 Matrix3::RotationX(const float_t cos, const float_t sin) noexcept
 {
     return Matrix3(
@@ -542,6 +708,42 @@ constexpr void Matrix3::RotationZ(const float_t cos, const float_t sin, Matrix3*
     );
 }
 
+constexpr void Matrix3::Multiply(const Matrix3& lhs, const Matrix3& rhs, Matrix3* result) noexcept
+{
+    *result = Matrix3(
+        lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20,
+        lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21,
+        lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22,
+
+        lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20,
+        lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21,
+        lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22,
+
+        lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20,
+        lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21,
+        lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22
+    );
+}
+
+constexpr Matrix3 Matrix3::Rotation(const Vector3& cos, const Vector3& sin) noexcept
+{
+    Matrix3 result;
+    Rotation(cos, sin, &result);
+    return result;
+}
+
+constexpr void Matrix3::Rotation(const Vector3& cos, const Vector3& sin, Matrix3* result) noexcept
+{
+    const float_t sinYCosX = sin.y * cos.x;
+    const float_t sinYSinX = sin.y * sin.x;
+
+    *result = Matrix3(
+        cos.y * cos.z, cos.z * sinYSinX - sin.z * cos.x, cos.z * sinYCosX + sin.z * sin.x,
+        cos.y * sin.z, sin.z * sinYSinX + cos.z * cos.x, sin.z * sinYCosX - cos.z * sin.x,
+               -sin.y,                    cos.y * sin.x,                    cos.y * cos.x
+    );
+}
+
 constexpr Matrix3 Matrix3::Rotation(const Quaternion& rotation) noexcept
 {
     Matrix3 result;
@@ -665,11 +867,25 @@ constexpr Matrix3 Matrix3::Inverted() const
 }
 
 constexpr void Matrix3::Inverted(Matrix3* result) const
+{
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Matrix3 isn't invertible"));
+}
+
+constexpr std::optional<Matrix3> Matrix3::TryInverted() const noexcept
+{
+    Matrix3 result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix3::TryInverted(Matrix3* result) const noexcept
 {
     const float_t determinant = Determinant();
 
     if (determinant == 0.f) [[unlikely]]
-        throw std::invalid_argument("Matrix3 isn't invertible");
+        return false;
 
     *result = Matrix3(
         m11 * m22 - m12 * m21,
@@ -684,6 +900,8 @@ constexpr void Matrix3::Inverted(Matrix3* result) const
       -(m00 * m21 - m01 * m20),
         m00 * m11 - m01 * m10
     ) * (1.f / determinant);
+
+    return true;
 }
 
 constexpr float_t Matrix3::At(const size_t row, const size_t col) const
@@ -692,7 +910,7 @@ constexpr float_t Matrix3::At(const size_t row, const size_t col) const
         return Data()[col * 3 + row];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix3 subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix3 subscript out of range"));
 }
 
 constexpr float_t& Matrix3::At(const size_t row, const size_t col)
@@ -701,9 +919,13 @@ constexpr float_t& Matrix3::At(const size_t row, const size_t col)
         return Data()[col * 3 + row];
 
     [[unlikely]]
-    throw std::out_of_range("Matrix3 subscript out of range");
+    MATH_THROW(std::out_of_range("Matrix3 subscript out of range"));
 }
 
+constexpr float_t Matrix3::UncheckedAt(const size_t row, const size_t col) const noexcept { return Data()[col * 3 + row]; }
+
+constexpr float_t& Matrix3::UncheckedAt(const size_t row, const size_t col) noexcept { return Data()[col * 3 + row]; }
+
 constexpr Vector3 Matrix3::operator[](const size_t col) const
 {
     return Vector3(Data() + static_cast<ptrdiff_t>(col) * 3);
@@ -0,0 +1,8 @@
+#include "Math/matrix3a.hpp"
+
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Matrix3A& m)
+{
+    return out << "{ { " << m.m00 << ' ' << m.m01 << ' ' << m.m02 << " } { "
+        << m.m10 << ' ' << m.m11 << ' ' << m.m12 << " } { "
+        << m.m20 << ' ' << m.m21 << ' ' << m.m22 << " } }";
+}
@@ -0,0 +1,671 @@
+#pragma once
+
+#include <format>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/calc.hpp"
+#include "Math/matrix3.hpp"
+#include "Math/simd.hpp"
+#include "Math/vector3.hpp"
+#include "Math/vector3a.hpp"
+
+/// @file matrix3a.hpp
+/// @brief Defines the Matrix3A struct.
+
+/// @brief The Matrix3A struct represents a 3x3 matrix whose columns are padded to 16 bytes, the whole struct being 16-byte aligned.
+///
+/// It is stored using the column-major convention like Matrix3, but each column can be loaded with a single aligned SIMD instruction,
+/// so that its products, transposition, inversion and vector transformations run on SIMD registers when @c MATH_SIMD_SSE is defined.
+/// This makes it a better fit than Matrix3 for normal matrices or inertia tensors used in hot loops.
+/// Conversions from and to Matrix3 are explicit but don't lose any information.
+struct MATH_TOOLBOX alignas(16) Matrix3A
+{
+    /// @brief The component at position [0, 0] of a Matrix3A.
+    float_t m00 = 0.f;
+
+    /// @brief The component at position [1, 0] of a Matrix3A.
+    float_t m10 = 0.f;
+
+    /// @brief The component at position [2, 0] of a Matrix3A.
+    float_t m20 = 0.f;
+
+private:
+    /// @brief Pads the first column to 16 bytes. Its value is unspecified and ignored by every operation.
+    float_t m_Padding0 = 0.f;
+
+public:
+    /// @brief The component at position [0, 1] of a Matrix3A.
+    float_t m01 = 0.f;
+
+    /// @brief The component at position [1, 1] of a Matrix3A.
+    float_t m11 = 0.f;
+
+    /// @brief The component at position [2, 1] of a Matrix3A.
+    float_t m21 = 0.f;
+
+private:
+    /// @brief Pads the second column to 16 bytes. Its value is unspecified and ignored by every operation.
+    float_t m_Padding1 = 0.f;
+
+public:
+    /// @brief The component at position [0, 2] of a Matrix3A.
+    float_t m02 = 0.f;
+
+    /// @brief The component at position [1, 2] of a Matrix3A.
+    float_t m12 = 0.f;
+
+    /// @brief The component at position [2, 2] of a Matrix3A.
+    float_t m22 = 0.f;
+
+private:
+    /// @brief Pads the third column to 16 bytes. Its value is unspecified and ignored by every operation.
+    float_t m_Padding2 = 0.f;
+
+public:
+    /// @brief Returns the identity Matrix3A.
+    [[nodiscard]]
+    static constexpr Matrix3A Identity() noexcept;
+
+    /// @brief Returns the identity Matrix3A.
+    static constexpr void Identity(Matrix3A* result) noexcept;
+
+    /// @brief Constructs a Matrix3A with all its values set to 0.
+    constexpr Matrix3A() = default;
+
+    /// @brief Constructs a Matrix3A with its components set to the data pointed by @c data.
+    ///
+    /// This constructor assumes that @c data is a valid pointer pointing to at least 9 @c float_t values, stored column by column without padding like in a Matrix3.
+    ///
+    /// @param data The data where the values for this Matrix3A's components are located.
+    constexpr explicit Matrix3A(const float_t* data) noexcept;
+
+    /// @brief Constructs a Matrix3A with 3 column vectors.
+    constexpr Matrix3A(const Vector3A& c0, const Vector3A& c1, const Vector3A& c2) noexcept;
+
+    /// @brief Constructs a Matrix3A with 9 values, given row by row.
+    constexpr Matrix3A(
+        float_t m00, float_t m01, float_t m02,
+        float_t m10, float_t m11, float_t m12,
+        float_t m20, float_t m21, float_t m22
+    ) noexcept;
+
+    /// @brief Constructs a Matrix3A with the same values as @p matrix.
+    constexpr explicit Matrix3A(const Matrix3& matrix) noexcept;
+
+    /// @brief Gets a pointer to the first value of this Matrix3A.
+    ///
+    /// The columns start every 4 values, e.g. at @c Data(), @c Data() @c + @c 4 and @c Data() @c + @c 8.
+    ///
+    /// @returns A pointer to the first value of this Matrix3A.
+    [[nodiscard]]
+    constexpr const float_t* Data() const noexcept;
+
+    /// @brief Gets a pointer to the first value of this Matrix3A.
+    ///
+    /// The columns start every 4 values, e.g. at @c Data(), @c Data() @c + @c 4 and @c Data() @c + @c 8.
+    ///
+    /// @returns A pointer to the first value of this Matrix3A.
+    [[nodiscard]]
+    constexpr float_t* Data() noexcept;
+
+    /// @brief Returns whether this Matrix3A is the identity matrix.
+    [[nodiscard]]
+    constexpr bool_t IsIdentity() const noexcept;
+
+    /// @brief Returns the determinant of this Matrix3A.
+    [[nodiscard]]
+    constexpr float_t Determinant() const noexcept;
+
+    /// @brief Switches the Matrix3A by its diagonal elements.
+    [[nodiscard]]
+    constexpr Matrix3A Transposed() const noexcept;
+
+    /// @brief Switches the Matrix3A by its diagonal elements.
+    constexpr void Transposed(Matrix3A* result) const noexcept;
+
+    /// @brief Computes the invert of this Matrix3A, e.g. @c *this * Inverted() == Identity() is true.
+    ///
+    /// @throws std::invalid_argument If this Matrix3A isn't invertible.
+    [[nodiscard]]
+    constexpr Matrix3A Inverted() const;
+
+    /// @brief Computes the invert of this Matrix3A, e.g. @c *this * Inverted() == Identity() is true.
+    ///
+    /// @throws std::invalid_argument If this Matrix3A isn't invertible.
+    constexpr void Inverted(Matrix3A* result) const;
+
+    /// @brief Computes the invert of this Matrix3A like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<Matrix3A> TryInverted() const noexcept;
+
+    /// @brief Computes the invert of this Matrix3A like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(Matrix3A* result) const noexcept;
+
+    /// @brief Retrieves this Matrix3A's value at position @c [row, col].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [row, col].
+    [[nodiscard]]
+    constexpr float_t At(size_t row, size_t col) const;
+
+    /// @brief Retrieves this Matrix3A's value at position @c [row, col].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [row, col].
+    [[nodiscard]]
+    constexpr float_t& At(size_t row, size_t col);
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t row, size_t col) noexcept;
+
+    /// @brief Retrieves this Matrix3A's column vector at position @c col.
+    ///
+    /// @param col The index of the column to get.
+    /// @returns The column vector at index @c col.
+    [[nodiscard]]
+    constexpr Vector3A operator[](size_t col) const;
+
+    /// @brief Retrieves this Matrix3A's column vector at position @c col.
+    ///
+    /// As the columns are padded to 16 bytes, they can be modified directly as @ref Vector3A "Vector3As".
+    ///
+    /// @param col The index of the column to get.
+    /// @returns The column vector at index @c col.
+    [[nodiscard]]
+    constexpr Vector3A& operator[](size_t col);
+
+    /// @brief Converts this Matrix3A to a Matrix3.
+    [[nodiscard]]
+    constexpr explicit operator Matrix3() const noexcept;
+};
+
+static_assert(std::is_default_constructible_v<Matrix3A>, "Class Matrix3A must be default constructible.");
+static_assert(std::is_copy_constructible_v<Matrix3A>, "Class Matrix3A must be copy constructible.");
+static_assert(std::is_move_constructible_v<Matrix3A>, "Class Matrix3A must be move constructible.");
+static_assert(std::is_copy_assignable_v<Matrix3A>, "Class Matrix3A must be copy assignable.");
+static_assert(std::is_move_assignable_v<Matrix3A>, "Class Matrix3A must be move assignable.");
+static_assert(sizeof(Matrix3A) == 48 && alignof(Matrix3A) == 16, "Class Matrix3A must be 48 bytes large and 16-byte aligned.");
+
+/// @brief Returns the opposite of a Matrix3A.
+[[nodiscard]]
+constexpr Matrix3A operator-(const Matrix3A& matrix) noexcept;
+
+/// @brief Adds the values of two @ref Matrix3A "Matrix3As" one by one.
+[[nodiscard]]
+constexpr Matrix3A operator+(const Matrix3A& m1, const Matrix3A& m2) noexcept;
+
+/// @brief Subtracts the values of two @ref Matrix3A "Matrix3As" one by one.
+[[nodiscard]]
+constexpr Matrix3A operator-(const Matrix3A& m1, const Matrix3A& m2) noexcept;
+
+/// @brief Multiplies all values of a Matrix3A by a @p scalar.
+[[nodiscard]]
+constexpr Matrix3A operator*(const Matrix3A& m, float_t scalar) noexcept;
+
+/// @brief Multiplies all values of a Matrix3A by a @p scalar.
+[[nodiscard]]
+constexpr Matrix3A operator*(float_t scalar, const Matrix3A& m) noexcept;
+
+/// @brief Multiplies two @ref Matrix3A "Matrix3As".
+///
+/// Unlike @ref Matrix3 products, this one is evaluated right away.
+[[nodiscard]]
+constexpr Matrix3A operator*(const Matrix3A& lhs, const Matrix3A& rhs) noexcept;
+
+/// @brief Multiplies a Vector3A by a Matrix3A.
+[[nodiscard]]
+constexpr Vector3A operator*(const Matrix3A& m, const Vector3A& v) noexcept;
+
+/// @brief Multiplies a Vector3 by a Matrix3A.
+[[nodiscard]]
+constexpr Vector3 operator*(const Matrix3A& m, const Vector3& v) noexcept;
+
+/// @brief Adds two @ref Matrix3A "Matrix3As" according to @ref operator+(const Matrix3A&, const Matrix3A&), placing the result in @p m1.
+constexpr Matrix3A& operator+=(Matrix3A& m1, const Matrix3A& m2) noexcept;
+
+/// @brief Subtracts two @ref Matrix3A "Matrix3As" according to @ref operator-(const Matrix3A&, const Matrix3A&), placing the result in @p m1.
+constexpr Matrix3A& operator-=(Matrix3A& m1, const Matrix3A& m2) noexcept;
+
+/// @brief Multiplies a Matrix3A by a @p scalar according to @ref operator*(const Matrix3A&, float_t), placing the result in @p m.
+constexpr Matrix3A& operator*=(Matrix3A& m, float_t scalar) noexcept;
+
+/// @brief Multiplies two @ref Matrix3A "Matrix3As" according to @ref operator*(const Matrix3A&, const Matrix3A&), placing the result in @p lhs.
+constexpr Matrix3A& operator*=(Matrix3A& lhs, const Matrix3A& rhs) noexcept;
+
+/// @brief Checks if two @ref Matrix3A "Matrix3As" are equal.
+[[nodiscard]]
+constexpr bool_t operator==(const Matrix3A& a, const Matrix3A& b) noexcept;
+
+/// @brief Checks if two @ref Matrix3A "Matrix3As" are different.
+[[nodiscard]]
+constexpr bool_t operator!=(const Matrix3A& a, const Matrix3A& b) noexcept;
+
+/// @brief Streams a Matrix3A into @p out, printing its values one by one on a single line.
+MATH_TOOLBOX std::ostream& operator<<(std::ostream& out, const Matrix3A& m);
+
+constexpr Matrix3A Matrix3A::Identity() noexcept
+{
+    return Matrix3A(
+        1.f, 0.f, 0.f,
+        0.f, 1.f, 0.f,
+        0.f, 0.f, 1.f
+    );
+}
+
+constexpr void Matrix3A::Identity(Matrix3A* result) noexcept { *result = Identity(); }
+
+constexpr Matrix3A::Matrix3A(const float_t* const data) noexcept
+    : m00(data[0]), m10(data[1]), m20(data[2])
+    , m01(data[3]), m11(data[4]), m21(data[5])
+    , m02(data[6]), m12(data[7]), m22(data[8])
+{
+}
+
+constexpr Matrix3A::Matrix3A(const Vector3A& c0, const Vector3A& c1, const Vector3A& c2) noexcept
+    : m00(c0.x), m10(c0.y), m20(c0.z)
+    , m01(c1.x), m11(c1.y), m21(c1.z)
+    , m02(c2.x), m12(c2.y), m22(c2.z)
+{
+}
+
+constexpr Matrix3A::Matrix3A(
+    const float_t m00, const float_t m01, const float_t m02,
+    const float_t m10, const float_t m11, const float_t m12,
+    const float_t m20, const float_t m21, const float_t m22
+) noexcept
+    : m00(m00), m10(m10), m20(m20)
+    , m01(m01), m11(m11), m21(m21)
+    , m02(m02), m12(m12), m22(m22)
+{
+}
+
+constexpr Matrix3A::Matrix3A(const Matrix3& matrix) noexcept
+    : m00(matrix.m00), m10(matrix.m10), m20(matrix.m20)
+    , m01(matrix.m01), m11(matrix.m11), m21(matrix.m21)
+    , m02(matrix.m02), m12(matrix.m12), m22(matrix.m22)
+{
+}
+
+constexpr const float_t* Matrix3A::Data() const noexcept { return &m00; }
+
+constexpr float_t* Matrix3A::Data() noexcept { return &m00; }
+
+constexpr bool_t Matrix3A::IsIdentity() const noexcept
+{
+    return Calc::Equals(m00, 1.f) && Calc::IsZero(m01) && Calc::IsZero(m02)
+        && Calc::IsZero(m10) && Calc::Equals(m11, 1.f) && Calc::IsZero(m12)
+        && Calc::IsZero(m20) && Calc::IsZero(m21) && Calc::Equals(m22, 1.f);
+}
+
+constexpr float_t Matrix3A::Determinant() const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        const __m128 c0 = _mm_load_ps(Data());
+        return _mm_cvtss_f32(Simd::Dot3(c0, Simd::Cross3(_mm_load_ps(Data() + 4), _mm_load_ps(Data() + 8))));
+    }
+#endif
+
+    return m00 * (m11 * m22 - m12 * m21)
+        + m01 * (m12 * m20 - m10 * m22)
+        + m02 * (m10 * m21 - m11 * m20);
+}
+
+constexpr Matrix3A Matrix3A::Transposed() const noexcept
+{
+    Matrix3A result;
+    Transposed(&result);
+    return result;
+}
+
+constexpr void Matrix3A::Transposed(Matrix3A* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Simd::TransposeMatrix3A(Data(), result->Data());
+        return;
+    }
+#endif
+
+    *result = Matrix3A(
+        m00, m10, m20,
+        m01, m11, m21,
+        m02, m12, m22
+    );
+}
+
+constexpr Matrix3A Matrix3A::Inverted() const
+{
+    Matrix3A result;
+    Inverted(&result);
+    return result;
+}
+
+constexpr void Matrix3A::Inverted(Matrix3A* result) const
+{
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("Matrix3A isn't invertible"));
+}
+
+constexpr std::optional<Matrix3A> Matrix3A::TryInverted() const noexcept
+{
+    Matrix3A result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+constexpr bool_t Matrix3A::TryInverted(Matrix3A* result) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::InvertMatrix3A(Data(), result->Data());
+#endif
+
+    const float_t cofactor00 = m11 * m22 - m12 * m21;
+    const float_t cofactor01 = m12 * m20 - m10 * m22;
+    const float_t cofactor02 = m10 * m21 - m11 * m20;
+
+    const float_t determinant = m00 * cofactor00 + m01 * cofactor01 + m02 * cofactor02;
+
+    if (determinant == 0.f) [[unlikely]]
+        return false;
+
+    const float_t invDeterminant = 1.f / determinant;
+
+    *result = Matrix3A(
+        cofactor00 * invDeterminant,
+        (m02 * m21 - m01 * m22) * invDeterminant,
+        (m01 * m12 - m02 * m11) * invDeterminant,
+
+        cofactor01 * invDeterminant,
+        (m00 * m22 - m02 * m20) * invDeterminant,
+        (m02 * m10 - m00 * m12) * invDeterminant,
+
+        cofactor02 * invDeterminant,
+        (m01 * m20 - m00 * m21) * invDeterminant,
+        (m00 * m11 - m01 * m10) * invDeterminant
+    );
+
+    return true;
+}
+
+constexpr float_t Matrix3A::At(const size_t row, const size_t col) const
+{
+    if (row < 3 && col < 3) [[likely]]
+        return Data()[col * 4 + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("Matrix3A subscript out of range"));
+}
+
+constexpr float_t& Matrix3A::At(const size_t row, const size_t col)
+{
+    if (row < 3 && col < 3) [[likely]]
+        return Data()[col * 4 + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("Matrix3A subscript out of range"));
+}
+
+constexpr float_t Matrix3A::UncheckedAt(const size_t row, const size_t col) const noexcept { return Data()[col * 4 + row]; }
+
+constexpr float_t& Matrix3A::UncheckedAt(const size_t row, const size_t col) noexcept { return Data()[col * 4 + row]; }
+
+constexpr Vector3A Matrix3A::operator[](const size_t col) const
+{
+    return Vector3A(Data() + static_cast<ptrdiff_t>(col) * 4);
+}
+
+constexpr Vector3A& Matrix3A::operator[](const size_t col)
+{
+    // Pointer arithmetic magic to get around not being able to use reinterpret_cast
+    return *static_cast<Vector3A*>(static_cast<void*>(Data() + static_cast<ptrdiff_t>(col) * 4));
+}
+
+constexpr Matrix3A::operator Matrix3() const noexcept
+{
+    return Matrix3(
+        m00, m01, m02,
+        m10, m11, m12,
+        m20, m21, m22
+    );
+}
+
+constexpr Matrix3A operator-(const Matrix3A& matrix) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Matrix3A result;
+        for (size_t i = 0; i < 12; i += 4)
+            _mm_store_ps(result.Data() + i, Simd::Negate(_mm_load_ps(matrix.Data() + i)));
+        return result;
+    }
+#endif
+
+    return Matrix3A(
+        -matrix.m00, -matrix.m01, -matrix.m02,
+        -matrix.m10, -matrix.m11, -matrix.m12,
+        -matrix.m20, -matrix.m21, -matrix.m22
+    );
+}
+
+constexpr Matrix3A operator+(const Matrix3A& m1, const Matrix3A& m2) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Matrix3A result;
+        for (size_t i = 0; i < 12; i += 4)
+            _mm_store_ps(result.Data() + i, _mm_add_ps(_mm_load_ps(m1.Data() + i), _mm_load_ps(m2.Data() + i)));
+        return result;
+    }
+#endif
+
+    return Matrix3A(
+        m1.m00 + m2.m00, m1.m01 + m2.m01, m1.m02 + m2.m02,
+        m1.m10 + m2.m10, m1.m11 + m2.m11, m1.m12 + m2.m12,
+        m1.m20 + m2.m20, m1.m21 + m2.m21, m1.m22 + m2.m22
+    );
+}
+
+constexpr Matrix3A operator-(const Matrix3A& m1, const Matrix3A& m2) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Matrix3A result;
+        for (size_t i = 0; i < 12; i += 4)
+            _mm_store_ps(result.Data() + i, _mm_sub_ps(_mm_load_ps(m1.Data() + i), _mm_load_ps(m2.Data() + i)));
+        return result;
+    }
+#endif
+
+    return Matrix3A(
+        m1.m00 - m2.m00, m1.m01 - m2.m01, m1.m02 - m2.m02,
+        m1.m10 - m2.m10, m1.m11 - m2.m11, m1.m12 - m2.m12,
+        m1.m20 - m2.m20, m1.m21 - m2.m21, m1.m22 - m2.m22
+    );
+}
+
+constexpr Matrix3A operator*(const Matrix3A& m, const float_t scalar) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        const __m128 factor = _mm_set1_ps(scalar);
+        Matrix3A result;
+        for (size_t i = 0; i < 12; i += 4)
+            _mm_store_ps(result.Data() + i, _mm_mul_ps(_mm_load_ps(m.Data() + i), factor));
+        return result;
+    }
+#endif
+
+    return Matrix3A(
+        m.m00 * scalar, m.m01 * scalar, m.m02 * scalar,
+        m.m10 * scalar, m.m11 * scalar, m.m12 * scalar,
+        m.m20 * scalar, m.m21 * scalar, m.m22 * scalar
+    );
+}
+
+constexpr Matrix3A operator*(const float_t scalar, const Matrix3A& m) noexcept { return m * scalar; }
+
+constexpr Matrix3A operator*(const Matrix3A& lhs, const Matrix3A& rhs) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        Matrix3A result;
+        Simd::MultiplyMatrix3A(lhs.Data(), rhs.Data(), result.Data());
+        return result;
+    }
+#endif
+
+    return Matrix3A(
+        lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20,
+        lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21,
+        lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22,
+
+        lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20,
+        lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21,
+        lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22,
+
+        lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20,
+        lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21,
+        lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22
+    );
+}
+
+constexpr Vector3A operator*(const Matrix3A& m, const Vector3A& v) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        return Simd::Store<Vector3A>(
+            Simd::LinearCombination3(Simd::Load(v), _mm_load_ps(m.Data()), _mm_load_ps(m.Data() + 4), _mm_load_ps(m.Data() + 8))
+        );
+    }
+#endif
+
+    return Vector3A(
+        v.x * m.m00 + v.y * m.m01 + v.z * m.m02,
+        v.x * m.m10 + v.y * m.m11 + v.z * m.m12,
+        v.x * m.m20 + v.y * m.m21 + v.z * m.m22
+    );
+}
+
+constexpr Vector3 operator*(const Matrix3A& m, const Vector3& v) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+    {
+        const __m128 result = Simd::LinearCombination3(
+            _mm_setr_ps(v.x, v.y, v.z, 0.f),
+            _mm_load_ps(m.Data()),
+            _mm_load_ps(m.Data() + 4),
+            _mm_load_ps(m.Data() + 8)
+        );
+
+        // Vector3 isn't padded, so its 3 components are stored as 2 then 1 values
+        Vector3 v3;
+        _mm_storel_pi(reinterpret_cast<__m64*>(v3.Data()), result);
+        _mm_store_ss(v3.Data() + 2, _mm_movehl_ps(result, result));
+        return v3;
+    }
+#endif
+
+    return Vector3(
+        v.x * m.m00 + v.y * m.m01 + v.z * m.m02,
+        v.x * m.m10 + v.y * m.m11 + v.z * m.m12,
+        v.x * m.m20 + v.y * m.m21 + v.z * m.m22
+    );
+}
+
+constexpr Matrix3A& operator+=(Matrix3A& m1, const Matrix3A& m2) noexcept { return m1 = m1 + m2; }
+
+constexpr Matrix3A& operator-=(Matrix3A& m1, const Matrix3A& m2) noexcept { return m1 = m1 - m2; }
+
+constexpr Matrix3A& operator*=(Matrix3A& m, const float_t scalar) noexcept { return m = m * scalar; }
+
+constexpr Matrix3A& operator*=(Matrix3A& lhs, const Matrix3A& rhs) noexcept { return lhs = lhs * rhs; }
+
+constexpr bool_t operator==(const Matrix3A& a, const Matrix3A& b) noexcept
+{
+    return a.m00 == b.m00 && a.m01 == b.m01 && a.m02 == b.m02
+        && a.m10 == b.m10 && a.m11 == b.m11 && a.m12 == b.m12
+        && a.m20 == b.m20 && a.m21 == b.m21 && a.m22 == b.m22;
+}
+
+constexpr bool_t operator!=(const Matrix3A& a, const Matrix3A& b) noexcept { return !(a == b); }
+
+template <>
+struct std::formatter<Matrix3A>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx);
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(const Matrix3A& m, FmtContext& ctx) const;
+
+private:
+    std::string m_Format;
+    bool_t m_Multiline = false;
+};
+
+template <class ParseContext>
+constexpr typename ParseContext::iterator std::formatter<Matrix3A, char_t>::parse(ParseContext& ctx)
+{
+    auto it = ctx.begin();
+    if (it == ctx.end())
+        return it;
+
+    if (*it == 'm')
+    {
+        m_Multiline = true;
+        it++;
+    }
+
+    while (*it != '}' && it != ctx.end())
+        m_Format += *it++;
+
+    return it;
+}
+
+template <class FmtContext>
+typename FmtContext::iterator std::formatter<Matrix3A>::format(const Matrix3A& m, FmtContext& ctx) const
+{
+    std::ostringstream out;
+
+    const char_t separator = m_Multiline ? '\n' : ' ';
+
+    out << std::vformat(
+            "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]" + separator
+            + "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]" + separator
+            + "[ {:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + "} ]",
+            std::make_format_args(
+                    m.m00, m.m01, m.m02,
+                    m.m10, m.m11, m.m12,
+                    m.m20, m.m21, m.m22
+            )
+    );
+
+    return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+}
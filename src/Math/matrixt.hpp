@@ -0,0 +1,748 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <format>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/calc.hpp"
+#include "Math/expression.hpp"
+
+/// @file matrixt.hpp
+/// @brief Defines the MatrixT template, of which Matrix2, Matrix3 and Matrix are specializations.
+
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT;
+
+// Matrix2, Matrix3 and Matrix are explicit specializations of MatrixT, defined in their own header
+template <>
+struct MatrixT<2, 2, float_t>;
+
+template <>
+struct MatrixT<3, 3, float_t>;
+
+template <>
+struct MatrixT<4, 4, float_t>;
+
+using Matrix2 = MatrixT<2, 2, float_t>;
+using Matrix3 = MatrixT<3, 3, float_t>;
+using Matrix = MatrixT<4, 4, float_t>;
+
+/// @brief A 3x4 float %Matrix, e.g. the first three rows of an affine transformation Matrix.
+using Matrix3x4 = MatrixT<3, 4, float_t>;
+
+/// @brief A 4x3 float %Matrix, e.g. the transpose of a Matrix3x4.
+using Matrix4x3 = MatrixT<4, 3, float_t>;
+
+/// @brief A 2x2 double %Matrix.
+using Matrix2d = MatrixT<2, 2, double_t>;
+
+/// @brief A 3x3 double %Matrix.
+using Matrix3d = MatrixT<3, 3, double_t>;
+
+/// @brief A 4x4 double %Matrix.
+using Matrixd = MatrixT<4, 4, double_t>;
+
+/// @brief A 3x4 double %Matrix.
+using Matrix3x4d = MatrixT<3, 4, double_t>;
+
+/// @brief A 4x3 double %Matrix.
+using Matrix4x3d = MatrixT<4, 3, double_t>;
+
+/// @brief The MatrixT struct represents a @p Rows by @p Cols array of @p T values mainly used for mathematical operations.
+///
+/// Matrices are stored using the column-major convention.
+/// The 2x2, 3x3 and 4x4 float matrices are the Matrix2, Matrix3 and Matrix specializations, which keep their named components and SIMD code paths.
+/// Every other shape and value type, like Matrix3x4 or Matrixd, uses this generic implementation.
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT
+{
+    static_assert(Rows > 0 && Cols > 0, "A MatrixT must have at least one row and one column");
+    static_assert(std::is_floating_point_v<T>, "The values of a MatrixT must be floating-point values");
+
+    /// @brief The components of this matrix, stored column by column.
+    std::array<T, Rows * Cols> components{};
+
+    /// @brief Returns the identity %Matrix.
+    ///
+    /// The identity %Matrix is one with its diagonal set to one and everything else set to zero.
+    /// For a non-square %Matrix, the diagonal stops at its last row or column.
+    [[nodiscard]]
+    static constexpr MatrixT Identity() noexcept;
+
+    /// @brief Returns the identity %Matrix.
+    ///
+    /// The identity %Matrix is one with its diagonal set to one and everything else set to zero.
+    /// For a non-square %Matrix, the diagonal stops at its last row or column.
+    static constexpr void Identity(MatrixT* result) noexcept;
+
+    /// @brief Creates a MatrixT with all its values set to 0.
+    constexpr MatrixT() = default;
+
+    /// @brief Creates a MatrixT with all its values set to this default value.
+    constexpr explicit MatrixT(T defaultValue) noexcept;
+
+    /// @brief Constructs a MatrixT with its components set to the data pointed by @c data.
+    ///
+    /// This constructor assumes that @c data is a valid pointer pointing to at least @p Rows * @p Cols @p T values, stored column by column.
+    ///
+    /// @param data The data where the values for this matrix's components are located.
+    constexpr explicit MatrixT(const T* data) noexcept;
+
+    /// @brief Constructs a MatrixT with @p Rows * @p Cols values, given row by row.
+    template <std::convertible_to<T>... Args>
+        requires (sizeof...(Args) == Rows * Cols && Rows * Cols > 1)
+    constexpr MatrixT(Args... values) noexcept; // NOLINT(google-explicit-constructor)
+
+    /// @brief Converts a MatrixT of the same shape to this value type.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    constexpr explicit MatrixT(const MatrixT<Rows, Cols, U>& other) noexcept;
+
+    /// @brief Gets a pointer to the first value of this MatrixT.
+    ///
+    /// @returns A pointer to the first value of this MatrixT.
+    [[nodiscard]]
+    constexpr const T* Data() const noexcept;
+
+    /// @brief Gets a pointer to the first value of this MatrixT.
+    ///
+    /// @returns A pointer to the first value of this MatrixT.
+    [[nodiscard]]
+    constexpr T* Data() noexcept;
+
+    /// @brief Returns whether the MatrixT has everything except its diagonal set to zero.
+    [[nodiscard]]
+    constexpr bool_t IsDiagonal() const noexcept;
+
+    /// @brief Returns whether the MatrixT is the identity matrix.
+    ///
+    /// If this returns true, MatrixT::Identity() == *this should be true.
+    [[nodiscard]]
+    constexpr bool_t IsIdentity() const noexcept;
+
+    /// @brief Returns whether this MatrixT has everything set to zero.
+    [[nodiscard]]
+    constexpr bool_t IsNull() const noexcept;
+
+    /// @brief Returns whether the MatrixT is symmetric by its diagonal elements.
+    [[nodiscard]]
+    constexpr bool_t IsSymmetric() const noexcept requires (Rows == Cols);
+
+    /// @brief Returns whether the MatrixT is symmetric by its diagonal elements but one of the sides is the opposite of the other.
+    [[nodiscard]]
+    constexpr bool_t IsAntisymmetric() const noexcept requires (Rows == Cols);
+
+    /// @brief Returns the sum of the diagonal elements of the MatrixT.
+    [[nodiscard]]
+    constexpr T Trace() const noexcept requires (Rows == Cols);
+
+    /// @brief Returns the determinant of this MatrixT.
+    [[nodiscard]]
+    constexpr T Determinant() const noexcept requires (Rows == Cols);
+
+    /// @brief Switches the MatrixT by its diagonal elements.
+    [[nodiscard]]
+    constexpr MatrixT<Cols, Rows, T> Transposed() const noexcept;
+
+    /// @brief Switches the MatrixT by its diagonal elements.
+    constexpr void Transposed(MatrixT<Cols, Rows, T>* result) const noexcept;
+
+    /// @brief Computes the invert of this MatrixT, e.g. @c *this * Inverted() == Identity() is true.
+    ///
+    /// @throws std::invalid_argument If this MatrixT isn't invertible.
+    [[nodiscard]]
+    constexpr MatrixT Inverted() const requires (Rows == Cols);
+
+    /// @brief Computes the invert of this MatrixT, e.g. @c *this * Inverted() == Identity() is true.
+    ///
+    /// @param result The output of the function. May be this MatrixT.
+    ///
+    /// @throws std::invalid_argument If this MatrixT isn't invertible.
+    constexpr void Inverted(MatrixT* result) const requires (Rows == Cols);
+
+    /// @brief Computes the invert of this MatrixT like Inverted(), but returns @c std::nullopt instead of throwing if it isn't invertible.
+    [[nodiscard]]
+    constexpr std::optional<MatrixT> TryInverted() const noexcept requires (Rows == Cols);
+
+    /// @brief Computes the invert of this MatrixT like Inverted(), but returns @c false instead of throwing if it isn't invertible, leaving @p result unchanged.
+    [[nodiscard]]
+    constexpr bool_t TryInverted(MatrixT* result) const noexcept requires (Rows == Cols);
+
+    /// @brief Retrieves this matrix's value at position @c [col, row].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [col, row].
+    [[nodiscard]]
+    constexpr T At(size_t row, size_t col) const;
+
+    /// @brief Retrieves this matrix's value at position @c [col, row].
+    ///
+    /// @param row The index of the row to get.
+    /// @param col The index of the column to get.
+    /// @returns The value at position @c [col, row].
+    [[nodiscard]]
+    constexpr T& At(size_t row, size_t col);
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr T UncheckedAt(size_t row, size_t col) const noexcept;
+
+    /// @brief Retrieves this matrix's value at position @c [row, col] like At(), but without checking that it is in range.
+    [[nodiscard]]
+    constexpr T& UncheckedAt(size_t row, size_t col) noexcept;
+
+    /// @brief Converts this MatrixT to a MatrixT of the same shape holding another value type, e.g. a Matrixd to a Matrix.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    [[nodiscard]]
+    constexpr explicit operator MatrixT<Rows, Cols, U>() const noexcept;
+};
+
+/// @private
+/// @brief Returns the components of any MatrixT, column by column, including the Matrix2, Matrix3 and Matrix specializations.
+///
+/// Unlike @c Data(), this can be used in constant expressions for every specialization.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr std::array<T, Rows * Cols> GetMatrixComponents(const MatrixT<Rows, Cols, T>& m) noexcept
+{
+    return std::bit_cast<std::array<T, Rows * Cols>>(m);
+}
+
+/// @private
+/// @brief Creates any MatrixT from its components, column by column, including the Matrix2, Matrix3 and Matrix specializations.
+template <typename MatrixType, typename T, size_t Size>
+[[nodiscard]]
+constexpr MatrixType MakeMatrix(const std::array<T, Size>& components) noexcept
+{
+    return std::bit_cast<MatrixType>(components);
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T> MatrixT<Rows, Cols, T>::Identity() noexcept
+{
+    MatrixT result;
+    Identity(&result);
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr void MatrixT<Rows, Cols, T>::Identity(MatrixT* result) noexcept
+{
+    *result = MatrixT();
+    for (size_t i = 0; i < std::min(Rows, Cols); i++)
+        result->components[i * Rows + i] = static_cast<T>(1);
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>::MatrixT(const T defaultValue) noexcept
+{
+    components.fill(defaultValue);
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>::MatrixT(const T* const data) noexcept
+{
+    std::copy_n(data, Rows * Cols, components.begin());
+}
+
+template <size_t Rows, size_t Cols, typename T>
+template <std::convertible_to<T>... Args>
+    requires (sizeof...(Args) == Rows * Cols && Rows * Cols > 1)
+constexpr MatrixT<Rows, Cols, T>::MatrixT(Args... values) noexcept
+{
+    const T rowMajor[] = { static_cast<T>(values)... };
+    for (size_t row = 0; row < Rows; row++)
+    {
+        for (size_t col = 0; col < Cols; col++)
+            components[col * Rows + row] = rowMajor[row * Cols + col];
+    }
+}
+
+template <size_t Rows, size_t Cols, typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr MatrixT<Rows, Cols, T>::MatrixT(const MatrixT<Rows, Cols, U>& other) noexcept
+{
+    const std::array<U, Rows * Cols> m = GetMatrixComponents(other);
+    for (size_t i = 0; i < Rows * Cols; i++)
+        components[i] = static_cast<T>(m[i]);
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr const T* MatrixT<Rows, Cols, T>::Data() const noexcept { return components.data(); }
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T* MatrixT<Rows, Cols, T>::Data() noexcept { return components.data(); }
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::IsDiagonal() const noexcept
+{
+    for (size_t col = 0; col < Cols; col++)
+    {
+        for (size_t row = 0; row < Rows; row++)
+        {
+            if (row != col && Calc::Abs(components[col * Rows + row]) > static_cast<T>(Calc::Zero))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::IsIdentity() const noexcept
+{
+    if (!IsDiagonal())
+        return false;
+
+    for (size_t i = 0; i < std::min(Rows, Cols); i++)
+    {
+        if (Calc::Abs(components[i * Rows + i] - static_cast<T>(1)) > static_cast<T>(Calc::Zero))
+            return false;
+    }
+
+    return true;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::IsNull() const noexcept
+{
+    return std::ranges::all_of(components, [](const T value) { return Calc::Abs(value) <= static_cast<T>(Calc::Zero); });
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::IsSymmetric() const noexcept requires (Rows == Cols)
+{
+    for (size_t col = 1; col < Cols; col++)
+    {
+        for (size_t row = 0; row < col; row++)
+        {
+            if (Calc::Abs(components[col * Rows + row] - components[row * Rows + col]) > static_cast<T>(Calc::Zero))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::IsAntisymmetric() const noexcept requires (Rows == Cols)
+{
+    for (size_t col = 1; col < Cols; col++)
+    {
+        for (size_t row = 0; row < col; row++)
+        {
+            if (Calc::Abs(components[col * Rows + row] + components[row * Rows + col]) > static_cast<T>(Calc::Zero))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T MatrixT<Rows, Cols, T>::Trace() const noexcept requires (Rows == Cols)
+{
+    T result = 0;
+    for (size_t i = 0; i < Rows; i++)
+        result += components[i * Rows + i];
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T MatrixT<Rows, Cols, T>::Determinant() const noexcept requires (Rows == Cols)
+{
+    // Gaussian elimination with partial pivoting, the determinant being the product of the pivots
+    std::array<T, Rows * Cols> m = components;
+    T result = 1;
+
+    for (size_t col = 0; col < Cols; col++)
+    {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < Rows; row++)
+        {
+            if (Calc::Abs(m[col * Rows + row]) > Calc::Abs(m[col * Rows + pivot]))
+                pivot = row;
+        }
+
+        if (m[col * Rows + pivot] == 0)
+            return 0;
+
+        if (pivot != col)
+        {
+            for (size_t c = col; c < Cols; c++)
+                std::swap(m[c * Rows + col], m[c * Rows + pivot]);
+            result = -result;
+        }
+
+        const T diagonal = m[col * Rows + col];
+        result *= diagonal;
+
+        for (size_t row = col + 1; row < Rows; row++)
+        {
+            const T factor = m[col * Rows + row] / diagonal;
+            for (size_t c = col + 1; c < Cols; c++)
+                m[c * Rows + row] -= factor * m[c * Rows + col];
+        }
+    }
+
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Cols, Rows, T> MatrixT<Rows, Cols, T>::Transposed() const noexcept
+{
+    MatrixT<Cols, Rows, T> result;
+    Transposed(&result);
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr void MatrixT<Rows, Cols, T>::Transposed(MatrixT<Cols, Rows, T>* result) const noexcept
+{
+    std::array<T, Rows * Cols> transposed;
+    for (size_t col = 0; col < Cols; col++)
+    {
+        for (size_t row = 0; row < Rows; row++)
+            transposed[row * Cols + col] = components[col * Rows + row];
+    }
+    *result = MakeMatrix<MatrixT<Cols, Rows, T>>(transposed);
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T> MatrixT<Rows, Cols, T>::Inverted() const requires (Rows == Cols)
+{
+    MatrixT result;
+    Inverted(&result);
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr void MatrixT<Rows, Cols, T>::Inverted(MatrixT* result) const requires (Rows == Cols)
+{
+    if (!TryInverted(result)) [[unlikely]]
+        MATH_THROW(std::invalid_argument("MatrixT isn't invertible"));
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr std::optional<MatrixT<Rows, Cols, T>> MatrixT<Rows, Cols, T>::TryInverted() const noexcept requires (Rows == Cols)
+{
+    MatrixT result;
+    if (!TryInverted(&result)) [[unlikely]]
+        return std::nullopt;
+    return result;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t MatrixT<Rows, Cols, T>::TryInverted(MatrixT* result) const noexcept requires (Rows == Cols)
+{
+    // Gauss-Jordan elimination with partial pivoting, applying the same row operations to the identity
+    std::array<T, Rows * Cols> m = components;
+    MatrixT inverse = Identity();
+
+    for (size_t col = 0; col < Cols; col++)
+    {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < Rows; row++)
+        {
+            if (Calc::Abs(m[col * Rows + row]) > Calc::Abs(m[col * Rows + pivot]))
+                pivot = row;
+        }
+
+        if (m[col * Rows + pivot] == 0) [[unlikely]]
+            return false;
+
+        if (pivot != col)
+        {
+            for (size_t c = 0; c < Cols; c++)
+            {
+                std::swap(m[c * Rows + col], m[c * Rows + pivot]);
+                std::swap(inverse.components[c * Rows + col], inverse.components[c * Rows + pivot]);
+            }
+        }
+
+        const T invDiagonal = 1 / m[col * Rows + col];
+        for (size_t c = 0; c < Cols; c++)
+        {
+            m[c * Rows + col] *= invDiagonal;
+            inverse.components[c * Rows + col] *= invDiagonal;
+        }
+
+        for (size_t row = 0; row < Rows; row++)
+        {
+            if (row == col)
+                continue;
+
+            const T factor = m[col * Rows + row];
+            for (size_t c = 0; c < Cols; c++)
+            {
+                m[c * Rows + row] -= factor * m[c * Rows + col];
+                inverse.components[c * Rows + row] -= factor * inverse.components[c * Rows + col];
+            }
+        }
+    }
+
+    *result = inverse;
+
+    return true;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T MatrixT<Rows, Cols, T>::At(const size_t row, const size_t col) const
+{
+    if (row < Rows && col < Cols) [[likely]]
+        return components[col * Rows + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("MatrixT subscript out of range"));
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T& MatrixT<Rows, Cols, T>::At(const size_t row, const size_t col)
+{
+    if (row < Rows && col < Cols) [[likely]]
+        return components[col * Rows + row];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("MatrixT subscript out of range"));
+}
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T MatrixT<Rows, Cols, T>::UncheckedAt(const size_t row, const size_t col) const noexcept { return components[col * Rows + row]; }
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr T& MatrixT<Rows, Cols, T>::UncheckedAt(const size_t row, const size_t col) noexcept { return components[col * Rows + row]; }
+
+template <size_t Rows, size_t Cols, typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr MatrixT<Rows, Cols, T>::operator MatrixT<Rows, Cols, U>() const noexcept
+{
+    std::array<U, Rows * Cols> result;
+    for (size_t i = 0; i < Rows * Cols; i++)
+        result[i] = static_cast<U>(components[i]);
+    return MakeMatrix<MatrixT<Rows, Cols, U>>(result);
+}
+
+// The operators below also accept Matrix2, Matrix3 and Matrix, whose own operators take precedence when both operands have the same shape.
+// This way, a Matrix can be multiplied by a Matrix4x3 for example.
+
+/// @brief Returns the opposite of a MatrixT.
+///
+/// This effectively means replacing all values of this MatrixT with their opposite.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator-(const MatrixT<Rows, Cols, T>& matrix) noexcept
+{
+    std::array<T, Rows * Cols> result = GetMatrixComponents(matrix);
+    for (T& value : result)
+        value = -value;
+    return MakeMatrix<MatrixT<Rows, Cols, T>>(result);
+}
+
+/// @brief Adds the values of two @ref MatrixT "Matrices" one by one.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator+(const MatrixT<Rows, Cols, T>& m1, const MatrixT<Rows, Cols, T>& m2) noexcept
+{
+    std::array<T, Rows * Cols> result = GetMatrixComponents(m1);
+    const std::array<T, Rows * Cols> other = GetMatrixComponents(m2);
+    for (size_t i = 0; i < Rows * Cols; i++)
+        result[i] += other[i];
+    return MakeMatrix<MatrixT<Rows, Cols, T>>(result);
+}
+
+/// @brief Subtracts the values of two @ref MatrixT "Matrices" one by one.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator-(const MatrixT<Rows, Cols, T>& m1, const MatrixT<Rows, Cols, T>& m2) noexcept
+{
+    std::array<T, Rows * Cols> result = GetMatrixComponents(m1);
+    const std::array<T, Rows * Cols> other = GetMatrixComponents(m2);
+    for (size_t i = 0; i < Rows * Cols; i++)
+        result[i] -= other[i];
+    return MakeMatrix<MatrixT<Rows, Cols, T>>(result);
+}
+
+/// @brief Multiplies all values of a MatrixT by a @p scalar.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator*(const MatrixT<Rows, Cols, T>& m, const std::type_identity_t<T> scalar) noexcept
+{
+    std::array<T, Rows * Cols> result = GetMatrixComponents(m);
+    for (T& value : result)
+        value *= scalar;
+    return MakeMatrix<MatrixT<Rows, Cols, T>>(result);
+}
+
+/// @brief Multiplies all values of a MatrixT by a @p scalar.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator*(const std::type_identity_t<T> scalar, const MatrixT<Rows, Cols, T>& m) noexcept { return m * scalar; }
+
+/// @brief Multiplies a @p Rows by @p Inner MatrixT by an @p Inner by @p Cols MatrixT, giving a @p Rows by @p Cols MatrixT.
+///
+/// Products of two @ref Matrix "Matrices" or of two @ref Matrix3 "Matrix3s" instead use their own operator.
+template <size_t Rows, size_t Inner, size_t Cols, typename T>
+    requires (!MatrixOperand<MatrixT<Rows, Inner, T>> || !MatrixOperand<MatrixT<Inner, Cols, T>>)
+[[nodiscard]]
+constexpr MatrixT<Rows, Cols, T> operator*(const MatrixT<Rows, Inner, T>& m1, const MatrixT<Inner, Cols, T>& m2) noexcept
+{
+    const std::array<T, Rows * Inner> lhs = GetMatrixComponents(m1);
+    const std::array<T, Inner * Cols> rhs = GetMatrixComponents(m2);
+
+    std::array<T, Rows * Cols> result;
+    for (size_t col = 0; col < Cols; col++)
+    {
+        for (size_t row = 0; row < Rows; row++)
+        {
+            T value = 0;
+            for (size_t i = 0; i < Inner; i++)
+                value += lhs[i * Rows + row] * rhs[col * Inner + i];
+            result[col * Rows + row] = value;
+        }
+    }
+    return MakeMatrix<MatrixT<Rows, Cols, T>>(result);
+}
+
+/// @brief Multiplies a @p Rows by @p Cols MatrixT by a VectorT of @p Cols components, giving a VectorT of @p Rows components.
+///
+/// For example, a Matrix3x4 transforms a Vector4 into a Vector3.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr VectorT<Rows, T> operator*(const MatrixT<Rows, Cols, T>& m, const VectorT<Cols, T>& v) noexcept
+{
+    const std::array<T, Rows * Cols> matrix = GetMatrixComponents(m);
+    const std::array<T, Cols> vector = GetVectorComponents(v);
+
+    std::array<T, Rows> result{};
+    for (size_t col = 0; col < Cols; col++)
+    {
+        for (size_t row = 0; row < Rows; row++)
+            result[row] += matrix[col * Rows + row] * vector[col];
+    }
+    return MakeVector<VectorT<Rows, T>>(result);
+}
+
+/// @brief Adds two @ref MatrixT "Matrices" according to @ref operator+(const MatrixT<Rows, Cols, T>&, const MatrixT<Rows, Cols, T>&), placing the result in @p m1.
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>& operator+=(MatrixT<Rows, Cols, T>& m1, const MatrixT<Rows, Cols, T>& m2) noexcept { return m1 = m1 + m2; }
+
+/// @brief Subtracts two @ref MatrixT "Matrices" according to @ref operator-(const MatrixT<Rows, Cols, T>&, const MatrixT<Rows, Cols, T>&), placing the result in @p m1.
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>& operator-=(MatrixT<Rows, Cols, T>& m1, const MatrixT<Rows, Cols, T>& m2) noexcept { return m1 = m1 - m2; }
+
+/// @brief Multiplies a MatrixT by a @p scalar, placing the result in @p m.
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>& operator*=(MatrixT<Rows, Cols, T>& m, const std::type_identity_t<T> scalar) noexcept { return m = m * scalar; }
+
+/// @brief Multiplies a MatrixT by a square MatrixT, placing the result in @p m1.
+template <size_t Rows, size_t Cols, typename T>
+constexpr MatrixT<Rows, Cols, T>& operator*=(MatrixT<Rows, Cols, T>& m1, const MatrixT<Cols, Cols, T>& m2) noexcept
+{
+    return m1 = m1 * m2;
+}
+
+/// @brief Checks if two Matrices are equal.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr bool_t operator==(const MatrixT<Rows, Cols, T>& a, const MatrixT<Rows, Cols, T>& b) noexcept
+{
+    return GetMatrixComponents(a) == GetMatrixComponents(b);
+}
+
+/// @brief Checks if two Matrices are different.
+template <size_t Rows, size_t Cols, typename T>
+[[nodiscard]]
+constexpr bool_t operator!=(const MatrixT<Rows, Cols, T>& a, const MatrixT<Rows, Cols, T>& b) noexcept { return !(a == b); }
+
+template <size_t Rows, size_t Cols, typename T>
+constexpr bool_t Calc::Equals(const MatrixT<Rows, Cols, T>& a, const MatrixT<Rows, Cols, T>& b) noexcept
+{
+    const std::array<T, Rows * Cols> lhs = GetMatrixComponents(a);
+    const std::array<T, Rows * Cols> rhs = GetMatrixComponents(b);
+    for (size_t i = 0; i < Rows * Cols; i++)
+    {
+        if (Abs(lhs[i] - rhs[i]) > static_cast<T>(Zero))
+            return false;
+    }
+
+    return true;
+}
+
+/// @brief Streams a MatrixT into @p out, printing its values row by row on a single line.
+template <size_t Rows, size_t Cols, typename T>
+std::ostream& operator<<(std::ostream& out, const MatrixT<Rows, Cols, T>& m)
+{
+    for (size_t row = 0; row < Rows; row++)
+    {
+        out << (row == 0 ? "[ " : " [ ");
+        for (size_t col = 0; col < Cols; col++)
+            out << m.Data()[col * Rows + row] << (col == Cols - 1 ? " ]" : " ; ");
+    }
+
+    return out;
+}
+
+template <size_t Rows, size_t Cols, typename T>
+struct std::formatter<MatrixT<Rows, Cols, T>>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx)
+    {
+        auto it = ctx.begin();
+        if (it == ctx.end())
+            return it;
+
+        if (*it == 'm')
+        {
+            m_Multiline = true;
+            it++;
+        }
+
+        while (*it != '}' && it != ctx.end())
+            m_Format += *it++;
+
+        return it;
+    }
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(const MatrixT<Rows, Cols, T>& m, FmtContext& ctx) const
+    {
+        std::ostringstream out;
+
+        const std::string valueFormat = "{:" + m_Format + '}';
+        const char_t separator = m_Multiline ? '\n' : ' ';
+
+        for (size_t row = 0; row < Rows; row++)
+        {
+            if (row != 0)
+                out << separator;
+
+            out << "[ ";
+            for (size_t col = 0; col < Cols; col++)
+            {
+                out << std::vformat(valueFormat, std::make_format_args(m.Data()[col * Rows + row]));
+                out << (col == Cols - 1 ? " ]" : " ; ");
+            }
+        }
+
+        return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+    }
+
+private:
+    std::string m_Format;
+    bool_t m_Multiline = false;
+};
@@ -1,60 +1,42 @@
 #include "Math/quaternion.hpp"
 
 #include <format>
+#include <stdexcept>
 
 #include "Math/calc.hpp"
+#include "Math/dispatch.hpp"
 #include "Math/matrix.hpp"
 
-Quaternion Quaternion::FromAxisAngle(const Vector3& axis, const float_t angle) noexcept
+MATH_INLINE void Quaternion::FromEuler(const std::span<const Vector3> rotations, const std::span<Quaternion> results)
 {
-	Quaternion result;
-	FromAxisAngle(axis, angle, &result);
-	return result;
-}
+	if (results.size() < rotations.size())
+		MATH_THROW(std::invalid_argument("The output range must be at least as large as the rotation range"));
 
-void Quaternion::FromAxisAngle(const Vector3& axis, const float_t angle, Quaternion* result) noexcept
-{
-	const Vector3 normalizedAxis = axis.Normalized();
-	const float_t halfAngle = angle * 0.5f;
-	const float_t s = std::sin(halfAngle);
-	const float_t c = std::cos(halfAngle);
-
-	result->X() = normalizedAxis.x * s;
-	result->Y() = normalizedAxis.y * s;
-	result->Z() = normalizedAxis.z * s;
-	result->W() = c;
-}
+	// The sines and cosines are computed by chunks to stay on the stack
+	constexpr size_t ChunkSize = 64;
+	Vector3 halfSines[ChunkSize], halfCosines[ChunkSize];
 
-Quaternion Quaternion::FromEuler(const Vector3& rotation) noexcept
-{
-	Quaternion result;
-	FromEuler(rotation, &result);
-	return result;
-}
+	for (size_t i = 0; i < rotations.size(); i += ChunkSize)
+	{
+		const size_t count = std::min(ChunkSize, rotations.size() - i);
+		for (size_t j = 0; j < count; j++)
+			halfSines[j] = rotations[i + j] * 0.5f;
 
-void Quaternion::FromEuler(const Vector3& rotation, Quaternion* result) noexcept
-{
-	const float_t cr = std::cos(rotation.x * 0.5f);
-	const float_t sr = std::sin(rotation.x * 0.5f);
-	const float_t cp = std::cos(rotation.y * 0.5f);
-	const float_t sp = std::sin(rotation.y * 0.5f);
-	const float_t cy = std::cos(rotation.z * 0.5f);
-	const float_t sy = std::sin(rotation.z * 0.5f);
-
-	result->X() = sr * cp * cy - cr * sp * sy;
-	result->Y() = cr * sp * cy + sr * cp * sy;
-	result->Z() = cr * cp * sy - sr * sp * cy;
-	result->W() = cr * cp * cy + sr * sp * sy;
+		Calc::SinCos(std::span(halfSines, count), halfSines, halfCosines);
+
+		for (size_t j = 0; j < count; j++)
+			FromEuler(halfCosines[j], halfSines[j], &results[i + j]);
+	}
 }
 
-Quaternion Quaternion::FromRotationMatrix(const Matrix& rotation) noexcept
+MATH_INLINE Quaternion Quaternion::FromRotationMatrix(const Matrix& rotation) noexcept
 {
 	Quaternion result;
 	FromRotationMatrix(rotation, &result);
 	return result;
 }
 
-void Quaternion::FromRotationMatrix(const Matrix& rotation, Quaternion* result) noexcept
+MATH_INLINE void Quaternion::FromRotationMatrix(const Matrix& rotation, Quaternion* result) noexcept
 {
 	const float_t trace = rotation.Trace() - rotation.m33;
 
@@ -107,14 +89,14 @@ void Quaternion::FromRotationMatrix(const Matrix& rotation, Quaternion* result)
 	}
 }
 
-Vector3 Quaternion::ToEuler(const Quaternion& rotation) noexcept
+MATH_INLINE Vector3 Quaternion::ToEuler(const Quaternion& rotation) noexcept
 {
 	Vector3 result;
 	ToEuler(rotation, &result);
 	return result;
 }
 
-void Quaternion::ToEuler(const Quaternion& rotation, Vector3* result) noexcept
+MATH_INLINE void Quaternion::ToEuler(const Quaternion& rotation, Vector3* result) noexcept
 {
 	// Code from https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles#Source_code_2
 
@@ -134,14 +116,14 @@ void Quaternion::ToEuler(const Quaternion& rotation, Vector3* result) noexcept
 	result->z = std::atan2(sinyCosp, cosyCosp);
 }
 
-Quaternion Quaternion::Lerp(const Quaternion& value, const Quaternion& target, const float_t t) noexcept
+MATH_INLINE Quaternion Quaternion::Lerp(const Quaternion& value, const Quaternion& target, const float_t t) noexcept
 {
 	Quaternion result;
 	Lerp(value, target, t, &result);
 	return result;
 }
 
-void Quaternion::Lerp(const Quaternion& value, const Quaternion& target, const float_t t, Quaternion* result) noexcept
+MATH_INLINE void Quaternion::Lerp(const Quaternion& value, const Quaternion& target, const float_t t, Quaternion* result) noexcept
 {
 	const float_t t1 = 1.f - t;
 
@@ -172,14 +154,14 @@ void Quaternion::Lerp(const Quaternion& value, const Quaternion& target, const f
 	result->W() *= invNorm;
 }
 
-Quaternion Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t) noexcept
+MATH_INLINE Quaternion Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t) noexcept
 {
 	Quaternion result;
 	Slerp(value, target, t, &result);
 	return result;
 }
 
-void Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t, Quaternion* result) noexcept
+MATH_INLINE void Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t, Quaternion* result) noexcept
 {
 	float_t cosOmega = value.X() * target.X() + value.Y() * target.Y() +
 					 value.Z() * target.Z() + value.W() * target.W();
@@ -217,7 +199,43 @@ void Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const
 	result->W() = s1 * value.W() + s2 * target.W();
 }
 
-Quaternion Quaternion::LookAt(const Vector3& sourcePosition, const Vector3& targetPosition, const Vector3& forward, const Vector3& up) noexcept
+MATH_INLINE Quaternion Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t, const Calc::FastMathTag tag) noexcept
+{
+	Quaternion result;
+	Slerp(value, target, t, &result, tag);
+	return result;
+}
+
+MATH_INLINE void Quaternion::Slerp(const Quaternion& value, const Quaternion& target, const float_t t, Quaternion* result, Calc::FastMathTag) noexcept
+{
+	float_t cosOmega = Dot(value, target);
+
+	// Takes the shortest path
+	const float_t sign = cosOmega < 0.f ? -1.f : 1.f;
+	cosOmega *= sign;
+
+	float_t s1, s2;
+
+	if (cosOmega > 1.f - Calc::Zero)
+	{
+		// Too close, do straight linear interpolation.
+		s1 = 1.f - t;
+		s2 = t;
+	}
+	else
+	{
+		const float_t omega = Calc::FastAcos(cosOmega);
+		// sin(omega) is known from cos(omega), which saves a sine
+		const float_t invSinOmega = Calc::FastRsqrt(1.f - SQ(cosOmega));
+
+		s1 = Calc::FastSin((1.f - t) * omega) * invSinOmega;
+		s2 = Calc::FastSin(t * omega) * invSinOmega;
+	}
+
+	*result = value * s1 + target * (s2 * sign);
+}
+
+MATH_INLINE Quaternion Quaternion::LookAt(const Vector3& sourcePosition, const Vector3& targetPosition, const Vector3& forward, const Vector3& up) noexcept
 {
 	const Vector3 targetForward = (targetPosition - sourcePosition).Normalized();
 
@@ -233,36 +251,86 @@ Quaternion Quaternion::LookAt(const Vector3& sourcePosition, const Vector3& targ
 	return FromAxisAngle(axis.Normalized(), angle);
 }
 
-Quaternion Quaternion::Normalized() const noexcept
+MATH_INLINE Quaternion Quaternion::Normalized() const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	const __m128 q = Simd::Load(*this);
+	return Simd::Store<Quaternion>(_mm_div_ps(q, _mm_sqrt_ps(Simd::Dot4(q, q))));
+#else
 	const float_t length = Length();
 	return Quaternion(imaginary / length, real / length);
+#endif
 }
 
-void Quaternion::Normalized(Quaternion* result) const noexcept
+MATH_INLINE void Quaternion::Normalized(Quaternion* result) const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	*result = Normalized();
+#else
 	const float_t length = Length();
 	*result = Quaternion(imaginary / length, real / length);
+#endif
+}
+
+MATH_INLINE Quaternion Quaternion::Normalized(Calc::FastMathTag) const noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+	const __m128 q = Simd::Load(*this);
+	return Simd::Store<Quaternion>(_mm_mul_ps(q, Simd::Rsqrt(Simd::Dot4(q, q))));
+#else
+	return *this * Calc::FastRsqrt(SquaredLength());
+#endif
+}
+
+MATH_INLINE void Quaternion::Normalized(Quaternion* result, const Calc::FastMathTag tag) const noexcept
+{
+	*result = Normalized(tag);
+}
+
+MATH_INLINE void Quaternion::Normalize(const std::span<const Quaternion> quaternions, const std::span<Quaternion> results)
+{
+	static_assert(sizeof(Quaternion) == 4 * sizeof(float_t), "Quaternion must be tightly packed to be used as an array of float_t");
+
+	if (results.size() < quaternions.size())
+		MATH_THROW(std::invalid_argument("The output range must be at least as large as the quaternion range"));
+
+	if (quaternions.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors4(quaternions.front().Data(), results.front().Data(), quaternions.size());
+}
+
+MATH_INLINE void Quaternion::NormalizeInPlace(const std::span<Quaternion> quaternions) noexcept
+{
+	if (quaternions.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors4(quaternions.front().Data(), quaternions.front().Data(), quaternions.size());
 }
 
-float_t Quaternion::Length() const noexcept
+MATH_INLINE float_t Quaternion::Length() const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	const __m128 q = Simd::Load(*this);
+	return _mm_cvtss_f32(_mm_sqrt_ss(Simd::Dot4(q, q)));
+#else
 	return std::sqrt(SquaredLength());
+#endif
 }
 
-bool_t Quaternion::IsInfinity() const noexcept
+MATH_INLINE bool_t Quaternion::IsInfinity() const noexcept
 {
 	return imaginary.IsInfinity()
 		&& std::isinf(real);
 }
 
-bool_t Quaternion::IsNaN() const noexcept
+MATH_INLINE bool_t Quaternion::IsNaN() const noexcept
 {
 	return imaginary.IsNaN()
 		&& std::isnan(real);
 }
 
-std::ostream& operator<<(std::ostream& out, const Quaternion& q)
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Quaternion& q)
 {
 	return out << std::format("{{{:.3f} {:.3f} {:.3f} {:.3f}}}", q.imaginary.x, q.imaginary.y, q.imaginary.z, q.real);
 }
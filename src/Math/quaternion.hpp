@@ -4,8 +4,11 @@
 #include <sstream>
 
 #include <ostream>
+#include <type_traits>
 
 #include "Math/calc.hpp"
+#include "Math/quaterniont.hpp"
+#include "Math/simd.hpp"
 #include "Math/vector3.hpp"
 #include "Math/vector4.hpp"
 
@@ -13,7 +16,11 @@
 /// @brief Defines the Quaternion struct.
 
 /// @brief The Quaternion struct represents a 4-dimensional vector mainly used for mathematical calculations revolving around rotations.
-struct MATH_TOOLBOX Quaternion
+///
+/// This is the float specialization of QuaternionT, which provides the other value types.
+/// When @c MATH_SIMD_ALIGN is defined, this struct is 16-byte aligned and most of its operations run on SIMD registers.
+template <>
+struct MATH_TOOLBOX MATH_SIMD_ALIGNAS QuaternionT<float_t>
 {
     /// @brief The imaginary part of this Quaternion. Represents the @c x, @c y, and @c z components.
     Vector3 imaginary;
@@ -100,7 +107,7 @@ struct MATH_TOOLBOX Quaternion
     /// @param angle The rotation angle.
     /// @returns A rotation Quaternion equivalent to the given axis-angle rotation.
     [[nodiscard]]
-    static Quaternion FromAxisAngle(const Vector3& axis, float_t angle) noexcept;
+    static constexpr Quaternion FromAxisAngle(const Vector3& axis, float_t angle) noexcept;
 
     /// @brief Create a rotation Quaternion from an axis-angle rotation.
     ///
@@ -108,21 +115,48 @@ struct MATH_TOOLBOX Quaternion
     /// @param angle The rotation angle.
     /// @param result The output value.
     /// @see FromAxisAngle(const Vector3&, float_t)
-    static void FromAxisAngle(const Vector3& axis, float_t angle, Quaternion* result) noexcept;
+    static constexpr void FromAxisAngle(const Vector3& axis, float_t angle, Quaternion* result) noexcept;
 
     /// @brief Create a rotation Quaternion from an axis-angle rotation.
     ///
     /// @param rotation The euler rotation vector.
     /// @returns A rotation Quaternion equivalent to the given axis-angle rotation.
     [[nodiscard]]
-    static Quaternion FromEuler(const Vector3& rotation) noexcept;
+    static constexpr Quaternion FromEuler(const Vector3& rotation) noexcept;
 
     /// @brief Create a rotation Quaternion from an axis-angle rotation.
     ///
     /// @param rotation The euler rotation vector.
     /// @param result The output value.
     /// @see FromEuler(const Vector3&)
-    static void FromEuler(const Vector3& rotation, Quaternion* result) noexcept;
+    static constexpr void FromEuler(const Vector3& rotation, Quaternion* result) noexcept;
+
+    /// @brief Create a rotation Quaternion from the cosines and sines of half the euler angles.
+    ///
+    /// @param halfCos The cosines of half the euler angles.
+    /// @param halfSin The sines of half the euler angles.
+    /// @returns A rotation Quaternion equivalent to the given euler rotation.
+    /// @see FromEuler(const Vector3&)
+    [[nodiscard]]
+    static constexpr Quaternion FromEuler(const Vector3& halfCos, const Vector3& halfSin) noexcept;
+
+    /// @brief Create a rotation Quaternion from the cosines and sines of half the euler angles.
+    ///
+    /// @param halfCos The cosines of half the euler angles.
+    /// @param halfSin The sines of half the euler angles.
+    /// @param result The output value.
+    /// @see FromEuler(const Vector3&)
+    static constexpr void FromEuler(const Vector3& halfCos, const Vector3& halfSin, Quaternion* result) noexcept;
+
+    /// @brief Create a rotation Quaternion for each of the given euler rotations.
+    ///
+    /// The sines and cosines of all the angles are computed using @ref Calc::SinCos(std::span<const Vector3>, std::span<Vector3>, std::span<Vector3>).
+    ///
+    /// @param rotations The euler rotation vectors.
+    /// @param results The output values.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p rotations.
+    static void FromEuler(std::span<const Vector3> rotations, std::span<Quaternion> results);
 
     /// @brief Create a rotation Quaternion from an axis-angle rotation.
     ///
@@ -197,6 +231,25 @@ struct MATH_TOOLBOX Quaternion
     /// @see Slerp(const Quaternion&, const Quaternion&, float_t)
     static void Slerp(const Quaternion& value, const Quaternion& target, float_t t, Quaternion* result) noexcept;
 
+    /// @brief Compute the spherical linear interpolation between two Quaternions, using @ref Calc::FastAcos and @ref Calc::FastSin.
+    ///
+    /// @param value The current position.
+    /// @param target The target position.
+    /// @param t The time to slerp.
+    /// @returns The slerp position.
+    [[nodiscard]]
+    static Quaternion Slerp(const Quaternion& value, const Quaternion& target, float_t t, Calc::FastMathTag) noexcept;
+
+    /// @brief Compute the spherical linear interpolation between two Quaternions, using @ref Calc::FastAcos and @ref Calc::FastSin.
+    ///
+    /// @param value The current position.
+    /// @param target The target position.
+    /// @param t The time to slerp.
+    /// @param result The output value.
+    ///
+    /// @see Slerp(const Quaternion&, const Quaternion&, float_t, Calc::FastMathTag)
+    static void Slerp(const Quaternion& value, const Quaternion& target, float_t t, Quaternion* result, Calc::FastMathTag) noexcept;
+
     /// @brief Rotate a point using a rotation quaternion.
     ///
     ///	Calling this function is equivalent to doing:
@@ -234,26 +287,26 @@ struct MATH_TOOLBOX Quaternion
     ) noexcept;
 
     /// @brief Construct a Quaternion with everything set to @c 0.
-    constexpr Quaternion() = default;
+    constexpr QuaternionT() = default;
 
     /// @brief Construct a Quaternion from a Vector4.
-    constexpr explicit Quaternion(const Vector4& values) noexcept;
+    constexpr explicit QuaternionT(const Vector4& values) noexcept;
 
     /// @brief Construct a Quaternion from an imaginary and a real part.
-    constexpr explicit Quaternion(const Vector3& imaginary, float_t real = 1.f) noexcept;
+    constexpr explicit QuaternionT(const Vector3& imaginary, float_t real = 1.f) noexcept;
 
     /// @brief Construct a Quaternion with all its values set to @p xyzw.
-    constexpr explicit Quaternion(float_t xyzw) noexcept;
+    constexpr explicit QuaternionT(float_t xyzw) noexcept;
 
     /// @brief  Constructs a Vector2 with its components set to the data pointed by <code>data</code>.
     ///
     /// This constructor assumes that <code>data</code> is a valid pointer pointing to at least 2 float_t values.
     ///
     /// @param data The data where the values for this vector's components are located.
-    constexpr explicit Quaternion(const float_t* data) noexcept;
+    constexpr explicit QuaternionT(const float_t* data) noexcept;
 
     /// @brief Construct a Quaternion from 4 @c float_t values.
-    constexpr Quaternion(float_t x, float_t y, float_t z, float_t w) noexcept;
+    constexpr QuaternionT(float_t x, float_t y, float_t z, float_t w) noexcept;
 
     /// @brief Gets a pointer to the first component of this vector.
     ///
@@ -317,6 +370,29 @@ struct MATH_TOOLBOX Quaternion
     /// @brief Returns a normalized version of this Quaternion.
     void Normalized(Quaternion* result) const noexcept;
 
+    /// @brief Returns a normalized version of this Quaternion, using @ref Calc::FastRsqrt.
+    [[nodiscard]]
+    Quaternion Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Returns a normalized version of this Quaternion, using @ref Calc::FastRsqrt.
+    void Normalized(Quaternion* result, Calc::FastMathTag) const noexcept;
+
+    /// @brief Normalizes each of the given quaternions, quaternions with a length of zero staying zero.
+    ///
+    /// The quaternions are normalized several at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+    /// They are multiplied by an approximate inverse square root refined with a Newton-Raphson step,
+    /// so the results can differ from Normalized() in the last bits.
+    /// Unlike Normalized(), which divides by their length, quaternions with a length of zero give zero instead of NaN.
+    ///
+    /// @param quaternions The quaternions to normalize.
+    /// @param results The output of the function. May be @p quaternions.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p quaternions.
+    static void Normalize(std::span<const Quaternion> quaternions, std::span<Quaternion> results);
+
+    /// @brief Normalizes each of the given quaternions in place, like @ref Normalize(std::span<const Quaternion>, std::span<Quaternion>).
+    static void NormalizeInPlace(std::span<Quaternion> quaternions) noexcept;
+
     /// @brief Returns the length of this Quaternion.
     [[nodiscard]]
     float_t Length() const noexcept;
@@ -354,6 +430,16 @@ struct MATH_TOOLBOX Quaternion
     [[nodiscard]]
     constexpr float_t& operator[](size_t i);
 
+    /// @brief Retrieves this quaternion's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this quaternion's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t i) noexcept;
+
     /// @brief Converts this Quaternion to a Vector3 by returning its imaginary part.
     constexpr explicit operator Vector3() const noexcept;
 
@@ -367,15 +453,15 @@ static_assert(std::is_move_constructible_v<Quaternion>, "Class Quaternion must b
 static_assert(std::is_copy_assignable_v<Quaternion>, "Class Quaternion must be copy assignable.");
 static_assert(std::is_move_assignable_v<Quaternion>, "Class Quaternion must be move assignable.");
 
-constexpr Quaternion::Quaternion(const Vector4& values) noexcept : imaginary(values.x, values.y, values.z), real(values.w) {}
+constexpr Quaternion::QuaternionT(const Vector4& values) noexcept : imaginary(values.x, values.y, values.z), real(values.w) {}
 
-constexpr Quaternion::Quaternion(const Vector3& imaginary, const float_t real) noexcept : imaginary(imaginary), real(real) {}
+constexpr Quaternion::QuaternionT(const Vector3& imaginary, const float_t real) noexcept : imaginary(imaginary), real(real) {}
 
-constexpr Quaternion::Quaternion(const float_t xyzw) noexcept : imaginary(xyzw), real(xyzw) {}
+constexpr Quaternion::QuaternionT(const float_t xyzw) noexcept : imaginary(xyzw), real(xyzw) {}
 
-constexpr Quaternion::Quaternion(const float_t* const data) noexcept : imaginary(data), real(data[3]) {}
+constexpr Quaternion::QuaternionT(const float_t* const data) noexcept : imaginary(data), real(data[3]) {}
 
-constexpr Quaternion::Quaternion(const float_t x, const float_t y, const float_t z, const float_t w) noexcept : imaginary(x, y, z), real(w) {}
+constexpr Quaternion::QuaternionT(const float_t x, const float_t y, const float_t z, const float_t w) noexcept : imaginary(x, y, z), real(w) {}
 
 constexpr Quaternion Quaternion::Zero() noexcept { return Quaternion(); }
 
@@ -399,9 +485,72 @@ constexpr void Quaternion::UnitW(Quaternion* result) noexcept { *result = Quater
 
 constexpr Quaternion Quaternion::Identity() noexcept { return UnitW(); }
 
+constexpr Quaternion Quaternion::FromAxisAngle(const Vector3& axis, const float_t angle) noexcept
+{
+    Quaternion result;
+    FromAxisAngle(axis, angle, &result);
+    return result;
+}
+
+constexpr void Quaternion::FromAxisAngle(const Vector3& axis, const float_t angle, Quaternion* result) noexcept
+{
+    const Vector3 normalizedAxis = axis.Normalized();
+    float_t s, c;
+    Calc::SinCos(angle * 0.5f, &s, &c);
+
+    result->X() = normalizedAxis.x * s;
+    result->Y() = normalizedAxis.y * s;
+    result->Z() = normalizedAxis.z * s;
+    result->W() = c;
+}
+
+constexpr Quaternion Quaternion::FromEuler(const Vector3& rotation) noexcept
+{
+    Quaternion result;
+    FromEuler(rotation, &result);
+    return result;
+}
+
+constexpr void Quaternion::FromEuler(const Vector3& rotation, Quaternion* result) noexcept
+{
+    Vector3 halfSin, halfCos;
+    Calc::SinCos(rotation * 0.5f, &halfSin, &halfCos);
+    FromEuler(halfCos, halfSin, result);
+}
+
+constexpr Quaternion Quaternion::FromEuler(const Vector3& halfCos, const Vector3& halfSin) noexcept
+{
+    Quaternion result;
+    FromEuler(halfCos, halfSin, &result);
+    return result;
+}
+
+constexpr void Quaternion::FromEuler(const Vector3& halfCos, const Vector3& halfSin, Quaternion* result) noexcept
+{
+    const float_t cosYCosZ = halfCos.y * halfCos.z;
+    const float_t sinYSinZ = halfSin.y * halfSin.z;
+    const float_t sinYCosZ = halfSin.y * halfCos.z;
+    const float_t cosYSinZ = halfCos.y * halfSin.z;
+
+    *result = Quaternion(
+        halfSin.x * cosYCosZ - halfCos.x * sinYSinZ,
+        halfCos.x * sinYCosZ + halfSin.x * cosYSinZ,
+        halfCos.x * cosYSinZ - halfSin.x * sinYCosZ,
+        halfCos.x * cosYCosZ + halfSin.x * sinYSinZ
+    );
+}
+
 constexpr void Quaternion::Identity(Quaternion* result) noexcept { *result = UnitW(); }
 
-constexpr float_t Quaternion::Dot(const Quaternion& a, const Quaternion& b) noexcept { return a.X() * b.X() + a.Y() * b.Y() + a.Z() * b.Z() + a.W() * b.W(); }
+constexpr float_t Quaternion::Dot(const Quaternion& a, const Quaternion& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return _mm_cvtss_f32(Simd::Dot4(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return a.X() * b.X() + a.Y() * b.Y() + a.Z() * b.Z() + a.W() * b.W();
+}
 
 constexpr const float_t* Quaternion::Data() const noexcept { return &imaginary.x; }
 
@@ -427,14 +576,22 @@ constexpr Quaternion Quaternion::Conjugate() const noexcept { return Quaternion(
 
 constexpr void Quaternion::Conjugate(Quaternion* result) const noexcept { *result = Quaternion(-imaginary, real); }
 
-constexpr float_t Quaternion::SquaredLength() const noexcept { return SQ(imaginary.x) + SQ(imaginary.y) + SQ(imaginary.z) + SQ(real); }
+constexpr float_t Quaternion::SquaredLength() const noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return _mm_cvtss_f32(Simd::Dot4(Simd::Load(*this), Simd::Load(*this)));
+#endif
+
+    return SQ(imaginary.x) + SQ(imaginary.y) + SQ(imaginary.z) + SQ(real);
+}
 
 constexpr float_t Quaternion::operator[](const size_t i) const
 {
     if (i < 4) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Quaternion subscript out of range");
+        MATH_THROW(std::out_of_range("Quaternion subscript out of range"));
 }
 
 constexpr float_t& Quaternion::operator[](const size_t i)
@@ -442,31 +599,64 @@ constexpr float_t& Quaternion::operator[](const size_t i)
     if (i < 4) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Quaternion subscript out of range");
+        MATH_THROW(std::out_of_range("Quaternion subscript out of range"));
 }
 
+constexpr float_t Quaternion::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr float_t& Quaternion::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
 constexpr Quaternion::operator Vector3() const noexcept { return imaginary; }
 
 constexpr Quaternion::operator Vector4() const noexcept { return Vector4(imaginary.x, imaginary.y, imaginary.z, real); }
 
 /// @brief Adds two @ref Quaternion "Quaternions" together.
 [[nodiscard]]
-constexpr Quaternion operator+(const Quaternion& a, const Quaternion& b) noexcept { return Quaternion(a.imaginary + b.imaginary, a.real + b.real); }
+constexpr Quaternion operator+(const Quaternion& a, const Quaternion& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(_mm_add_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Quaternion(a.imaginary + b.imaginary, a.real + b.real);
+}
 
 /// @brief Returns the opposite of a Quaternion.
 ///
 /// This effectively means replacing all values of this Quaternion with their opposite.
 [[nodiscard]]
-constexpr Quaternion operator-(const Quaternion& a) noexcept { return Quaternion(-a.imaginary, -a.real); }
+constexpr Quaternion operator-(const Quaternion& a) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(Simd::Negate(Simd::Load(a)));
+#endif
+
+    return Quaternion(-a.imaginary, -a.real);
+}
 
 /// @brief Subtracts a Quaternion from another one.
 [[nodiscard]]
-constexpr Quaternion operator-(const Quaternion& a, const Quaternion& b) noexcept { return Quaternion(a + -b); }
+constexpr Quaternion operator-(const Quaternion& a, const Quaternion& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(_mm_sub_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Quaternion(a + -b);
+}
 
 /// @brief Multiplies two @ref Quaternion "Quaternions" together.
 [[nodiscard]]
 constexpr Quaternion operator*(const Quaternion& a, const Quaternion& b) noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(Simd::MultiplyQuaternion(Simd::Load(a), Simd::Load(b)));
+#endif
+
     Quaternion result;
 
     // cross(av, bv)
@@ -490,7 +680,15 @@ constexpr Quaternion operator*(const Quaternion& q, const Vector3& v) noexcept {
 
 /// @brief Multiplies a Quaternion by a @p factor.
 [[nodiscard]]
-constexpr Quaternion operator*(const Quaternion& q, const float_t factor) noexcept { return Quaternion(q.imaginary * factor, q.real * factor); }
+constexpr Quaternion operator*(const Quaternion& q, const float_t factor) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(_mm_mul_ps(Simd::Load(q), _mm_set1_ps(factor)));
+#endif
+
+    return Quaternion(q.imaginary * factor, q.real * factor);
+}
 
 /// @brief Multiplies a Quaternion by a @p factor.
 [[nodiscard]]
@@ -498,7 +696,15 @@ constexpr Quaternion operator*(const float_t factor, const Quaternion q) noexcep
 
 /// @brief Divides a Quaternion by a @p factor.
 [[nodiscard]]
-constexpr Quaternion operator/(const Quaternion& v, const float_t factor) noexcept { return Quaternion(v.imaginary / factor, v.real / factor); }
+constexpr Quaternion operator/(const Quaternion& v, const float_t factor) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Quaternion>(_mm_div_ps(Simd::Load(v), _mm_set1_ps(factor)));
+#endif
+
+    return Quaternion(v.imaginary / factor, v.real / factor);
+}
 
 /// @brief Adds two @ref Quaternion "Quaternions" according to @ref operator+(const Quaternion&, const Quaternion&), placing the result in @p a.
 constexpr Quaternion& operator+=(Quaternion& a, const Quaternion& b) noexcept { return a = a + b; }
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <format>
+#include <sstream>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/core.hpp"
+#include "Math/vectort.hpp"
+
+/// @file quaterniont.hpp
+/// @brief Defines the QuaternionT template, of which Quaternion is a specialization.
+
+template <typename T>
+struct QuaternionT;
+
+// Quaternion is an explicit specialization of QuaternionT, defined in its own header
+template <>
+struct QuaternionT<float_t>;
+
+using Quaternion = QuaternionT<float_t>;
+
+/// @brief A double Quaternion, e.g. the orientation of a Matrixd world transformation.
+using Quaterniond = QuaternionT<double_t>;
+
+/// @brief The QuaternionT struct represents a rotation using @p T values.
+///
+/// The float quaternion is the Quaternion specialization, which provides most of the rotation functions and the SIMD code paths.
+/// Every other value type, like Quaterniond, uses this generic implementation.
+template <typename T>
+struct QuaternionT
+{
+    static_assert(std::is_floating_point_v<T>, "The values of a QuaternionT must be floating-point values");
+
+    /// @brief The imaginary part of this QuaternionT. Represents the @c x, @c y, and @c z components.
+    VectorT<3, T> imaginary;
+
+    /// @brief The real part of this QuaternionT. Represents the @c w component.
+    T real = 0;
+
+    /// @brief Returns the identity QuaternionT, e.g. @c { x = 0, y = 0, z = 0, w = 1 }.
+    [[nodiscard]]
+    static constexpr QuaternionT Identity() noexcept;
+
+    /// @brief Returns a · b.
+    [[nodiscard]]
+    static constexpr T Dot(const QuaternionT& a, const QuaternionT& b) noexcept;
+
+    /// @brief Creates a rotation QuaternionT of @p angle radians around @p axis.
+    ///
+    /// @param axis The normalized axis around which the rotation occurs.
+    /// @param angle The angle in radians.
+    [[nodiscard]]
+    static QuaternionT FromAxisAngle(const VectorT<3, T>& axis, T angle) noexcept;
+
+    /// @brief Rotates @p point by the given @p rotation.
+    [[nodiscard]]
+    static constexpr VectorT<3, T> Rotate(const VectorT<3, T>& point, const QuaternionT& rotation) noexcept;
+
+    /// @brief Constructs a QuaternionT with all its components set to 0.
+    constexpr QuaternionT() = default;
+
+    /// @brief Constructs a QuaternionT from its imaginary and real parts.
+    constexpr explicit QuaternionT(const VectorT<3, T>& imaginary, T real = 1) noexcept;
+
+    /// @brief Constructs a QuaternionT with set component values.
+    constexpr QuaternionT(T x, T y, T z, T w) noexcept;
+
+    /// @brief Converts a QuaternionT to this value type, e.g. a Quaternion to a Quaterniond.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    constexpr explicit QuaternionT(const QuaternionT<U>& other) noexcept;
+
+    /// @brief Returns the conjugate of this QuaternionT, e.g. the opposite rotation when it is normalized.
+    [[nodiscard]]
+    constexpr QuaternionT Conjugate() const noexcept;
+
+    /// @brief Returns the inverse of this QuaternionT, or a null QuaternionT if this one is null.
+    [[nodiscard]]
+    constexpr QuaternionT Inverted() const noexcept;
+
+    /// @brief Returns the length of this QuaternionT.
+    [[nodiscard]]
+    T Length() const noexcept;
+
+    /// @brief Returns the squared length of this QuaternionT.
+    [[nodiscard]]
+    constexpr T SquaredLength() const noexcept;
+
+    /// @brief Returns a QuaternionT with the same rotation but a length of one, or a null QuaternionT if this one is null.
+    [[nodiscard]]
+    QuaternionT Normalized() const noexcept;
+
+    /// @brief Converts this QuaternionT to another value type, e.g. a Quaterniond to a Quaternion.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    [[nodiscard]]
+    constexpr explicit operator QuaternionT<U>() const noexcept;
+};
+
+template <typename T>
+constexpr QuaternionT<T> QuaternionT<T>::Identity() noexcept { return QuaternionT(0, 0, 0, 1); }
+
+template <typename T>
+constexpr T QuaternionT<T>::Dot(const QuaternionT& a, const QuaternionT& b) noexcept
+{
+    return VectorT<3, T>::Dot(a.imaginary, b.imaginary) + a.real * b.real;
+}
+
+template <typename T>
+QuaternionT<T> QuaternionT<T>::FromAxisAngle(const VectorT<3, T>& axis, const T angle) noexcept
+{
+    const T halfAngle = angle / 2;
+    return QuaternionT(axis * std::sin(halfAngle), std::cos(halfAngle));
+}
+
+template <typename T>
+constexpr VectorT<3, T> QuaternionT<T>::Rotate(const VectorT<3, T>& point, const QuaternionT& rotation) noexcept
+{
+    return (rotation * QuaternionT(point, 1) * rotation.Conjugate()).imaginary;
+}
+
+template <typename T>
+constexpr QuaternionT<T>::QuaternionT(const VectorT<3, T>& imaginary, const T real) noexcept : imaginary(imaginary), real(real) {}
+
+template <typename T>
+constexpr QuaternionT<T>::QuaternionT(const T x, const T y, const T z, const T w) noexcept : imaginary(x, y, z), real(w) {}
+
+template <typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr QuaternionT<T>::QuaternionT(const QuaternionT<U>& other) noexcept
+    : imaginary(static_cast<T>(other.imaginary.x), static_cast<T>(other.imaginary.y), static_cast<T>(other.imaginary.z))
+    , real(static_cast<T>(other.real))
+{
+}
+
+template <typename T>
+constexpr QuaternionT<T> QuaternionT<T>::Conjugate() const noexcept { return QuaternionT(-imaginary, real); }
+
+template <typename T>
+constexpr QuaternionT<T> QuaternionT<T>::Inverted() const noexcept
+{
+    const T sqLength = SquaredLength();
+    if (sqLength == 0)
+        return QuaternionT();
+
+    return Conjugate() / sqLength;
+}
+
+template <typename T>
+T QuaternionT<T>::Length() const noexcept { return std::sqrt(SquaredLength()); }
+
+template <typename T>
+constexpr T QuaternionT<T>::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+template <typename T>
+QuaternionT<T> QuaternionT<T>::Normalized() const noexcept
+{
+    const T length = Length();
+    if (length == 0)
+        return QuaternionT();
+
+    return *this / length;
+}
+
+template <typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr QuaternionT<T>::operator QuaternionT<U>() const noexcept
+{
+    return QuaternionT<U>(static_cast<U>(imaginary.x), static_cast<U>(imaginary.y), static_cast<U>(imaginary.z), static_cast<U>(real));
+}
+
+// The operators below also accept Quaternion, whose own operators take precedence.
+
+/// @brief Adds two quaternions component by component.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator+(const QuaternionT<T>& a, const QuaternionT<T>& b) noexcept
+{
+    return QuaternionT<T>(a.imaginary + b.imaginary, a.real + b.real);
+}
+
+/// @brief Subtracts two quaternions component by component.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator-(const QuaternionT<T>& a, const QuaternionT<T>& b) noexcept
+{
+    return QuaternionT<T>(a.imaginary - b.imaginary, a.real - b.real);
+}
+
+/// @brief Returns the opposite of a QuaternionT.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator-(const QuaternionT<T>& q) noexcept { return QuaternionT<T>(-q.imaginary, -q.real); }
+
+/// @brief Multiplies two quaternions, e.g. combines the rotation @p b followed by the rotation @p a.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator*(const QuaternionT<T>& a, const QuaternionT<T>& b) noexcept
+{
+    return QuaternionT<T>(
+        VectorT<3, T>::Cross(a.imaginary, b.imaginary) + b.imaginary * a.real + a.imaginary * b.real,
+        a.real * b.real - VectorT<3, T>::Dot(a.imaginary, b.imaginary)
+    );
+}
+
+/// @brief Multiplies a QuaternionT by a @p factor.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator*(const QuaternionT<T>& q, const std::type_identity_t<T> factor) noexcept
+{
+    return QuaternionT<T>(q.imaginary * factor, q.real * factor);
+}
+
+/// @brief Multiplies a QuaternionT by a @p factor.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator*(const std::type_identity_t<T> factor, const QuaternionT<T>& q) noexcept { return q * factor; }
+
+/// @brief Divides a QuaternionT by a @p factor.
+template <typename T>
+[[nodiscard]]
+constexpr QuaternionT<T> operator/(const QuaternionT<T>& q, const std::type_identity_t<T> factor) noexcept
+{
+    return QuaternionT<T>(q.imaginary / factor, q.real / factor);
+}
+
+/// @brief Multiplies two quaternions according to @ref operator*(const QuaternionT<T>&, const QuaternionT<T>&), placing the result in @p a.
+template <typename T>
+constexpr QuaternionT<T>& operator*=(QuaternionT<T>& a, const QuaternionT<T>& b) noexcept { return a = a * b; }
+
+/// @brief Checks if two quaternions are equal.
+template <typename T>
+[[nodiscard]]
+constexpr bool_t operator==(const QuaternionT<T>& a, const QuaternionT<T>& b) noexcept
+{
+    return a.imaginary == b.imaginary && a.real == b.real;
+}
+
+/// @brief Checks if two quaternions are different.
+template <typename T>
+[[nodiscard]]
+constexpr bool_t operator!=(const QuaternionT<T>& a, const QuaternionT<T>& b) noexcept { return !(a == b); }
+
+/// @brief Streams a QuaternionT into @p out, printing its components one by one.
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const QuaternionT<T>& q)
+{
+    return out << q.imaginary << " ; " << q.real;
+}
+
+template <typename T>
+struct std::formatter<QuaternionT<T>>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx)
+    {
+        auto it = ctx.begin();
+        if (it == ctx.end())
+            return it;
+
+        while (*it != '}' && it != ctx.end())
+            m_Format += *it++;
+
+        return it;
+    }
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(const QuaternionT<T>& q, FmtContext& ctx) const
+    {
+        std::ostringstream out;
+
+        const std::string componentFormat = "{:" + m_Format + '}';
+        const T components[] = { q.imaginary.x, q.imaginary.y, q.imaginary.z, q.real };
+        for (size_t i = 0; i < 4; i++)
+            out << (i == 0 ? "" : " ; ") << std::vformat(componentFormat, std::make_format_args(components[i]));
+
+        return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+    }
+
+private:
+    std::string m_Format;
+};
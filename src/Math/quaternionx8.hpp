@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+#include "Math/calc.hpp"
+#include "Math/floatx8.hpp"
+#include "Math/quaternion.hpp"
+#include "Math/simd.hpp"
+#include "Math/vector3x8.hpp"
+
+/// @file quaternionx8.hpp
+/// @brief Defines the Quaternionx8 struct.
+
+/// @brief The Quaternionx8 struct represents 8 @ref Quaternion "Quaternions" processed together, one per lane.
+///
+/// Like Quaternion, it is made of an imaginary part, here a Vector3x8, and a real part, here a Floatx8.
+/// Use Load and Store to convert from and to arrays of @ref Quaternion "Quaternions".
+struct Quaternionx8
+{
+    /// @brief The imaginary parts of the 8 quaternions.
+    Vector3x8 imaginary;
+
+    /// @brief The real parts of the 8 quaternions.
+    Floatx8 real;
+
+    /// @brief Loads the 8 @ref Quaternion "Quaternions" pointed by @p quaternions.
+    [[nodiscard]]
+    static Quaternionx8 Load(const Quaternion* quaternions) noexcept;
+
+    /// @brief Loads up to 8 @ref Quaternion "Quaternions" from @p quaternions, the lanes past its end being set to zero.
+    [[nodiscard]]
+    static Quaternionx8 Load(std::span<const Quaternion> quaternions) noexcept;
+
+    /// @brief Returns a · b, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Dot(const Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+    /// @brief Linearly interpolates between @p value and @p target, lane by lane, like @ref Quaternion::Lerp.
+    ///
+    /// Each lane takes the shortest path and is normalized.
+    [[nodiscard]]
+    static Quaternionx8 Lerp(const Quaternionx8& value, const Quaternionx8& target, const Floatx8& t) noexcept;
+
+    /// @brief Rotates the points @p point using the rotation quaternions @p rotation, lane by lane.
+    ///
+    /// The quaternions of @p rotation are expected to be normalized, in which case this is equivalent to @ref Quaternion::Rotate.
+    [[nodiscard]]
+    static Vector3x8 Rotate(const Vector3x8& point, const Quaternionx8& rotation) noexcept;
+
+    /// @brief Returns, for each lane, the quaternion of @p ifTrue if the lane of @p mask is set, or the quaternion of @p ifFalse otherwise.
+    [[nodiscard]]
+    static Quaternionx8 Select(const Maskx8& mask, const Quaternionx8& ifTrue, const Quaternionx8& ifFalse) noexcept;
+
+    /// @brief Constructs a Quaternionx8 with all its components set to 0.
+    Quaternionx8() = default;
+
+    /// @brief Constructs a Quaternionx8 with all its lanes set to @p q.
+    Quaternionx8(const Quaternion& q) noexcept;
+
+    /// @brief Constructs a Quaternionx8 from the imaginary and real parts of its 8 quaternions.
+    Quaternionx8(const Vector3x8& imaginary, const Floatx8& real) noexcept;
+
+    /// @brief Stores the 8 quaternions of this Quaternionx8 to @p quaternions.
+    void Store(Quaternion* quaternions) const noexcept;
+
+    /// @brief Stores up to 8 quaternions of this Quaternionx8 to @p quaternions, e.g. as many as @p quaternions can hold.
+    void Store(std::span<Quaternion> quaternions) const noexcept;
+
+    /// @brief Returns the conjugates of the 8 quaternions.
+    [[nodiscard]]
+    Quaternionx8 Conjugate() const noexcept;
+
+    /// @brief Returns the lengths of the 8 quaternions.
+    [[nodiscard]]
+    Floatx8 Length() const noexcept;
+
+    /// @brief Returns the squared lengths of the 8 quaternions.
+    [[nodiscard]]
+    Floatx8 SquaredLength() const noexcept;
+
+    /// @brief Returns the 8 quaternions normalized, quaternions with a length of zero staying zero.
+    [[nodiscard]]
+    Quaternionx8 Normalized() const noexcept;
+
+    /// @brief Returns the 8 quaternions normalized using @ref Floatx8::Rsqrt, quaternions with a length of zero staying zero.
+    [[nodiscard]]
+    Quaternionx8 Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Retrieves the quaternion of the lane at index @p lane.
+    [[nodiscard]]
+    Quaternion operator[](size_t lane) const;
+};
+
+/// @brief Returns the opposite of a Quaternionx8.
+[[nodiscard]]
+inline Quaternionx8 operator-(const Quaternionx8& q) noexcept;
+
+/// @brief Adds two @ref Quaternionx8 "Quaternionx8s" lane by lane.
+[[nodiscard]]
+inline Quaternionx8 operator+(const Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Subtracts two @ref Quaternionx8 "Quaternionx8s" lane by lane.
+[[nodiscard]]
+inline Quaternionx8 operator-(const Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Multiplies two @ref Quaternionx8 "Quaternionx8s" together, lane by lane.
+[[nodiscard]]
+inline Quaternionx8 operator*(const Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Multiplies each quaternion of a Quaternionx8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Quaternionx8 operator*(const Quaternionx8& q, const Floatx8& factor) noexcept;
+
+/// @brief Multiplies each quaternion of a Quaternionx8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Quaternionx8 operator*(const Floatx8& factor, const Quaternionx8& q) noexcept;
+
+/// @brief Divides each quaternion of a Quaternionx8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Quaternionx8 operator/(const Quaternionx8& q, const Floatx8& factor) noexcept;
+
+/// @brief Adds two @ref Quaternionx8 "Quaternionx8s" according to @ref operator+(const Quaternionx8&, const Quaternionx8&), placing the result in @p a.
+inline Quaternionx8& operator+=(Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Subtracts two @ref Quaternionx8 "Quaternionx8s" according to @ref operator-(const Quaternionx8&, const Quaternionx8&), placing the result in @p a.
+inline Quaternionx8& operator-=(Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Multiplies two @ref Quaternionx8 "Quaternionx8s" according to @ref operator*(const Quaternionx8&, const Quaternionx8&), placing the result in @p a.
+inline Quaternionx8& operator*=(Quaternionx8& a, const Quaternionx8& b) noexcept;
+
+/// @brief Multiplies a Quaternionx8 by a @p factor according to @ref operator*(const Quaternionx8&, const Floatx8&), placing the result in @p q.
+inline Quaternionx8& operator*=(Quaternionx8& q, const Floatx8& factor) noexcept;
+
+/// @brief Divides a Quaternionx8 by a @p factor according to @ref operator/(const Quaternionx8&, const Floatx8&), placing the result in @p q.
+inline Quaternionx8& operator/=(Quaternionx8& q, const Floatx8& factor) noexcept;
+
+inline Quaternionx8 Quaternionx8::Load(const Quaternion* const quaternions) noexcept
+{
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float_t), "Quaternionx8::Load expects Quaternion to be 4 packed float_t values");
+
+#ifdef MATH_SIMD_AVX
+    // Each register holds the quaternions i and i + 4 in its two 128-bit lanes, which are then transposed as 4x4 matrices
+    const __m256 q04 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(quaternions[0].Data())), _mm_loadu_ps(quaternions[4].Data()), 1);
+    const __m256 q15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(quaternions[1].Data())), _mm_loadu_ps(quaternions[5].Data()), 1);
+    const __m256 q26 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(quaternions[2].Data())), _mm_loadu_ps(quaternions[6].Data()), 1);
+    const __m256 q37 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(quaternions[3].Data())), _mm_loadu_ps(quaternions[7].Data()), 1);
+
+    const __m256 xy01 = _mm256_unpacklo_ps(q04, q15);
+    const __m256 zw01 = _mm256_unpackhi_ps(q04, q15);
+    const __m256 xy23 = _mm256_unpacklo_ps(q26, q37);
+    const __m256 zw23 = _mm256_unpackhi_ps(q26, q37);
+
+    return Quaternionx8(
+        Vector3x8(
+            Floatx8(_mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0))),
+            Floatx8(_mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2))),
+            Floatx8(_mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0)))
+        ),
+        Floatx8(_mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2)))
+    );
+#elif defined(MATH_SIMD_SSE)
+    Quaternionx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        __m128 q0 = _mm_loadu_ps(quaternions[i].Data());
+        __m128 q1 = _mm_loadu_ps(quaternions[i + 1].Data());
+        __m128 q2 = _mm_loadu_ps(quaternions[i + 2].Data());
+        __m128 q3 = _mm_loadu_ps(quaternions[i + 3].Data());
+        _MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+
+        _mm_storeu_ps(result.imaginary.x.value + i, q0);
+        _mm_storeu_ps(result.imaginary.y.value + i, q1);
+        _mm_storeu_ps(result.imaginary.z.value + i, q2);
+        _mm_storeu_ps(result.real.value + i, q3);
+    }
+    return result;
+#else
+    Quaternionx8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+    {
+        result.imaginary.x.value[i] = quaternions[i].X();
+        result.imaginary.y.value[i] = quaternions[i].Y();
+        result.imaginary.z.value[i] = quaternions[i].Z();
+        result.real.value[i] = quaternions[i].W();
+    }
+    return result;
+#endif
+}
+
+inline Quaternionx8 Quaternionx8::Load(const std::span<const Quaternion> quaternions) noexcept
+{
+    if (quaternions.size() >= Floatx8::Size)
+        return Load(quaternions.data());
+
+    Quaternion padded[Floatx8::Size];
+    std::ranges::copy(quaternions, padded);
+    return Load(padded);
+}
+
+inline Floatx8 Quaternionx8::Dot(const Quaternionx8& a, const Quaternionx8& b) noexcept
+{
+    return Floatx8::MultiplyAdd(a.real, b.real, Vector3x8::Dot(a.imaginary, b.imaginary));
+}
+
+inline Quaternionx8 Quaternionx8::Lerp(const Quaternionx8& value, const Quaternionx8& target, const Floatx8& t) noexcept
+{
+    // Negating the target when the quaternions are in opposite hemispheres takes the shortest path
+    const Floatx8 targetFactor = Floatx8::Select(Dot(value, target) >= 0.f, t, -t);
+    return (value * (1.f - t) + target * targetFactor).Normalized();
+}
+
+inline Vector3x8 Quaternionx8::Rotate(const Vector3x8& point, const Quaternionx8& rotation) noexcept
+{
+    // v' = v + w * t + q x t, with t = 2 * (q x v)
+    const Vector3x8 t = Vector3x8::Cross(rotation.imaginary, point) * 2.f;
+    return point + t * rotation.real + Vector3x8::Cross(rotation.imaginary, t);
+}
+
+inline Quaternionx8 Quaternionx8::Select(const Maskx8& mask, const Quaternionx8& ifTrue, const Quaternionx8& ifFalse) noexcept
+{
+    return Quaternionx8(Vector3x8::Select(mask, ifTrue.imaginary, ifFalse.imaginary), Floatx8::Select(mask, ifTrue.real, ifFalse.real));
+}
+
+inline Quaternionx8::Quaternionx8(const Quaternion& q) noexcept : imaginary(q.imaginary), real(q.real) {}
+
+inline Quaternionx8::Quaternionx8(const Vector3x8& imaginary, const Floatx8& real) noexcept : imaginary(imaginary), real(real) {}
+
+inline void Quaternionx8::Store(Quaternion* const quaternions) const noexcept
+{
+#ifdef MATH_SIMD_AVX
+    // The 4x4 transpose of Load is its own inverse
+    const __m256 xy01 = _mm256_unpacklo_ps(imaginary.x.value, imaginary.y.value);
+    const __m256 xy23 = _mm256_unpackhi_ps(imaginary.x.value, imaginary.y.value);
+    const __m256 zw01 = _mm256_unpacklo_ps(imaginary.z.value, real.value);
+    const __m256 zw23 = _mm256_unpackhi_ps(imaginary.z.value, real.value);
+
+    const __m256 q04 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 q15 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 q26 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 q37 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm_storeu_ps(quaternions[0].Data(), _mm256_castps256_ps128(q04));
+    _mm_storeu_ps(quaternions[1].Data(), _mm256_castps256_ps128(q15));
+    _mm_storeu_ps(quaternions[2].Data(), _mm256_castps256_ps128(q26));
+    _mm_storeu_ps(quaternions[3].Data(), _mm256_castps256_ps128(q37));
+    _mm_storeu_ps(quaternions[4].Data(), _mm256_extractf128_ps(q04, 1));
+    _mm_storeu_ps(quaternions[5].Data(), _mm256_extractf128_ps(q15, 1));
+    _mm_storeu_ps(quaternions[6].Data(), _mm256_extractf128_ps(q26, 1));
+    _mm_storeu_ps(quaternions[7].Data(), _mm256_extractf128_ps(q37, 1));
+#elif defined(MATH_SIMD_SSE)
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(imaginary.x.value + i);
+        __m128 y = _mm_loadu_ps(imaginary.y.value + i);
+        __m128 z = _mm_loadu_ps(imaginary.z.value + i);
+        __m128 w = _mm_loadu_ps(real.value + i);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        _mm_storeu_ps(quaternions[i].Data(), x);
+        _mm_storeu_ps(quaternions[i + 1].Data(), y);
+        _mm_storeu_ps(quaternions[i + 2].Data(), z);
+        _mm_storeu_ps(quaternions[i + 3].Data(), w);
+    }
+#else
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        quaternions[i] = Quaternion(imaginary.x.value[i], imaginary.y.value[i], imaginary.z.value[i], real.value[i]);
+#endif
+}
+
+inline void Quaternionx8::Store(const std::span<Quaternion> quaternions) const noexcept
+{
+    if (quaternions.size() >= Floatx8::Size)
+    {
+        Store(quaternions.data());
+        return;
+    }
+
+    Quaternion padded[Floatx8::Size];
+    Store(padded);
+    std::copy_n(padded, quaternions.size(), quaternions.begin());
+}
+
+inline Quaternionx8 Quaternionx8::Conjugate() const noexcept { return Quaternionx8(-imaginary, real); }
+
+inline Floatx8 Quaternionx8::Length() const noexcept { return Floatx8::Sqrt(SquaredLength()); }
+
+inline Floatx8 Quaternionx8::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+inline Quaternionx8 Quaternionx8::Normalized() const noexcept
+{
+    const Floatx8 length = Length();
+    return Select(length > Calc::Zero, *this / length, Quaternionx8());
+}
+
+inline Quaternionx8 Quaternionx8::Normalized(Calc::FastMathTag) const noexcept
+{
+    const Floatx8 squaredLength = SquaredLength();
+    return Select(squaredLength > SQ(Calc::Zero), *this * Floatx8::Rsqrt(squaredLength), Quaternionx8());
+}
+
+inline Quaternion Quaternionx8::operator[](const size_t lane) const
+{
+    if (lane >= Floatx8::Size) [[unlikely]]
+        MATH_THROW(std::out_of_range("Quaternionx8 subscript out of range"));
+
+    return Quaternion(imaginary[lane], real[lane]);
+}
+
+inline Quaternionx8 operator-(const Quaternionx8& q) noexcept { return Quaternionx8(-q.imaginary, -q.real); }
+
+inline Quaternionx8 operator+(const Quaternionx8& a, const Quaternionx8& b) noexcept { return Quaternionx8(a.imaginary + b.imaginary, a.real + b.real); }
+
+inline Quaternionx8 operator-(const Quaternionx8& a, const Quaternionx8& b) noexcept { return Quaternionx8(a.imaginary - b.imaginary, a.real - b.real); }
+
+inline Quaternionx8 operator*(const Quaternionx8& a, const Quaternionx8& b) noexcept
+{
+    return Quaternionx8(
+        a.imaginary * b.real + b.imaginary * a.real + Vector3x8::Cross(a.imaginary, b.imaginary),
+        a.real * b.real - Vector3x8::Dot(a.imaginary, b.imaginary)
+    );
+}
+
+inline Quaternionx8 operator*(const Quaternionx8& q, const Floatx8& factor) noexcept { return Quaternionx8(q.imaginary * factor, q.real * factor); }
+
+inline Quaternionx8 operator*(const Floatx8& factor, const Quaternionx8& q) noexcept { return q * factor; }
+
+inline Quaternionx8 operator/(const Quaternionx8& q, const Floatx8& factor) noexcept { return q * (1.f / factor); }
+
+inline Quaternionx8& operator+=(Quaternionx8& a, const Quaternionx8& b) noexcept { return a = a + b; }
+
+inline Quaternionx8& operator-=(Quaternionx8& a, const Quaternionx8& b) noexcept { return a = a - b; }
+
+inline Quaternionx8& operator*=(Quaternionx8& a, const Quaternionx8& b) noexcept { return a = a * b; }
+
+inline Quaternionx8& operator*=(Quaternionx8& q, const Floatx8& factor) noexcept { return q = q * factor; }
+
+inline Quaternionx8& operator/=(Quaternionx8& q, const Floatx8& factor) noexcept { return q = q / factor; }
@@ -0,0 +1,978 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Math/core.hpp"
+
+#ifdef MATH_SIMD_SSE
+#include <immintrin.h>
+#endif
+
+/// @file simd.hpp
+/// @brief Defines the SIMD kernels used by the library's types at run-time.
+///
+/// These kernels work on raw column-major @c float_t arrays so that they can be shared between types.
+/// They are only used outside of constant evaluation, the constexpr scalar implementations being used otherwise.
+
+#ifdef MATH_SIMD_SSE
+
+/// @namespace Simd
+/// @brief This namespace contains the SIMD kernels used by the library when @c MATH_SIMD_SSE is defined.
+namespace Simd
+{
+    /// @brief Computes @p a * @p b + @p c, using a fused multiply-add instruction when available.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 MultiplyAdd(__m128 a, __m128 b, __m128 c) noexcept;
+
+    /// @brief Computes @c c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w, e.g. the product of the matrix of columns @p c0 to @p c3 by @p v.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 LinearCombination(__m128 v, __m128 c0, __m128 c1, __m128 c2, __m128 c3) noexcept;
+
+#ifdef MATH_SIMD_AVX
+    /// @brief Computes @p a * @p b + @p c, using a fused multiply-add instruction when available.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256 MultiplyAdd(__m256 a, __m256 b, __m256 c) noexcept;
+
+    /// @brief Computes the same as @ref LinearCombination(__m128, __m128, __m128, __m128, __m128) on both 128-bit lanes of @p v at once.
+    ///
+    /// Each of @p c0 to @p c3 is expected to hold the same column in both of its lanes.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256 LinearCombination(__m256 v, __m256 c0, __m256 c1, __m256 c2, __m256 c3) noexcept;
+
+    /// @brief Computes the same as @ref Rsqrt(__m128) on 8 values at once.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256 Rsqrt(__m256 v) noexcept;
+#endif
+
+    /// @brief Multiplies the column-major 4x4 matrix pointed by @p matrix by the 4 values pointed by @p vector.
+    ///
+    /// @p result may point to the same memory as @p vector.
+    inline void TransformVector4(const float_t* matrix, const float_t* vector, float_t* result) noexcept;
+
+    /// @brief Multiplies two column-major 4x4 matrices, e.g. computes @p lhs * @p rhs.
+    ///
+    /// @p result may point to the same memory as @p lhs or @p rhs.
+    inline void MultiplyMatrix4(const float_t* lhs, const float_t* rhs, float_t* result) noexcept;
+
+    /// @brief Computes the cross product of the first 3 components of @p a and @p b, the last component of the result being 0.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Cross3(__m128 a, __m128 b) noexcept;
+
+    /// @brief Computes the sum of the 4 components of @p v, broadcasted to all the components of the result.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 HorizontalSum(__m128 v) noexcept;
+
+    /// @brief Inverts the column-major 4x4 matrix pointed by @p matrix.
+    ///
+    /// @p result may point to the same memory as @p matrix.
+    ///
+    /// @returns @c false if the matrix isn't invertible, in which case @p result is left untouched.
+    [[nodiscard]]
+    inline bool_t InvertMatrix4(const float_t* matrix, float_t* result) noexcept;
+
+    /// @brief Inverts the column-major 4x4 affine matrix pointed by @p matrix, e.g. a matrix whose last row is (0, 0, 0, 1).
+    ///
+    /// @p result may point to the same memory as @p matrix.
+    ///
+    /// @returns @c false if the matrix isn't invertible, in which case @p result is left untouched.
+    [[nodiscard]]
+    inline bool_t InvertAffineMatrix4(const float_t* matrix, float_t* result) noexcept;
+
+    /// @brief Inverts the column-major 4x4 rigid matrix pointed by @p matrix, e.g. a matrix made of a rotation and a translation only.
+    ///
+    /// The inverse is the transposed rotation with the opposite of the rotated translation. @p result may point to the same memory as @p matrix.
+    inline void InvertRigidMatrix4(const float_t* matrix, float_t* result) noexcept;
+
+    /// @private
+    /// @brief Loads the 4 columns of a packed column-major 3x4 matrix, the last component of each column being unspecified.
+    MATH_FORCE_INLINE void LoadAffine3x4(const float_t* matrix, __m128* c0, __m128* c1, __m128* c2, __m128* c3) noexcept;
+
+    /// @private
+    /// @brief Stores the 4 columns of a packed column-major 3x4 matrix, the last component of each column being ignored.
+    MATH_FORCE_INLINE void StoreAffine3x4(__m128 c0, __m128 c1, __m128 c2, __m128 c3, float_t* result) noexcept;
+
+    /// @brief Multiplies two column-major 3x4 affine matrices, e.g. computes @p lhs * @p rhs as if both had a last row of (0, 0, 0, 1).
+    ///
+    /// Only the 12 values of each matrix are read and written. @p result may point to the same memory as @p lhs or @p rhs.
+    inline void MultiplyAffine3x4(const float_t* lhs, const float_t* rhs, float_t* result) noexcept;
+
+    /// @brief Inverts the column-major 3x4 affine matrix pointed by @p matrix.
+    ///
+    /// Only the 12 values of each matrix are read and written. @p result may point to the same memory as @p matrix.
+    ///
+    /// @returns @c false if the matrix isn't invertible, in which case @p result is left untouched.
+    [[nodiscard]]
+    inline bool_t InvertAffine3x4(const float_t* matrix, float_t* result) noexcept;
+
+    /// @brief Computes @c c0 * v.x + c1 * v.y + c2 * v.z, e.g. the product of the 3x3 matrix of columns @p c0 to @p c2 by @p v.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 LinearCombination3(__m128 v, __m128 c0, __m128 c1, __m128 c2) noexcept;
+
+    /// @brief Transposes the 3x3 matrix of columns @p c0, @p c1 and @p c2 in place, the last component of each column being unspecified.
+    MATH_FORCE_INLINE void Transpose3(__m128* c0, __m128* c1, __m128* c2) noexcept;
+
+    /// @brief Multiplies two column-major 3x3 matrices whose columns are padded to 4 values, e.g. computes @p lhs * @p rhs.
+    ///
+    /// All pointers must be 16-byte aligned. @p result may point to the same memory as @p lhs or @p rhs.
+    inline void MultiplyMatrix3A(const float_t* lhs, const float_t* rhs, float_t* result) noexcept;
+
+    /// @brief Transposes the column-major 3x3 matrix pointed by @p matrix, whose columns are padded to 4 values.
+    ///
+    /// All pointers must be 16-byte aligned. @p result may point to the same memory as @p matrix.
+    inline void TransposeMatrix3A(const float_t* matrix, float_t* result) noexcept;
+
+    /// @brief Inverts the column-major 3x3 matrix pointed by @p matrix, whose columns are padded to 4 values.
+    ///
+    /// All pointers must be 16-byte aligned. @p result may point to the same memory as @p matrix.
+    ///
+    /// @returns @c false if the matrix isn't invertible, in which case @p result is left untouched.
+    [[nodiscard]]
+    inline bool_t InvertMatrix3A(const float_t* matrix, float_t* result) noexcept;
+
+    /// @brief Computes the dot product of @p a and @p b, broadcasted to all the components of the result.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Dot4(__m128 a, __m128 b) noexcept;
+
+    /// @brief Negates all the components of @p v.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Negate(__m128 v) noexcept;
+
+    /// @brief Computes the Hamilton product of the quaternions @p a and @p b, stored as (x, y, z, w).
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 MultiplyQuaternion(__m128 a, __m128 b) noexcept;
+
+    /// @brief Computes the dot product of the first 3 components of @p a and @p b, broadcasted to all the components of the result.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Dot3(__m128 a, __m128 b) noexcept;
+
+    /// @brief Computes an approximation of @c 1 / std::sqrt(v), refined with a Newton-Raphson step. The maximum relative error is 3e-7.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Rsqrt(__m128 v) noexcept;
+
+    /// @brief Computes both the sines and the cosines of the 4 angles of @p angles, sharing a single range reduction.
+    ///
+    /// The maximum absolute error is 2e-7 for angles between -8192 and 8192 radians. Larger angles, infinities and NaNs give unspecified results.
+    MATH_FORCE_INLINE void SinCos(__m128 angles, __m128* sin, __m128* cos) noexcept;
+
+    /// @brief Returns whether all the 4 angles of @p angles are within the range supported by @ref SinCos(__m128, __m128*, __m128*).
+    [[nodiscard]]
+    MATH_FORCE_INLINE bool_t IsSinCosInRange(__m128 angles) noexcept;
+
+    /// @brief Rounds the 4 components of @p v toward zero, like @c std::trunc.
+    ///
+    /// Uses the SSE4.1 @c roundps instruction when @c MATH_SIMD_AVX is defined, and emulates it using SSE2 conversions otherwise.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Truncate(__m128 v) noexcept;
+
+    /// @brief Rounds the 4 components of @p v down, like @c std::floor.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Floor(__m128 v) noexcept;
+
+    /// @brief Rounds the 4 components of @p v up, like @c std::ceil.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Ceil(__m128 v) noexcept;
+
+    /// @brief Rounds the 4 components of @p v to the nearest integer, halfway cases away from zero, like @c std::round.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128 Round(__m128 v) noexcept;
+
+    /// @brief Loads the 4 @c float_t values pointed by @c value.Data(), which must be 16-byte aligned.
+    template <typename T>
+    [[nodiscard]]
+    __m128 Load(const T& value) noexcept;
+
+    /// @brief Creates a @p T from the 4 @c float_t values of @p v, storing them to the 16-byte aligned @c T::Data().
+    template <typename T>
+    [[nodiscard]]
+    T Store(__m128 v) noexcept;
+
+    /// @brief Whether @p N values of type @p T fit in the register returned by @c LoadLanes.
+    ///
+    /// This is the case for up to 4 @c int32_t values, and up to 2 @c double_t values, or 4 when @c MATH_SIMD_AVX is defined.
+    template <typename T, size_t N>
+    constexpr bool_t HasLanes = (std::is_same_v<T, int32_t> && N <= 4) || (std::is_same_v<T, double_t> && N <= 2)
+#ifdef MATH_SIMD_AVX
+        || (std::is_same_v<T, double_t> && N <= 4)
+#endif
+        ;
+
+    /// @brief Loads the @p N @c int32_t values pointed by @p data, the remaining lanes being set to 0.
+    template <size_t N>
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i LoadLanes(const int32_t* data) noexcept;
+
+    /// @brief Loads the @p N @c double_t values pointed by @p data, the remaining lanes being set to 0.
+    ///
+    /// Returns a @c __m128d for up to 2 values, and a @c __m256d otherwise.
+    template <size_t N>
+    [[nodiscard]]
+    MATH_FORCE_INLINE auto LoadLanes(const double_t* data) noexcept;
+
+    /// @brief Stores the first @p N lanes of @p v to @p data.
+    template <size_t N>
+    MATH_FORCE_INLINE void StoreLanes(__m128i v, int32_t* data) noexcept;
+
+    /// @brief Stores the first @p N lanes of @p v to @p data.
+    template <size_t N>
+    MATH_FORCE_INLINE void StoreLanes(__m128d v, double_t* data) noexcept;
+
+    /// @brief Adds the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i Add(__m128i a, __m128i b) noexcept;
+
+    /// @brief Subtracts the lanes of @p b from the lanes of @p a one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i Subtract(__m128i a, __m128i b) noexcept;
+
+    /// @brief Multiplies the lanes of @p a and @p b one by one, keeping the low 32 bits of each product.
+    ///
+    /// Uses the SSE4.1 @c pmulld instruction when @c MATH_SIMD_AVX is defined, and emulates it using SSE2 otherwise.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i Multiply(__m128i a, __m128i b) noexcept;
+
+    /// @brief Returns the minimum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i Min(__m128i a, __m128i b) noexcept;
+
+    /// @brief Returns the maximum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128i Max(__m128i a, __m128i b) noexcept;
+
+    /// @brief Adds the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Add(__m128d a, __m128d b) noexcept;
+
+    /// @brief Subtracts the lanes of @p b from the lanes of @p a one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Subtract(__m128d a, __m128d b) noexcept;
+
+    /// @brief Multiplies the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Multiply(__m128d a, __m128d b) noexcept;
+
+    /// @brief Divides the lanes of @p a by the lanes of @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Divide(__m128d a, __m128d b) noexcept;
+
+    /// @brief Returns the minimum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Min(__m128d a, __m128d b) noexcept;
+
+    /// @brief Returns the maximum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m128d Max(__m128d a, __m128d b) noexcept;
+
+#ifdef MATH_SIMD_AVX
+    /// @brief Stores the first @p N lanes of @p v to @p data.
+    template <size_t N>
+    MATH_FORCE_INLINE void StoreLanes(__m256d v, double_t* data) noexcept;
+
+    /// @brief Adds the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Add(__m256d a, __m256d b) noexcept;
+
+    /// @brief Subtracts the lanes of @p b from the lanes of @p a one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Subtract(__m256d a, __m256d b) noexcept;
+
+    /// @brief Multiplies the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Multiply(__m256d a, __m256d b) noexcept;
+
+    /// @brief Divides the lanes of @p a by the lanes of @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Divide(__m256d a, __m256d b) noexcept;
+
+    /// @brief Returns the minimum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Min(__m256d a, __m256d b) noexcept;
+
+    /// @brief Returns the maximum of the lanes of @p a and @p b one by one.
+    [[nodiscard]]
+    MATH_FORCE_INLINE __m256d Max(__m256d a, __m256d b) noexcept;
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::MultiplyAdd(const __m128 a, const __m128 b, const __m128 c) noexcept
+{
+#ifdef MATH_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::LinearCombination(const __m128 v, const __m128 c0, const __m128 c1, const __m128 c2, const __m128 c3) noexcept
+{
+    __m128 result = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = MultiplyAdd(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = MultiplyAdd(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    return MultiplyAdd(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+}
+
+#ifdef MATH_SIMD_AVX
+MATH_FORCE_INLINE __m256 Simd::MultiplyAdd(const __m256 a, const __m256 b, const __m256 c) noexcept
+{
+#ifdef MATH_SIMD_FMA
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+MATH_FORCE_INLINE __m256 Simd::LinearCombination(const __m256 v, const __m256 c0, const __m256 c1, const __m256 c2, const __m256 c3) noexcept
+{
+    // _mm256_shuffle_ps works on each 128-bit lane separately, which broadcasts one component per lane
+    __m256 result = _mm256_mul_ps(c0, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = MultiplyAdd(c1, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = MultiplyAdd(c2, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    return MultiplyAdd(c3, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+}
+
+MATH_FORCE_INLINE __m256 Simd::Rsqrt(const __m256 v) noexcept
+{
+    // r * (1.5 - 0.5 * v * r * r)
+    const __m256 r = _mm256_rsqrt_ps(v);
+    const __m256 halfVrr = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), v), _mm256_mul_ps(r, r));
+    return _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.5f), halfVrr));
+}
+#endif
+
+inline void Simd::TransformVector4(const float_t* const matrix, const float_t* const vector, float_t* const result) noexcept
+{
+    _mm_storeu_ps(
+        result,
+        LinearCombination(
+            _mm_loadu_ps(vector),
+            _mm_loadu_ps(matrix),
+            _mm_loadu_ps(matrix + 4),
+            _mm_loadu_ps(matrix + 8),
+            _mm_loadu_ps(matrix + 12)
+        )
+    );
+}
+
+inline void Simd::MultiplyMatrix4(const float_t* const lhs, const float_t* const rhs, float_t* const result) noexcept
+{
+    // Each column of the result is the combination of the columns of lhs by the matching column of rhs.
+    // Everything is loaded before the first store so that result can alias any of the operands.
+#ifdef MATH_SIMD_AVX
+    const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs));
+    const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+    const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+    const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+
+    const __m256 rhs01 = _mm256_loadu_ps(rhs);
+    const __m256 rhs23 = _mm256_loadu_ps(rhs + 8);
+
+    _mm256_storeu_ps(result, LinearCombination(rhs01, c0, c1, c2, c3));
+    _mm256_storeu_ps(result + 8, LinearCombination(rhs23, c0, c1, c2, c3));
+#else
+    const __m128 c0 = _mm_loadu_ps(lhs);
+    const __m128 c1 = _mm_loadu_ps(lhs + 4);
+    const __m128 c2 = _mm_loadu_ps(lhs + 8);
+    const __m128 c3 = _mm_loadu_ps(lhs + 12);
+
+    const __m128 r0 = LinearCombination(_mm_loadu_ps(rhs), c0, c1, c2, c3);
+    const __m128 r1 = LinearCombination(_mm_loadu_ps(rhs + 4), c0, c1, c2, c3);
+    const __m128 r2 = LinearCombination(_mm_loadu_ps(rhs + 8), c0, c1, c2, c3);
+    const __m128 r3 = LinearCombination(_mm_loadu_ps(rhs + 12), c0, c1, c2, c3);
+
+    _mm_storeu_ps(result, r0);
+    _mm_storeu_ps(result + 4, r1);
+    _mm_storeu_ps(result + 8, r2);
+    _mm_storeu_ps(result + 12, r3);
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::Cross3(const __m128 a, const __m128 b) noexcept
+{
+    const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    // a.yzx * b.zxy - a.zxy * b.yzx, computed as (a * b.yzx - a.yzx * b).yzx
+    const __m128 result = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+    return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+MATH_FORCE_INLINE __m128 Simd::HorizontalSum(const __m128 v) noexcept
+{
+    const __m128 sum = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+inline bool_t Simd::InvertMatrix4(const float_t* const matrix, float_t* const result) noexcept
+{
+    // Block-wise inversion using 2x2 sub-matrices, each stored in a register as (s00, s01, s10, s11).
+    // The inverse of the transpose is the transpose of the inverse, so the storage order doesn't matter here.
+    // Reference: https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+
+    // 2x2 matrix product a * b
+    const auto mul2 = [](const __m128 a, const __m128 b)
+    {
+        return _mm_add_ps(
+            _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2)))
+        );
+    };
+    // 2x2 matrix product adj(a) * b
+    const auto adjMul2 = [](const __m128 a, const __m128 b)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)))
+        );
+    };
+    // 2x2 matrix product a * adj(b)
+    const auto mulAdj2 = [](const __m128 a, const __m128 b)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2)))
+        );
+    };
+
+    const __m128 c0 = _mm_loadu_ps(matrix);
+    const __m128 c1 = _mm_loadu_ps(matrix + 4);
+    const __m128 c2 = _mm_loadu_ps(matrix + 8);
+    const __m128 c3 = _mm_loadu_ps(matrix + 12);
+
+    const __m128 a = _mm_movelh_ps(c0, c1);
+    const __m128 b = _mm_movehl_ps(c1, c0);
+    const __m128 c = _mm_movelh_ps(c2, c3);
+    const __m128 d = _mm_movehl_ps(c3, c2);
+
+    // Determinants of the sub-matrices, as (|a|, |b|, |c|, |d|)
+    const __m128 subDeterminants = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0)))
+    );
+    const __m128 detA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 detB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 detC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 detD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 adjDC = adjMul2(d, c);
+    const __m128 adjAB = adjMul2(a, b);
+
+    // Adjugates of the blocks of the inverse
+    const __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mul2(b, adjDC));
+    const __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mul2(c, adjAB));
+    const __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mulAdj2(d, adjAB));
+    const __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mulAdj2(a, adjDC));
+
+    // |m| = |a| * |d| + |b| * |c| - tr(adj(a) * b * adj(d) * c)
+    const __m128 trace = HorizontalSum(_mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0))));
+    const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+    if (_mm_cvtss_f32(determinant) == 0.f) [[unlikely]]
+        return false;
+
+    const __m128 invDeterminant = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+    const __m128 xScaled = _mm_mul_ps(x, invDeterminant);
+    const __m128 yScaled = _mm_mul_ps(y, invDeterminant);
+    const __m128 zScaled = _mm_mul_ps(z, invDeterminant);
+    const __m128 wScaled = _mm_mul_ps(w, invDeterminant);
+
+    _mm_storeu_ps(result, _mm_shuffle_ps(xScaled, yScaled, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(result + 4, _mm_shuffle_ps(xScaled, yScaled, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(result + 8, _mm_shuffle_ps(zScaled, wScaled, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(result + 12, _mm_shuffle_ps(zScaled, wScaled, _MM_SHUFFLE(0, 2, 0, 2)));
+
+    return true;
+}
+
+inline bool_t Simd::InvertAffineMatrix4(const float_t* const matrix, float_t* const result) noexcept
+{
+    // The rows of the inverse of a 3x3 matrix are the cross products of its columns divided by its determinant
+    const __m128 c0 = _mm_loadu_ps(matrix);
+    const __m128 c1 = _mm_loadu_ps(matrix + 4);
+    const __m128 c2 = _mm_loadu_ps(matrix + 8);
+    const __m128 translation = _mm_loadu_ps(matrix + 12);
+
+    __m128 r0 = Cross3(c1, c2);
+    __m128 r1 = Cross3(c2, c0);
+    __m128 r2 = Cross3(c0, c1);
+    __m128 r3 = _mm_setr_ps(0.f, 0.f, 0.f, -1.f);
+
+    const __m128 determinant = HorizontalSum(_mm_mul_ps(c0, r0));
+
+    if (_mm_cvtss_f32(determinant) == 0.f) [[unlikely]]
+        return false;
+
+    const __m128 invDeterminant = _mm_div_ps(_mm_set1_ps(1.f), determinant);
+    r0 = _mm_mul_ps(r0, invDeterminant);
+    r1 = _mm_mul_ps(r1, invDeterminant);
+    r2 = _mm_mul_ps(r2, invDeterminant);
+
+    // Turns the rows into columns, r3 becoming (0, 0, 0, -1)
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    // The translation's w is 1, so this gives (inverse * translation, -1), which is then negated
+    const __m128 inverseTranslation = _mm_sub_ps(_mm_setzero_ps(), LinearCombination(translation, r0, r1, r2, r3));
+
+    _mm_storeu_ps(result, r0);
+    _mm_storeu_ps(result + 4, r1);
+    _mm_storeu_ps(result + 8, r2);
+    _mm_storeu_ps(result + 12, inverseTranslation);
+
+    return true;
+}
+
+inline void Simd::InvertRigidMatrix4(const float_t* const matrix, float_t* const result) noexcept
+{
+    __m128 r0 = _mm_loadu_ps(matrix);
+    __m128 r1 = _mm_loadu_ps(matrix + 4);
+    __m128 r2 = _mm_loadu_ps(matrix + 8);
+    __m128 r3 = _mm_setzero_ps();
+    const __m128 translation = _mm_loadu_ps(matrix + 12);
+
+    // Turns the columns of the rotation into rows, their last component coming from r3
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    r3 = _mm_setr_ps(0.f, 0.f, 0.f, -1.f);
+
+    // The translation's w is 1, so this gives (transposed * translation, -1), which is then negated
+    const __m128 inverseTranslation = _mm_sub_ps(_mm_setzero_ps(), LinearCombination(translation, r0, r1, r2, r3));
+
+    _mm_storeu_ps(result, r0);
+    _mm_storeu_ps(result + 4, r1);
+    _mm_storeu_ps(result + 8, r2);
+    _mm_storeu_ps(result + 12, inverseTranslation);
+}
+
+MATH_FORCE_INLINE void Simd::LoadAffine3x4(const float_t* const matrix, __m128* const c0, __m128* const c1, __m128* const c2, __m128* const c3) noexcept
+{
+    // The 12 values are loaded as 3 vectors, e.g. (m00, m10, m20, m01), (m11, m21, m02, m12) and (m22, m03, m13, m23)
+    const __m128 v0 = _mm_loadu_ps(matrix);
+    const __m128 v1 = _mm_loadu_ps(matrix + 4);
+    const __m128 v2 = _mm_loadu_ps(matrix + 8);
+
+    *c0 = v0;
+    *c1 = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 3, 3)), v1, _MM_SHUFFLE(1, 1, 2, 0));
+    *c2 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(0, 0, 3, 2));
+    *c3 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 2, 1));
+}
+
+MATH_FORCE_INLINE void Simd::StoreAffine3x4(const __m128 c0, const __m128 c1, const __m128 c2, const __m128 c3, float_t* const result) noexcept
+{
+    // The columns are packed back into 3 vectors, so that the stores don't overlap
+    _mm_storeu_ps(result, _mm_shuffle_ps(c0, _mm_shuffle_ps(c0, c1, _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(result + 4, _mm_shuffle_ps(c1, c2, _MM_SHUFFLE(1, 0, 2, 1)));
+    _mm_storeu_ps(result + 8, _mm_shuffle_ps(_mm_shuffle_ps(c2, c3, _MM_SHUFFLE(0, 0, 2, 2)), c3, _MM_SHUFFLE(2, 1, 2, 0)));
+}
+
+inline void Simd::MultiplyAffine3x4(const float_t* const lhs, const float_t* const rhs, float_t* const result) noexcept
+{
+    // Each column of the result is the combination of the columns of lhs by the matching column of rhs,
+    // the last column of lhs being added to the last one as rhs implicitly has a last row of (0, 0, 0, 1).
+    // Everything is loaded before the first store so that result can alias any of the operands.
+    __m128 c0, c1, c2, c3;
+    LoadAffine3x4(lhs, &c0, &c1, &c2, &c3);
+
+    const __m128 v0 = _mm_loadu_ps(rhs);
+    const __m128 v1 = _mm_loadu_ps(rhs + 4);
+    const __m128 v2 = _mm_loadu_ps(rhs + 8);
+
+    // The values of rhs, e.g. (m00, m10, m20, m01), (m11, m21, m02, m12) and (m22, m03, m13, m23), are broadcast one by one
+    __m128 r0 = _mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(0, 0, 0, 0)));
+    r0 = MultiplyAdd(c1, _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(1, 1, 1, 1)), r0);
+    r0 = MultiplyAdd(c2, _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(2, 2, 2, 2)), r0);
+
+    __m128 r1 = _mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 3, 3, 3)));
+    r1 = MultiplyAdd(c1, _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(0, 0, 0, 0)), r1);
+    r1 = MultiplyAdd(c2, _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(1, 1, 1, 1)), r1);
+
+    __m128 r2 = _mm_mul_ps(c0, _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2, 2, 2, 2)));
+    r2 = MultiplyAdd(c1, _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 3, 3, 3)), r2);
+    r2 = MultiplyAdd(c2, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(0, 0, 0, 0)), r2);
+
+    __m128 r3 = MultiplyAdd(c0, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(1, 1, 1, 1)), c3);
+    r3 = MultiplyAdd(c1, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(2, 2, 2, 2)), r3);
+    r3 = MultiplyAdd(c2, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 3, 3)), r3);
+
+    StoreAffine3x4(r0, r1, r2, r3, result);
+}
+
+inline bool_t Simd::InvertAffine3x4(const float_t* const matrix, float_t* const result) noexcept
+{
+    // The rows of the inverse of a 3x3 matrix are the cross products of its columns divided by its determinant
+    __m128 c0, c1, c2, translation;
+    LoadAffine3x4(matrix, &c0, &c1, &c2, &translation);
+
+    __m128 r0 = Cross3(c1, c2);
+    __m128 r1 = Cross3(c2, c0);
+    __m128 r2 = Cross3(c0, c1);
+
+    const __m128 determinant = Dot3(c0, r0);
+
+    if (_mm_cvtss_f32(determinant) == 0.f) [[unlikely]]
+        return false;
+
+    const __m128 invDeterminant = _mm_div_ps(_mm_set1_ps(1.f), determinant);
+    r0 = _mm_mul_ps(r0, invDeterminant);
+    r1 = _mm_mul_ps(r1, invDeterminant);
+    r2 = _mm_mul_ps(r2, invDeterminant);
+
+    // Turns the rows into columns
+    Transpose3(&r0, &r1, &r2);
+
+    StoreAffine3x4(r0, r1, r2, Negate(LinearCombination3(translation, r0, r1, r2)), result);
+
+    return true;
+}
+
+MATH_FORCE_INLINE __m128 Simd::LinearCombination3(const __m128 v, const __m128 c0, const __m128 c1, const __m128 c2) noexcept
+{
+    __m128 result = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = MultiplyAdd(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    return MultiplyAdd(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+}
+
+MATH_FORCE_INLINE void Simd::Transpose3(__m128* const c0, __m128* const c1, __m128* const c2) noexcept
+{
+    // xy01 = (c0.x, c1.x, c0.y, c1.y) and zw01 = (c0.z, c1.z, c0.w, c1.w)
+    const __m128 xy01 = _mm_unpacklo_ps(*c0, *c1);
+    const __m128 zw01 = _mm_unpackhi_ps(*c0, *c1);
+
+    *c0 = _mm_movelh_ps(xy01, *c2);
+    *c1 = _mm_shuffle_ps(xy01, *c2, _MM_SHUFFLE(3, 1, 3, 2));
+    *c2 = _mm_shuffle_ps(zw01, *c2, _MM_SHUFFLE(3, 2, 1, 0));
+}
+
+inline void Simd::MultiplyMatrix3A(const float_t* const lhs, const float_t* const rhs, float_t* const result) noexcept
+{
+    // Everything is loaded before the first store so that result can alias any of the operands
+    const __m128 c0 = _mm_load_ps(lhs);
+    const __m128 c1 = _mm_load_ps(lhs + 4);
+    const __m128 c2 = _mm_load_ps(lhs + 8);
+
+    const __m128 r0 = LinearCombination3(_mm_load_ps(rhs), c0, c1, c2);
+    const __m128 r1 = LinearCombination3(_mm_load_ps(rhs + 4), c0, c1, c2);
+    const __m128 r2 = LinearCombination3(_mm_load_ps(rhs + 8), c0, c1, c2);
+
+    _mm_store_ps(result, r0);
+    _mm_store_ps(result + 4, r1);
+    _mm_store_ps(result + 8, r2);
+}
+
+inline void Simd::TransposeMatrix3A(const float_t* const matrix, float_t* const result) noexcept
+{
+    __m128 c0 = _mm_load_ps(matrix);
+    __m128 c1 = _mm_load_ps(matrix + 4);
+    __m128 c2 = _mm_load_ps(matrix + 8);
+
+    Transpose3(&c0, &c1, &c2);
+
+    _mm_store_ps(result, c0);
+    _mm_store_ps(result + 4, c1);
+    _mm_store_ps(result + 8, c2);
+}
+
+inline bool_t Simd::InvertMatrix3A(const float_t* const matrix, float_t* const result) noexcept
+{
+    // Same as InvertAffine3x4, without the translation
+    const __m128 c0 = _mm_load_ps(matrix);
+    const __m128 c1 = _mm_load_ps(matrix + 4);
+    const __m128 c2 = _mm_load_ps(matrix + 8);
+
+    __m128 r0 = Cross3(c1, c2);
+    __m128 r1 = Cross3(c2, c0);
+    __m128 r2 = Cross3(c0, c1);
+
+    const __m128 determinant = Dot3(c0, r0);
+
+    if (_mm_cvtss_f32(determinant) == 0.f) [[unlikely]]
+        return false;
+
+    const __m128 invDeterminant = _mm_div_ps(_mm_set1_ps(1.f), determinant);
+    r0 = _mm_mul_ps(r0, invDeterminant);
+    r1 = _mm_mul_ps(r1, invDeterminant);
+    r2 = _mm_mul_ps(r2, invDeterminant);
+
+    Transpose3(&r0, &r1, &r2);
+
+    _mm_store_ps(result, r0);
+    _mm_store_ps(result + 4, r1);
+    _mm_store_ps(result + 8, r2);
+
+    return true;
+}
+
+MATH_FORCE_INLINE __m128 Simd::Dot4(const __m128 a, const __m128 b) noexcept { return HorizontalSum(_mm_mul_ps(a, b)); }
+
+MATH_FORCE_INLINE __m128 Simd::Negate(const __m128 v) noexcept { return _mm_xor_ps(v, _mm_set1_ps(-0.f)); }
+
+MATH_FORCE_INLINE __m128 Simd::MultiplyQuaternion(const __m128 a, const __m128 b) noexcept
+{
+    // x = aw * bx + ax * bw + ay * bz - az * by
+    // y = aw * by + ay * bw + az * bx - ax * bz
+    // z = aw * bz + az * bw + ax * by - ay * bx
+    // w = aw * bw - ax * bx - ay * by - az * bz
+    const __m128 wSignMask = _mm_setr_ps(0.f, 0.f, 0.f, -0.f);
+
+    __m128 result = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+
+    const __m128 second = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 2, 1, 0)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 3, 3)));
+    result = _mm_add_ps(result, _mm_xor_ps(second, wSignMask));
+
+    const __m128 third = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 2, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 0, 2)));
+    result = _mm_add_ps(result, _mm_xor_ps(third, wSignMask));
+
+    const __m128 fourth = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 1, 0, 2)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 0, 2, 1)));
+    return _mm_sub_ps(result, fourth);
+}
+
+MATH_FORCE_INLINE __m128 Simd::Dot3(const __m128 a, const __m128 b) noexcept
+{
+    const __m128 product = _mm_mul_ps(a, b);
+    const __m128 x = _mm_shuffle_ps(product, product, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 y = _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 z = _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm_add_ps(_mm_add_ps(x, y), z);
+}
+
+MATH_FORCE_INLINE __m128 Simd::Rsqrt(const __m128 v) noexcept
+{
+    // r * (1.5 - 0.5 * v * r * r)
+    const __m128 r = _mm_rsqrt_ps(v);
+    const __m128 halfVrr = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), v), _mm_mul_ps(r, r));
+    return _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), halfVrr));
+}
+
+MATH_FORCE_INLINE void Simd::SinCos(const __m128 angles, __m128* const sin, __m128* const cos) noexcept
+{
+    // Reduces the angles to [-Pi / 4, Pi / 4], Pi / 2 being split in three constants to keep the precision of the subtraction
+    const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angles, _mm_set1_ps(0.636619772f)));
+    const __m128 q = _mm_cvtepi32_ps(quadrant);
+    __m128 x = _mm_sub_ps(angles, _mm_mul_ps(q, _mm_set1_ps(1.5703125f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+
+    // Minimax polynomials on [-Pi / 4, Pi / 4]
+    const __m128 x2 = _mm_mul_ps(x, x);
+    __m128 s = MultiplyAdd(_mm_set1_ps(-1.9515295891e-4f), x2, _mm_set1_ps(8.3321608736e-3f));
+    s = MultiplyAdd(s, x2, _mm_set1_ps(-1.6666654611e-1f));
+    s = MultiplyAdd(_mm_mul_ps(s, x2), x, x);
+    __m128 c = MultiplyAdd(_mm_set1_ps(2.443315711809948e-5f), x2, _mm_set1_ps(-1.388731625493765e-3f));
+    c = MultiplyAdd(c, x2, _mm_set1_ps(4.166664568298827e-2f));
+    c = MultiplyAdd(_mm_mul_ps(c, x2), x2, _mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), x2)));
+
+    // sin(x + n * Pi / 2) and cos(x + n * Pi / 2) cycle through sin(x), cos(x), -sin(x) and -cos(x)
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+    const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+    *sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), sinSign);
+    *cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), cosSign);
+}
+
+MATH_FORCE_INLINE bool_t Simd::IsSinCosInRange(const __m128 angles) noexcept
+{
+    // NaNs also fail this test
+    const __m128 absAngles = _mm_andnot_ps(_mm_set1_ps(-0.f), angles);
+    return _mm_movemask_ps(_mm_cmpnle_ps(absAngles, _mm_set1_ps(8192.f))) == 0;
+}
+
+MATH_FORCE_INLINE __m128 Simd::Truncate(const __m128 v) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+    // Floats of at least 2^23 have no fractional part, and don't fit in an int32_t. NaNs also fail this test and are kept as well.
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    const __m128 small = _mm_cmplt_ps(_mm_andnot_ps(signMask, v), _mm_set1_ps(8388608.f));
+    // Restores the sign of the values truncated to zero
+    const __m128 truncated = _mm_or_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(v)), _mm_and_ps(v, signMask));
+    return _mm_or_ps(_mm_and_ps(small, truncated), _mm_andnot_ps(small, v));
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::Floor(const __m128 v) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+#else
+    const __m128 truncated = Truncate(v);
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, v), _mm_set1_ps(1.f)));
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::Ceil(const __m128 v) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+#else
+    // Adding the sign of v instead of +0 keeps the negative zeros, e.g. Ceil(-0.5) == -0
+    const __m128 truncated = Truncate(v);
+    const __m128 increment = _mm_or_ps(_mm_and_ps(_mm_cmplt_ps(truncated, v), _mm_set1_ps(1.f)), _mm_and_ps(v, _mm_set1_ps(-0.f)));
+    return _mm_add_ps(truncated, increment);
+#endif
+}
+
+MATH_FORCE_INLINE __m128 Simd::Round(const __m128 v) noexcept
+{
+    // roundps rounds halfway cases to even, so this adds the sign of v to the truncated value when its fractional part is at least 0.5
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    const __m128 truncated = Truncate(v);
+    const __m128 sign = _mm_and_ps(v, signMask);
+    const __m128 halfOrMore = _mm_cmpge_ps(_mm_andnot_ps(signMask, _mm_sub_ps(v, truncated)), _mm_set1_ps(0.5f));
+    return _mm_add_ps(truncated, _mm_or_ps(_mm_and_ps(halfOrMore, _mm_set1_ps(1.f)), sign));
+}
+
+template <typename T>
+__m128 Simd::Load(const T& value) noexcept
+{
+    static_assert(alignof(T) >= 16, "Simd::Load requires a 16-byte aligned type");
+    return _mm_load_ps(value.Data());
+}
+
+template <typename T>
+T Simd::Store(const __m128 v) noexcept
+{
+    static_assert(alignof(T) >= 16, "Simd::Store requires a 16-byte aligned type");
+    T result;
+    _mm_store_ps(result.Data(), v);
+    return result;
+}
+
+template <size_t N>
+MATH_FORCE_INLINE __m128i Simd::LoadLanes(const int32_t* const data) noexcept
+{
+    static_assert(N > 0 && N <= 4, "Simd::LoadLanes loads up to 4 int32_t values");
+
+    if constexpr (N == 4)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    else if constexpr (N == 3)
+        return _mm_setr_epi32(data[0], data[1], data[2], 0);
+    else if constexpr (N == 2)
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+    else
+        return _mm_cvtsi32_si128(data[0]);
+}
+
+template <size_t N>
+MATH_FORCE_INLINE auto Simd::LoadLanes(const double_t* const data) noexcept
+{
+    static_assert(HasLanes<double_t, N>, "Simd::LoadLanes loads up to 2 double_t values, or 4 when MATH_SIMD_AVX is defined");
+
+    if constexpr (N == 1)
+        return _mm_load_sd(data);
+    else if constexpr (N == 2)
+        return _mm_loadu_pd(data);
+#ifdef MATH_SIMD_AVX
+    else if constexpr (N == 3)
+        return _mm256_setr_pd(data[0], data[1], data[2], 0.);
+    else
+        return _mm256_loadu_pd(data);
+#endif
+}
+
+template <size_t N>
+MATH_FORCE_INLINE void Simd::StoreLanes(const __m128i v, int32_t* const data) noexcept
+{
+    static_assert(N > 0 && N <= 4, "Simd::StoreLanes stores up to 4 int32_t values");
+
+    if constexpr (N == 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), v);
+    }
+    else if constexpr (N >= 2)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(data), v);
+        if constexpr (N == 3)
+            data[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 2, 2)));
+    }
+    else
+    {
+        data[0] = _mm_cvtsi128_si32(v);
+    }
+}
+
+template <size_t N>
+MATH_FORCE_INLINE void Simd::StoreLanes(const __m128d v, double_t* const data) noexcept
+{
+    static_assert(N > 0 && N <= 2, "Simd::StoreLanes stores up to 2 double_t values from a __m128d");
+
+    if constexpr (N == 2)
+        _mm_storeu_pd(data, v);
+    else
+        _mm_store_sd(data, v);
+}
+
+MATH_FORCE_INLINE __m128i Simd::Add(const __m128i a, const __m128i b) noexcept { return _mm_add_epi32(a, b); }
+
+MATH_FORCE_INLINE __m128i Simd::Subtract(const __m128i a, const __m128i b) noexcept { return _mm_sub_epi32(a, b); }
+
+MATH_FORCE_INLINE __m128i Simd::Multiply(const __m128i a, const __m128i b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_mullo_epi32(a, b);
+#else
+    // Multiplies the even and odd lanes separately, then interleaves the low halves of the 64-bit products
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+MATH_FORCE_INLINE __m128i Simd::Min(const __m128i a, const __m128i b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_min_epi32(a, b);
+#else
+    const __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+#endif
+}
+
+MATH_FORCE_INLINE __m128i Simd::Max(const __m128i a, const __m128i b) noexcept
+{
+#ifdef MATH_SIMD_AVX
+    return _mm_max_epi32(a, b);
+#else
+    const __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+#endif
+}
+
+MATH_FORCE_INLINE __m128d Simd::Add(const __m128d a, const __m128d b) noexcept { return _mm_add_pd(a, b); }
+
+MATH_FORCE_INLINE __m128d Simd::Subtract(const __m128d a, const __m128d b) noexcept { return _mm_sub_pd(a, b); }
+
+MATH_FORCE_INLINE __m128d Simd::Multiply(const __m128d a, const __m128d b) noexcept { return _mm_mul_pd(a, b); }
+
+MATH_FORCE_INLINE __m128d Simd::Divide(const __m128d a, const __m128d b) noexcept { return _mm_div_pd(a, b); }
+
+MATH_FORCE_INLINE __m128d Simd::Min(const __m128d a, const __m128d b) noexcept { return _mm_min_pd(a, b); }
+
+MATH_FORCE_INLINE __m128d Simd::Max(const __m128d a, const __m128d b) noexcept { return _mm_max_pd(a, b); }
+
+#ifdef MATH_SIMD_AVX
+template <size_t N>
+MATH_FORCE_INLINE void Simd::StoreLanes(const __m256d v, double_t* const data) noexcept
+{
+    static_assert(N > 2 && N <= 4, "Simd::StoreLanes stores 3 or 4 double_t values from a __m256d");
+
+    if constexpr (N == 4)
+    {
+        _mm256_storeu_pd(data, v);
+    }
+    else
+    {
+        _mm_storeu_pd(data, _mm256_castpd256_pd128(v));
+        _mm_store_sd(data + 2, _mm256_extractf128_pd(v, 1));
+    }
+}
+
+MATH_FORCE_INLINE __m256d Simd::Add(const __m256d a, const __m256d b) noexcept { return _mm256_add_pd(a, b); }
+
+MATH_FORCE_INLINE __m256d Simd::Subtract(const __m256d a, const __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+
+MATH_FORCE_INLINE __m256d Simd::Multiply(const __m256d a, const __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+
+MATH_FORCE_INLINE __m256d Simd::Divide(const __m256d a, const __m256d b) noexcept { return _mm256_div_pd(a, b); }
+
+MATH_FORCE_INLINE __m256d Simd::Min(const __m256d a, const __m256d b) noexcept { return _mm256_min_pd(a, b); }
+
+MATH_FORCE_INLINE __m256d Simd::Max(const __m256d a, const __m256d b) noexcept { return _mm256_max_pd(a, b); }
+#endif
+
+#endif
@@ -1,67 +1,104 @@
 #include "Math/vector2.hpp"
 
 #include <format>
+#include <stdexcept>
 
 #include "Math/calc.hpp"
+#include "Math/dispatch.hpp"
 #include "Math/vector2i.hpp"
 #include "Math/vector3.hpp"
 #include "Math/vector4.hpp"
 
-float_t Vector2::Length() const noexcept
+MATH_INLINE float_t Vector2::Length() const noexcept
 {
 	return std::sqrt(SquaredLength());
 }
 
-Vector2 Vector2::Normalized() const noexcept
+MATH_INLINE Vector2 Vector2::Normalized() const noexcept
 {
 	const float_t length = Length();
 	if (Calc::IsZero(length))
 		return Zero();
 
-    __assume(length != 0.f);
+    MATH_ASSUME(length != 0.f);
 	const float_t invLength = 1.f / length;
 	return Vector2(x * invLength, y * invLength);
 }
 
-Vector2 Vector2::Normal() const noexcept { return Vector2(y, -x).Normalized(); }
+MATH_INLINE Vector2 Vector2::Normalized(Calc::FastMathTag) const noexcept
+{
+	const float_t squaredLength = SquaredLength();
+	if (squaredLength <= SQ(Calc::Zero))
+		return Zero();
 
-Vector2 Vector2::Rotated(const float_t angle) const noexcept { return Rotated(std::cos(angle), std::sin(angle)); }
+	return *this * Calc::FastRsqrt(squaredLength);
+}
+
+MATH_INLINE void Vector2::Normalize(const std::span<const Vector2> vectors, const std::span<Vector2> results)
+{
+	static_assert(sizeof(Vector2) == 2 * sizeof(float_t), "Vector2 must be tightly packed to be used as an array of float_t");
+
+	if (results.size() < vectors.size())
+		MATH_THROW(std::invalid_argument("The output range must be at least as large as the vector range"));
+
+	if (vectors.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors2(vectors.front().Data(), results.front().Data(), vectors.size());
+}
+
+MATH_INLINE void Vector2::NormalizeInPlace(const std::span<Vector2> vectors) noexcept
+{
+	if (vectors.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors2(vectors.front().Data(), vectors.front().Data(), vectors.size());
+}
+
+MATH_INLINE Vector2 Vector2::Normal() const noexcept { return Vector2(y, -x).Normalized(); }
+
+MATH_INLINE Vector2 Vector2::Rotated(const float_t angle) const noexcept
+{
+	float_t sin, cos;
+	Calc::SinCos(angle, &sin, &cos);
+	return Rotated(cos, sin);
+}
 
-Vector2 Vector2::Rotated(const float_t c, const float_t s) const noexcept { return Vector2(x * c - y * s, x * s + y * c); }
+MATH_INLINE Vector2 Vector2::Rotated(const float_t c, const float_t s) const noexcept { return Vector2(x * c - y * s, x * s + y * c); }
 
-float_t Vector2::GetAngle() const noexcept
+MATH_INLINE float_t Vector2::GetAngle() const noexcept
 {
 	return std::atan2(y, x);
 }
 
-bool Vector2::IsInfinity() const noexcept
+MATH_INLINE bool Vector2::IsInfinity() const noexcept
 {
 	return std::isinf(x)
 		&& std::isinf(y);
 }
 
-bool Vector2::IsNaN() const noexcept
+MATH_INLINE bool Vector2::IsNaN() const noexcept
 {
 	return std::isnan(x)
 		&& std::isnan(y);
 }
 
-Vector2::operator Vector2i() const noexcept
+MATH_INLINE Vector2::operator Vector2i() const noexcept
 {
 	return Vector2i(static_cast<int32_t>(std::round(x)), static_cast<int32_t>(std::round(y)));
 }
 
-Vector2::operator Vector3() const noexcept
+MATH_INLINE Vector2::operator Vector3() const noexcept
 {
 	return Vector3(x, y, 0.f);
 }
 
-Vector2::operator Vector4() const noexcept
+MATH_INLINE Vector2::operator Vector4() const noexcept
 {
 	return Vector4(x, y, 0.f, 1.f);
 }
 
-std::ostream& operator<<(std::ostream& out, const Vector2 v) noexcept
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Vector2 v) noexcept
 {
 	return out << std::format("{{{:.3f} {:.3f}}}", v.x, v.y);
 }
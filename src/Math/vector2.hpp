@@ -4,19 +4,22 @@
 #include <sstream>
 
 #include <ostream>
+#include <span>
 #include <stdexcept>
 
 #include "Math/core.hpp"
+#include "Math/vectort.hpp"
 
 /// @file vector2.hpp
 /// @brief Defines the Vector2 struct.
 
-struct Vector2i;
-struct Vector3;
-struct Vector4;
+namespace Calc { struct FastMathTag; }
 
 /// @brief The Vector2 struct represents either a two-dimensional vector or a point.
-struct MATH_TOOLBOX Vector2
+///
+/// This is the two-dimensional float specialization of VectorT, which provides the other dimensions and value types.
+template <>
+struct MATH_TOOLBOX VectorT<2, float_t>
 {
     /// @brief The @c x component of this Vector2.
     float_t x = 0.f;
@@ -55,25 +58,25 @@ struct MATH_TOOLBOX Vector2
     static constexpr float_t Determinant(Vector2 a, Vector2 b) noexcept;
 
     /// @brief Constructs a Vector2 with both its components set to 0.
-    constexpr Vector2() = default;
+    constexpr VectorT() = default;
 
     /// @brief Constructs a Vector2 with both its components set to @p xy.
     ///
     /// @param xy The value to set this vector's x and y components to.
-    constexpr explicit Vector2(float_t xy) noexcept;
+    constexpr explicit VectorT(float_t xy) noexcept;
 
     /// @brief Constructs a Vector2 with its components set to the data pointed by @p data.
     ///
     /// This constructor assumes that @p data is a valid pointer pointing to at least 2 @c float_t values.
     ///
     /// @param data The data where the values for this vector's components are located.
-    constexpr explicit Vector2(const float_t* data) noexcept;
+    constexpr explicit VectorT(const float_t* data) noexcept;
 
     /// @brief Constructs a Vector2 with set component values.
     ///
     /// @param x The value to set this vector's x component to.
     /// @param y The value to set this vector's y component to.
-    constexpr Vector2(float_t x, float_t y) noexcept;
+    constexpr VectorT(float_t x, float_t y) noexcept;
 
     /// @brief	Gets a pointer to the first component of this vector.
     ///
@@ -101,6 +104,27 @@ struct MATH_TOOLBOX Vector2
     [[nodiscard]]
     Vector2 Normalized() const noexcept;
 
+    /// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+    ///
+    /// @returns A vector with the same direction but a length of one.
+    [[nodiscard]]
+    Vector2 Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Normalizes each of the given vectors, vectors with a length of zero staying zero.
+    ///
+    /// The vectors are normalized several at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+    /// They are multiplied by an approximate inverse square root refined with a Newton-Raphson step,
+    /// so the results can differ from Normalized() in the last bits.
+    ///
+    /// @param vectors The vectors to normalize.
+    /// @param results The output of the function. May be @p vectors.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p vectors.
+    static void Normalize(std::span<const Vector2> vectors, std::span<Vector2> results);
+
+    /// @brief Normalizes each of the given vectors in place, like @ref Normalize(std::span<const Vector2>, std::span<Vector2>).
+    static void NormalizeInPlace(std::span<Vector2> vectors) noexcept;
+
     /// @brief Returns the normal vector to this one.
     ///
     /// @returns A vector with a perpendical direction and a length of 1.
@@ -144,6 +168,16 @@ struct MATH_TOOLBOX Vector2
     [[nodiscard]]
     constexpr float_t& operator[](size_t i);
 
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t i) noexcept;
+
     /// @brief Converts this Vector2 to a Vector2i by casting its components to @c int32_t.
     explicit operator Vector2i() const noexcept;
 
@@ -160,11 +194,11 @@ static_assert(std::is_move_constructible_v<Vector2>, "Class Vector2 must be move
 static_assert(std::is_copy_assignable_v<Vector2>, "Class Vector2 must be copy assignable.");
 static_assert(std::is_move_assignable_v<Vector2>, "Class Vector2 must be move assignable.");
 
-constexpr Vector2::Vector2(const float_t xy) noexcept : x(xy), y(xy) {}
+constexpr Vector2::VectorT(const float_t xy) noexcept : x(xy), y(xy) {}
 
-constexpr Vector2::Vector2(const float_t* const data) noexcept : x(data[0]), y(data[1]) {}
+constexpr Vector2::VectorT(const float_t* const data) noexcept : x(data[0]), y(data[1]) {}
 
-constexpr Vector2::Vector2(const float_t x, const float_t y) noexcept : x(x), y(y) {}
+constexpr Vector2::VectorT(const float_t x, const float_t y) noexcept : x(x), y(y) {}
 
 constexpr Vector2 Vector2::Zero() noexcept { return Vector2(); }
 
@@ -191,7 +225,7 @@ constexpr float_t Vector2::operator[](const size_t i) const
     if (i < 2) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-    throw std::out_of_range("Vector2 subscript out of range");
+    MATH_THROW(std::out_of_range("Vector2 subscript out of range"));
 }
 
 constexpr float_t& Vector2::operator[](const size_t i)
@@ -199,9 +233,13 @@ constexpr float_t& Vector2::operator[](const size_t i)
     if (i < 2) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-    throw std::out_of_range("Vector2 subscript out of range");
+    MATH_THROW(std::out_of_range("Vector2 subscript out of range"));
 }
 
+constexpr float_t Vector2::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr float_t& Vector2::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
 /// @brief Adds two Vector2 together.
 [[nodiscard]]
 constexpr Vector2 operator+(const Vector2 a, const Vector2 b) noexcept { return Vector2(a.x + b.x, a.y + b.y); }
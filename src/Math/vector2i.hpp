@@ -10,11 +10,11 @@
 /// @file vector2i.hpp
 /// @brief Defines the Vector2i struct.
 
-struct Vector3;
-struct Vector4;
-
 /// @brief The Vector2i struct represents either a two-dimensional vector or a point.
-struct MATH_TOOLBOX Vector2i
+///
+/// This is the two-dimensional integer specialization of VectorT, which provides the other dimensions and value types.
+template <>
+struct MATH_TOOLBOX VectorT<2, int32_t>
 {
     /// @brief The @c x component of this Vector2i.
     int32_t x = 0;
@@ -52,23 +52,23 @@ struct MATH_TOOLBOX Vector2i
     [[nodiscard]]
     static constexpr float_t Determinant(Vector2i a, Vector2i b) noexcept;
 
-    constexpr Vector2i() = default;
+    constexpr VectorT() = default;
 
     /// @brief Constructs a Vector2i with both its components set to 'xy'.
-    constexpr explicit Vector2i(int32_t xy);
+    constexpr explicit VectorT(int32_t xy);
 
     /// @brief Constructs a Vector2i with its components set to the data point32_ted by @c data.
     ///
     /// This constructor assumes that @c data is a valid pointer pointing to at least 2 @c int32_t values.
     ///
     /// @param data The data where the values for this vector's components are located.
-    constexpr explicit Vector2i(const int32_t* data) noexcept;
+    constexpr explicit VectorT(const int32_t* data) noexcept;
 
     /// @brief Constructs a Vector2i with set component values.
     ///
     /// @param x The value to set this vector's x component to.
     /// @param y The value to set this vector's y component to.
-    constexpr Vector2i(int32_t x, int32_t y);
+    constexpr VectorT(int32_t x, int32_t y);
 
     /// @brief 	Gets a pointer to the first component of this vector.
     /// @returns A pointer to the first component of this vector.
@@ -117,6 +117,16 @@ struct MATH_TOOLBOX Vector2i
     [[nodiscard]]
     constexpr int32_t& operator[](size_t i);
 
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr int32_t UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr int32_t& UncheckedAt(size_t i) noexcept;
+
     /// @brief Converts this Vector2i to a Vector2.
     operator Vector2() const;
 
@@ -133,11 +143,11 @@ static_assert(std::is_move_constructible_v<Vector2i>, "Class Vector2i must be mo
 static_assert(std::is_copy_assignable_v<Vector2i>, "Class Vector2i must be copy assignable.");
 static_assert(std::is_move_assignable_v<Vector2i>, "Class Vector2i must be move assignable.");
 
-constexpr Vector2i::Vector2i(const int32_t xy): x(xy), y(xy) {}
+constexpr Vector2i::VectorT(const int32_t xy): x(xy), y(xy) {}
 
-constexpr Vector2i::Vector2i(const int32_t* const data) noexcept : x(data[0]), y(data[1]) {}
+constexpr Vector2i::VectorT(const int32_t* const data) noexcept : x(data[0]), y(data[1]) {}
 
-constexpr Vector2i::Vector2i(const int32_t x, const int32_t y): x(x), y(y) {}
+constexpr Vector2i::VectorT(const int32_t x, const int32_t y): x(x), y(y) {}
 
 constexpr Vector2i Vector2i::Zero() noexcept { return Vector2i(); }
 
@@ -164,7 +174,7 @@ constexpr int32_t Vector2i::operator[](const size_t i) const
     if (i < 2) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Vector2i subscript out of range");
+        MATH_THROW(std::out_of_range("Vector2i subscript out of range"));
 }
 
 constexpr int32_t& Vector2i::operator[](const size_t i)
@@ -172,9 +182,13 @@ constexpr int32_t& Vector2i::operator[](const size_t i)
     if (i < 2) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Vector2i subscript out of range");
+        MATH_THROW(std::out_of_range("Vector2i subscript out of range"));
 }
 
+constexpr int32_t Vector2i::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr int32_t& Vector2i::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
 /// @brief Adds two Vector2i together.
 [[nodiscard]]
 constexpr Vector2i operator+(const Vector2i a, const Vector2i b) noexcept { return Vector2i(a.x + b.x, a.y + b.y); }
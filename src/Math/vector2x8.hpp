@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+#include "Math/calc.hpp"
+#include "Math/floatx8.hpp"
+#include "Math/simd.hpp"
+#include "Math/vector2.hpp"
+
+/// @file vector2x8.hpp
+/// @brief Defines the Vector2x8 struct.
+
+/// @brief The Vector2x8 struct represents 8 @ref Vector2 "Vector2s" processed together, one per lane.
+///
+/// Its components are stored as one Floatx8 each, e.g. as 2 AVX registers when @c MATH_SIMD_AVX is defined,
+/// so that the usual Vector2 operations apply to the 8 vectors at once. Use Load and Store to convert from and to arrays of @ref Vector2 "Vector2s".
+struct Vector2x8
+{
+    /// @brief The @c x components of the 8 vectors.
+    Floatx8 x;
+
+    /// @brief The @c y components of the 8 vectors.
+    Floatx8 y;
+
+    /// @brief Loads the 8 @ref Vector2 "Vector2s" pointed by @p vectors.
+    [[nodiscard]]
+    static Vector2x8 Load(const Vector2* vectors) noexcept;
+
+    /// @brief Loads up to 8 @ref Vector2 "Vector2s" from @p vectors, the lanes past its end being set to zero.
+    [[nodiscard]]
+    static Vector2x8 Load(std::span<const Vector2> vectors) noexcept;
+
+    /// @brief Returns a · b, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Dot(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+    /// @brief Returns a x b, lane by lane.
+    ///
+    /// For a Vector2, this is simply the determinant.
+    [[nodiscard]]
+    static Floatx8 Cross(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+    /// @brief Returns, for each lane, the vector of @p ifTrue if the lane of @p mask is set, or the vector of @p ifFalse otherwise.
+    [[nodiscard]]
+    static Vector2x8 Select(const Maskx8& mask, const Vector2x8& ifTrue, const Vector2x8& ifFalse) noexcept;
+
+    /// @brief Constructs a Vector2x8 with all its components set to 0.
+    Vector2x8() = default;
+
+    /// @brief Constructs a Vector2x8 with all its lanes set to @p v.
+    Vector2x8(const Vector2& v) noexcept;
+
+    /// @brief Constructs a Vector2x8 from the components of its 8 vectors.
+    Vector2x8(const Floatx8& x, const Floatx8& y) noexcept;
+
+    /// @brief Stores the 8 vectors of this Vector2x8 to @p vectors.
+    void Store(Vector2* vectors) const noexcept;
+
+    /// @brief Stores up to 8 vectors of this Vector2x8 to @p vectors, e.g. as many as @p vectors can hold.
+    void Store(std::span<Vector2> vectors) const noexcept;
+
+    /// @brief Returns the lengths of the 8 vectors.
+    [[nodiscard]]
+    Floatx8 Length() const noexcept;
+
+    /// @brief Returns the squared lengths of the 8 vectors.
+    [[nodiscard]]
+    Floatx8 SquaredLength() const noexcept;
+
+    /// @brief Returns the 8 vectors normalized, vectors with a length of zero staying zero.
+    [[nodiscard]]
+    Vector2x8 Normalized() const noexcept;
+
+    /// @brief Returns the 8 vectors normalized using @ref Floatx8::Rsqrt, vectors with a length of zero staying zero.
+    [[nodiscard]]
+    Vector2x8 Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Retrieves the vector of the lane at index @p lane.
+    [[nodiscard]]
+    Vector2 operator[](size_t lane) const;
+};
+
+/// @brief Returns the opposite of a Vector2x8.
+[[nodiscard]]
+inline Vector2x8 operator-(const Vector2x8& v) noexcept;
+
+/// @brief Adds two @ref Vector2x8 "Vector2x8s" lane by lane.
+[[nodiscard]]
+inline Vector2x8 operator+(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Subtracts two @ref Vector2x8 "Vector2x8s" lane by lane.
+[[nodiscard]]
+inline Vector2x8 operator-(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Multiplies two @ref Vector2x8 "Vector2x8s" component-wise, lane by lane.
+[[nodiscard]]
+inline Vector2x8 operator*(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Multiplies each vector of a Vector2x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector2x8 operator*(const Vector2x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Multiplies each vector of a Vector2x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector2x8 operator*(const Floatx8& factor, const Vector2x8& v) noexcept;
+
+/// @brief Divides two @ref Vector2x8 "Vector2x8s" component-wise, lane by lane.
+[[nodiscard]]
+inline Vector2x8 operator/(const Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Divides each vector of a Vector2x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector2x8 operator/(const Vector2x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Adds two @ref Vector2x8 "Vector2x8s" according to @ref operator+(const Vector2x8&, const Vector2x8&), placing the result in @p a.
+inline Vector2x8& operator+=(Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Subtracts two @ref Vector2x8 "Vector2x8s" according to @ref operator-(const Vector2x8&, const Vector2x8&), placing the result in @p a.
+inline Vector2x8& operator-=(Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Multiplies two @ref Vector2x8 "Vector2x8s" according to @ref operator*(const Vector2x8&, const Vector2x8&), placing the result in @p a.
+inline Vector2x8& operator*=(Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Multiplies a Vector2x8 by a @p factor according to @ref operator*(const Vector2x8&, const Floatx8&), placing the result in @p v.
+inline Vector2x8& operator*=(Vector2x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Divides two @ref Vector2x8 "Vector2x8s" according to @ref operator/(const Vector2x8&, const Vector2x8&), placing the result in @p a.
+inline Vector2x8& operator/=(Vector2x8& a, const Vector2x8& b) noexcept;
+
+/// @brief Divides a Vector2x8 by a @p factor according to @ref operator/(const Vector2x8&, const Floatx8&), placing the result in @p v.
+inline Vector2x8& operator/=(Vector2x8& v, const Floatx8& factor) noexcept;
+
+namespace Calc
+{
+    /// @brief Clamps each component of each vector of @p vector between the matching components of @p min and @p max.
+    [[nodiscard]]
+    inline Vector2x8 Clamp(const Vector2x8& vector, const Vector2x8& min, const Vector2x8& max) noexcept;
+
+    /// @brief Linearly interpolates between @p value and @p target, lane by lane.
+    [[nodiscard]]
+    inline Vector2x8 Lerp(const Vector2x8& value, const Vector2x8& target, const Floatx8& time) noexcept;
+}
+
+inline Vector2x8 Vector2x8::Load(const Vector2* const vectors) noexcept
+{
+    static_assert(sizeof(Vector2) == 2 * sizeof(float_t), "Vector2x8::Load expects Vector2 to be 2 packed float_t values");
+
+#ifdef MATH_SIMD_AVX
+    // Swap the middle halves so that each 128-bit lane holds 4 consecutive vectors, then deinterleave the components
+    const __m256 a = _mm256_loadu_ps(vectors[0].Data());
+    const __m256 b = _mm256_loadu_ps(vectors[4].Data());
+    const __m256 low = _mm256_permute2f128_ps(a, b, 0x20);
+    const __m256 high = _mm256_permute2f128_ps(a, b, 0x31);
+
+    return Vector2x8(Floatx8(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))), Floatx8(_mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1))));
+#elif defined(MATH_SIMD_SSE)
+    Vector2x8 result;
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        const __m128 low = _mm_loadu_ps(vectors[i].Data());
+        const __m128 high = _mm_loadu_ps(vectors[i + 2].Data());
+
+        _mm_storeu_ps(result.x.value + i, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(result.y.value + i, _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    return result;
+#else
+    Vector2x8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+    {
+        result.x.value[i] = vectors[i].x;
+        result.y.value[i] = vectors[i].y;
+    }
+    return result;
+#endif
+}
+
+inline Vector2x8 Vector2x8::Load(const std::span<const Vector2> vectors) noexcept
+{
+    if (vectors.size() >= Floatx8::Size)
+        return Load(vectors.data());
+
+    Vector2 padded[Floatx8::Size];
+    std::ranges::copy(vectors, padded);
+    return Load(padded);
+}
+
+inline Floatx8 Vector2x8::Dot(const Vector2x8& a, const Vector2x8& b) noexcept
+{
+    return Floatx8::MultiplyAdd(a.y, b.y, a.x * b.x);
+}
+
+inline Floatx8 Vector2x8::Cross(const Vector2x8& a, const Vector2x8& b) noexcept { return a.x * b.y - a.y * b.x; }
+
+inline Vector2x8 Vector2x8::Select(const Maskx8& mask, const Vector2x8& ifTrue, const Vector2x8& ifFalse) noexcept
+{
+    return Vector2x8(Floatx8::Select(mask, ifTrue.x, ifFalse.x), Floatx8::Select(mask, ifTrue.y, ifFalse.y));
+}
+
+inline Vector2x8::Vector2x8(const Vector2& v) noexcept : x(v.x), y(v.y) {}
+
+inline Vector2x8::Vector2x8(const Floatx8& x, const Floatx8& y) noexcept : x(x), y(y) {}
+
+inline void Vector2x8::Store(Vector2* const vectors) const noexcept
+{
+#ifdef MATH_SIMD_AVX
+    // Interleave the components, then swap the middle halves back
+    const __m256 low = _mm256_unpacklo_ps(x.value, y.value);
+    const __m256 high = _mm256_unpackhi_ps(x.value, y.value);
+
+    _mm256_storeu_ps(vectors[0].Data(), _mm256_permute2f128_ps(low, high, 0x20));
+    _mm256_storeu_ps(vectors[4].Data(), _mm256_permute2f128_ps(low, high, 0x31));
+#elif defined(MATH_SIMD_SSE)
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        const __m128 vx = _mm_loadu_ps(x.value + i);
+        const __m128 vy = _mm_loadu_ps(y.value + i);
+
+        _mm_storeu_ps(vectors[i].Data(), _mm_unpacklo_ps(vx, vy));
+        _mm_storeu_ps(vectors[i + 2].Data(), _mm_unpackhi_ps(vx, vy));
+    }
+#else
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        vectors[i] = Vector2(x.value[i], y.value[i]);
+#endif
+}
+
+inline void Vector2x8::Store(const std::span<Vector2> vectors) const noexcept
+{
+    if (vectors.size() >= Floatx8::Size)
+    {
+        Store(vectors.data());
+        return;
+    }
+
+    Vector2 padded[Floatx8::Size];
+    Store(padded);
+    std::copy_n(padded, vectors.size(), vectors.begin());
+}
+
+inline Floatx8 Vector2x8::Length() const noexcept { return Floatx8::Sqrt(SquaredLength()); }
+
+inline Floatx8 Vector2x8::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+inline Vector2x8 Vector2x8::Normalized() const noexcept
+{
+    const Floatx8 length = Length();
+    return Select(length > Calc::Zero, *this / length, Vector2x8());
+}
+
+inline Vector2x8 Vector2x8::Normalized(Calc::FastMathTag) const noexcept
+{
+    const Floatx8 squaredLength = SquaredLength();
+    return Select(squaredLength > SQ(Calc::Zero), *this * Floatx8::Rsqrt(squaredLength), Vector2x8());
+}
+
+inline Vector2 Vector2x8::operator[](const size_t lane) const
+{
+    if (lane >= Floatx8::Size) [[unlikely]]
+        MATH_THROW(std::out_of_range("Vector2x8 subscript out of range"));
+
+    return Vector2(x[lane], y[lane]);
+}
+
+inline Vector2x8 operator-(const Vector2x8& v) noexcept { return Vector2x8(-v.x, -v.y); }
+
+inline Vector2x8 operator+(const Vector2x8& a, const Vector2x8& b) noexcept { return Vector2x8(a.x + b.x, a.y + b.y); }
+
+inline Vector2x8 operator-(const Vector2x8& a, const Vector2x8& b) noexcept { return Vector2x8(a.x - b.x, a.y - b.y); }
+
+inline Vector2x8 operator*(const Vector2x8& a, const Vector2x8& b) noexcept { return Vector2x8(a.x * b.x, a.y * b.y); }
+
+inline Vector2x8 operator*(const Vector2x8& v, const Floatx8& factor) noexcept { return Vector2x8(v.x * factor, v.y * factor); }
+
+inline Vector2x8 operator*(const Floatx8& factor, const Vector2x8& v) noexcept { return v * factor; }
+
+inline Vector2x8 operator/(const Vector2x8& a, const Vector2x8& b) noexcept { return Vector2x8(a.x / b.x, a.y / b.y); }
+
+inline Vector2x8 operator/(const Vector2x8& v, const Floatx8& factor) noexcept { return v * (1.f / factor); }
+
+inline Vector2x8& operator+=(Vector2x8& a, const Vector2x8& b) noexcept { return a = a + b; }
+
+inline Vector2x8& operator-=(Vector2x8& a, const Vector2x8& b) noexcept { return a = a - b; }
+
+inline Vector2x8& operator*=(Vector2x8& a, const Vector2x8& b) noexcept { return a = a * b; }
+
+inline Vector2x8& operator*=(Vector2x8& v, const Floatx8& factor) noexcept { return v = v * factor; }
+
+inline Vector2x8& operator/=(Vector2x8& a, const Vector2x8& b) noexcept { return a = a / b; }
+
+inline Vector2x8& operator/=(Vector2x8& v, const Floatx8& factor) noexcept { return v = v / factor; }
+
+inline Vector2x8 Calc::Clamp(const Vector2x8& vector, const Vector2x8& min, const Vector2x8& max) noexcept
+{
+    return Vector2x8(Clamp(vector.x, min.x, max.x), Clamp(vector.y, min.y, max.y));
+}
+
+inline Vector2x8 Calc::Lerp(const Vector2x8& value, const Vector2x8& target, const Floatx8& time) noexcept
+{
+    return Vector2x8(Lerp(value.x, target.x, time), Lerp(value.y, target.y, time));
+}
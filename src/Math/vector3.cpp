@@ -2,72 +2,79 @@
 
 #include <cassert>
 #include <format>
+#include <stdexcept>
 
 #include "Math/calc.hpp"
+#include "Math/dispatch.hpp"
 #include "Math/matrix.hpp"
 #include "Math/vector2.hpp"
 #include "Math/vector4.hpp"
 
-float_t Vector3::Length() const noexcept
+MATH_INLINE Vector3::operator Vector4() const noexcept
 {
-	return std::sqrt(SquaredLength());
+    return Vector4(x, y, z, 1.f);
 }
 
-Vector3::operator Vector4() const noexcept
+MATH_INLINE Vector3 Vector3::Normalized(Calc::FastMathTag) const noexcept
 {
-    return Vector4(x, y, z, 1.f);
+	const float_t squaredLength = SquaredLength();
+	if (squaredLength <= SQ(Calc::Zero))
+		return Zero();
+
+	return *this * Calc::FastRsqrt(squaredLength);
 }
 
-Vector3 Vector3::Normalized() const noexcept
+MATH_INLINE void Vector3::Normalized(Vector3* result, const Calc::FastMathTag tag) const noexcept
 {
-	const float_t length = Length();
-	if (Calc::IsZero(length))
-		return Zero();
+	*result = Normalized(tag);
+}
+
+MATH_INLINE void Vector3::Normalize(const std::span<const Vector3> vectors, const std::span<Vector3> results)
+{
+	static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3 must be tightly packed to be used as an array of float_t");
+
+	if (results.size() < vectors.size())
+		MATH_THROW(std::invalid_argument("The output range must be at least as large as the vector range"));
+
+	if (vectors.empty())
+		return;
 
-	__assume(length != 0.f);
-	const float_t invLength = 1.f / length;
-	return Vector3(x * invLength, y * invLength, z * invLength);
+	Dispatch::GetKernels().normalizeVectors3(vectors.front().Data(), results.front().Data(), vectors.size());
 }
 
-void Vector3::Normalized(Vector3* result) const noexcept
+MATH_INLINE void Vector3::NormalizeInPlace(const std::span<Vector3> vectors) noexcept
 {
-	const float_t length = Length();
-	if (Calc::IsZero(length))
-	{
-		*result = Zero();
+	if (vectors.empty())
 		return;
-	}
 
-	__assume(length != 0.f);
-	const float_t invLength = 1.f / length;
-	*result = Vector3(x * invLength, y * invLength, z * invLength);
+	Dispatch::GetKernels().normalizeVectors3(vectors.front().Data(), vectors.front().Data(), vectors.size());
 }
 
-bool Vector3::IsInfinity() const noexcept
+MATH_INLINE bool Vector3::IsInfinity() const noexcept
 {
 	return std::isinf(x)
 		&& std::isinf(y)
 		&& std::isinf(z);
 }
 
-bool Vector3::IsNaN() const noexcept
+MATH_INLINE bool Vector3::IsNaN() const noexcept
 {
 	return std::isnan(x)
 		&& std::isnan(y)
 		&& std::isnan(z);
 }
 
-Vector3::operator Vector2() const noexcept
+MATH_INLINE Vector3::operator Vector2() const noexcept
 {
 	return Vector2(x, y);
 }
 
-Vector3 Vector3::Rescaled(float_t newLength) noexcept
+MATH_INLINE Vector3 Vector3::Rescaled(float_t newLength) noexcept
 {
     return *this * newLength / Length();
 }
 
-std::ostream& operator<<(std::ostream& out, const Vector3& v) noexcept
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Vector3& v) noexcept
 {
 	return out << std::format("{{{:.3f} {:.3f} {:.3f}}}", v.x, v.y, v.z);
 }
@@ -4,17 +4,30 @@
 #include <sstream>
 
 #include <ostream>
+#include <span>
 
 #include "Math/vector2.hpp"
 
 /// @file vector3.hpp
 /// @brief Defines the Vector3 struct.
 
-struct Vector4;
-struct Matrix;
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT;
+using Matrix = MatrixT<4, 4, float_t>;
+
+namespace Calc
+{
+    struct FastMathTag;
+
+    MATH_TOOLBOX constexpr float_t Sqrt(float_t x) noexcept;
+    MATH_TOOLBOX constexpr bool_t IsZero(float_t value) noexcept;
+}
 
 /// @brief The Vector3 struct represents either a three-dimensional vector or a point.
-struct MATH_TOOLBOX Vector3
+///
+/// This is the three-dimensional float specialization of VectorT, which provides the other dimensions and value types.
+template <>
+struct MATH_TOOLBOX VectorT<3, float_t>
 {
     /// @brief The @c x component of this Vector3.
     float_t x = 0.f;
@@ -81,26 +94,26 @@ struct MATH_TOOLBOX Vector3
     constexpr static Vector3 Combine(const Vector3& a, const Vector3& b, float_t aScale, float_t bScale) noexcept;
 
 	/// @brief Constructs a Vector3 with both its components set to 0.
-	constexpr Vector3() = default;
+	constexpr VectorT() = default;
 
 	/// @brief Constructs a Vector3 with both its components set to @p xyz.
 	///
 	/// @param xyz The value to set this vector's x, y and z components to.
-	constexpr explicit Vector3(float_t xyz) noexcept;
+	constexpr explicit VectorT(float_t xyz) noexcept;
 
 	/// @brief Constructs a Vector2 with its components set to the data pointed by @p data.
 	///
 	/// This constructor assumes that @p data is a valid pointer pointing to at least 2 @c float_t values.
 	///
 	/// @param data The data where the values for this vector's components are located.
-	constexpr explicit Vector3(const float_t* data) noexcept;
+	constexpr explicit VectorT(const float_t* data) noexcept;
 
 	/// @brief Constructs a Vector3 with set component values.
 	///
 	/// @param x The value to set this vector's x components to.
 	/// @param y The value to set this vector's y components to.
 	/// @param z The value to set this vector's z components to.
-	constexpr Vector3(float_t x, float_t y, float_t z) noexcept;
+	constexpr VectorT(float_t x, float_t y, float_t z) noexcept;
 
 	/// @brief Gets a pointer to the first component of this vector.
 	///
@@ -116,7 +129,7 @@ struct MATH_TOOLBOX Vector3
 
 	/// @brief Returns the length of the vector.
 	[[nodiscard]]
-	float_t Length() const noexcept;
+	constexpr float_t Length() const noexcept;
 
     /// @brief Creates a rescaled version of this Vector3.
     ///
@@ -134,12 +147,38 @@ struct MATH_TOOLBOX Vector3
 	///
 	/// @returns A vector with the same direction but a length of one.
 	[[nodiscard]]
-	Vector3 Normalized() const noexcept;
+	constexpr Vector3 Normalized() const noexcept;
 
 	/// @brief Returns a normalized vector.
 	///
 	/// @param result A vector to store the result which is one with the same direction but a length of one.
-	void Normalized(Vector3* result) const noexcept;
+	constexpr void Normalized(Vector3* result) const noexcept;
+
+	/// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+	///
+	/// @returns A vector with the same direction but a length of one.
+	[[nodiscard]]
+	Vector3 Normalized(Calc::FastMathTag) const noexcept;
+
+	/// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+	///
+	/// @param result A vector to store the result which is one with the same direction but a length of one.
+	void Normalized(Vector3* result, Calc::FastMathTag) const noexcept;
+
+	/// @brief Normalizes each of the given vectors, vectors with a length of zero staying zero.
+	///
+	/// The vectors are normalized several at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+	/// They are multiplied by an approximate inverse square root refined with a Newton-Raphson step,
+	/// so the results can differ from Normalized() in the last bits.
+	///
+	/// @param vectors The vectors to normalize.
+	/// @param results The output of the function. May be @p vectors.
+	///
+	/// @throws std::invalid_argument If @p results is smaller than @p vectors.
+	static void Normalize(std::span<const Vector3> vectors, std::span<Vector3> results);
+
+	/// @brief Normalizes each of the given vectors in place, like @ref Normalize(std::span<const Vector3>, std::span<Vector3>).
+	static void NormalizeInPlace(std::span<Vector3> vectors) noexcept;
 
 	/// @brief Check whether all of this vector's components are infinite.
 	[[nodiscard]]
@@ -165,6 +204,16 @@ struct MATH_TOOLBOX Vector3
 	[[nodiscard]]
 	constexpr float_t& operator[](size_t i);
 
+	/// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+	///
+	/// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+	[[nodiscard]]
+	constexpr float_t UncheckedAt(size_t i) const noexcept;
+
+	/// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+	[[nodiscard]]
+	constexpr float_t& UncheckedAt(size_t i) noexcept;
+
     /// @brief Converts this Vector3 to a Vector2.
     explicit operator Vector2() const noexcept;
 
@@ -178,11 +227,11 @@ static_assert(std::is_move_constructible_v<Vector3>, "Class Vector3 must be move
 static_assert(std::is_copy_assignable_v<Vector3>, "Class Vector3 must be copy assignable.");
 static_assert(std::is_move_assignable_v<Vector3>, "Class Vector3 must be move assignable.");
 
-constexpr Vector3::Vector3(const float_t xyz) noexcept : x(xyz), y(xyz), z(xyz) {}
+constexpr Vector3::VectorT(const float_t xyz) noexcept : x(xyz), y(xyz), z(xyz) {}
 
-constexpr Vector3::Vector3(const float_t* const data) noexcept : x(data[0]), y(data[1]), z(data[2]) {}
+constexpr Vector3::VectorT(const float_t* const data) noexcept : x(data[0]), y(data[1]), z(data[2]) {}
 
-constexpr Vector3::Vector3(const float_t x, const float_t y, const float_t z) noexcept : x(x), y(y), z(z) {}
+constexpr Vector3::VectorT(const float_t x, const float_t y, const float_t z) noexcept : x(x), y(y), z(z) {}
 
 constexpr Vector3 Vector3::Zero() noexcept { return Vector3(); }
 
@@ -214,14 +263,31 @@ constexpr const float_t* Vector3::Data() const noexcept { return &x; }
 
 constexpr float_t* Vector3::Data() noexcept { return &x; }
 
+constexpr float_t Vector3::Length() const noexcept { return Calc::Sqrt(SquaredLength()); }
+
 constexpr float_t Vector3::SquaredLength() const noexcept { return SQ(x) + SQ(y) + SQ(z); }
 
+constexpr Vector3 Vector3::Normalized() const noexcept
+{
+	const float_t length = Length();
+	if (Calc::IsZero(length))
+		return Zero();
+
+	const float_t invLength = 1.f / length;
+	return Vector3(x * invLength, y * invLength, z * invLength);
+}
+
+constexpr void Vector3::Normalized(Vector3* result) const noexcept
+{
+	*result = Normalized();
+}
+
 constexpr float_t Vector3::operator[](const size_t i) const
 {
 	if (i < 3) [[likely]]
 		return *(Data() + i);
 	[[unlikely]]
-	throw std::out_of_range("Vector3 subscript out of range");
+	MATH_THROW(std::out_of_range("Vector3 subscript out of range"));
 }
 
 constexpr float_t& Vector3::operator[](const size_t i)
@@ -229,9 +295,13 @@ constexpr float_t& Vector3::operator[](const size_t i)
 	if (i < 3) [[likely]]
 		return *(Data() + i);
 	[[unlikely]]
-	throw std::out_of_range("Vector3 subscript out of range");
+	MATH_THROW(std::out_of_range("Vector3 subscript out of range"));
 }
 
+constexpr float_t Vector3::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr float_t& Vector3::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
 /// @brief Adds two Vector3 together.
 [[nodiscard]]
 constexpr Vector3 operator+(const Vector3& a, const Vector3& b) noexcept { return Vector3(a.x + b.x, a.y + b.y, a.z + b.z); }
@@ -0,0 +1,86 @@
+#include "Math/vector3a.hpp"
+
+#include <format>
+
+#include "Math/calc.hpp"
+
+MATH_INLINE float_t Vector3A::Length() const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    const __m128 v = Simd::Load(*this);
+    return _mm_cvtss_f32(_mm_sqrt_ss(Simd::Dot3(v, v)));
+#else
+    return std::sqrt(SquaredLength());
+#endif
+}
+
+MATH_INLINE Vector3A Vector3A::Rescaled(const float_t newLength) const noexcept
+{
+    return *this * (newLength / Length());
+}
+
+MATH_INLINE Vector3A Vector3A::Normalized() const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    const __m128 v = Simd::Load(*this);
+    const __m128 length = _mm_sqrt_ps(Simd::Dot3(v, v));
+    if (Calc::IsZero(_mm_cvtss_f32(length)))
+        return Zero();
+
+    return Simd::Store<Vector3A>(_mm_div_ps(v, length));
+#else
+    const float_t length = Length();
+    if (Calc::IsZero(length))
+        return Zero();
+
+    const float_t invLength = 1.f / length;
+    return Vector3A(x * invLength, y * invLength, z * invLength);
+#endif
+}
+
+MATH_INLINE void Vector3A::Normalized(Vector3A* result) const noexcept
+{
+    *result = Normalized();
+}
+
+MATH_INLINE Vector3A Vector3A::Normalized(Calc::FastMathTag) const noexcept
+{
+#ifdef MATH_SIMD_SSE
+    const __m128 v = Simd::Load(*this);
+    const __m128 squaredLength = Simd::Dot3(v, v);
+    if (_mm_cvtss_f32(squaredLength) <= SQ(Calc::Zero))
+        return Zero();
+
+    return Simd::Store<Vector3A>(_mm_mul_ps(v, Simd::Rsqrt(squaredLength)));
+#else
+    const float_t squaredLength = SquaredLength();
+    if (squaredLength <= SQ(Calc::Zero))
+        return Zero();
+
+    return *this * Calc::FastRsqrt(squaredLength);
+#endif
+}
+
+MATH_INLINE void Vector3A::Normalized(Vector3A* result, const Calc::FastMathTag tag) const noexcept
+{
+    *result = Normalized(tag);
+}
+
+MATH_INLINE bool_t Vector3A::IsInfinity() const noexcept
+{
+    return std::isinf(x)
+        && std::isinf(y)
+        && std::isinf(z);
+}
+
+MATH_INLINE bool_t Vector3A::IsNaN() const noexcept
+{
+    return std::isnan(x)
+        && std::isnan(y)
+        && std::isnan(z);
+}
+
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Vector3A& v) noexcept
+{
+    return out << std::format("{{{:.3f} {:.3f} {:.3f}}}", v.x, v.y, v.z);
+}
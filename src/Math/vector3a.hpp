@@ -0,0 +1,429 @@
+#pragma once
+
+#include <format>
+#include <sstream>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/simd.hpp"
+#include "Math/vector3.hpp"
+
+/// @file vector3a.hpp
+/// @brief Defines the Vector3A struct.
+
+/// @brief The Vector3A struct represents either a three-dimensional vector or a point, padded to 16 bytes and 16-byte aligned.
+///
+/// It has the same API as Vector3, but can be loaded and stored with a single aligned SIMD instruction,
+/// which makes it a better fit for large buffers processed in bulk. Its operations run on SIMD registers when @c MATH_SIMD_SSE is defined.
+/// Conversions from and to Vector3 are explicit but don't lose any information.
+struct MATH_TOOLBOX alignas(16) Vector3A
+{
+    /// @brief The @c x component of this Vector3A.
+    float_t x = 0.f;
+
+    /// @brief The @c y component of this Vector3A.
+    float_t y = 0.f;
+
+    /// @brief The @c z component of this Vector3A.
+    float_t z = 0.f;
+
+    /// @brief Equivalent to calling the default constructor.
+    [[nodiscard]]
+    static constexpr Vector3A Zero() noexcept;
+
+    /// @brief Equivalent to calling the default constructor.
+    static constexpr void Zero(Vector3A* result) noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 1, @c y @c = @c 0 and @c z @c = @c 0.
+    [[nodiscard]]
+    static constexpr Vector3A UnitX() noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 1, @c y @c = @c 0 and @c z @c = @c 0.
+    static constexpr void UnitX(Vector3A* result) noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 0, @c y @c = @c 1 and @c z @c = @c 0.
+    [[nodiscard]]
+    static constexpr Vector3A UnitY() noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 0, @c y @c = @c 1 and @c z @c = @c 0.
+    static constexpr void UnitY(Vector3A* result) noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 0, @c y @c = @c 0 and @c z @c = @c 1.
+    [[nodiscard]]
+    static constexpr Vector3A UnitZ() noexcept;
+
+    /// @brief Returns a Vector3A with @c x @c = @c 0, @c y @c = @c 0 and @c z @c = @c 1.
+    static constexpr void UnitZ(Vector3A* result) noexcept;
+
+    /// @brief Returns a Vector3A with all of its components set to @c 1.
+    [[nodiscard]]
+    static constexpr Vector3A One() noexcept;
+
+    /// @brief Returns a Vector3A with all of its components set to @c 1.
+    static constexpr void One(Vector3A* result) noexcept;
+
+    /// @brief Returns a · b.
+    [[nodiscard]]
+    static constexpr float_t Dot(const Vector3A& a, const Vector3A& b) noexcept;
+
+    /// @brief Returns a x b.
+    [[nodiscard]]
+    static constexpr Vector3A Cross(const Vector3A& a, const Vector3A& b) noexcept;
+
+    /// @brief Returns a x b.
+    static constexpr void Cross(const Vector3A& a, const Vector3A& b, Vector3A* result) noexcept;
+
+    /// @brief Combines two vectors using the given scales, e.g. computes @code a * aScale + b * bScale@endcode.
+    [[nodiscard]]
+    static constexpr Vector3A Combine(const Vector3A& a, const Vector3A& b, float_t aScale, float_t bScale) noexcept;
+
+    /// @brief Constructs a Vector3A with everything set to @c 0.
+    constexpr Vector3A() = default;
+
+    /// @brief Constructs a Vector3A with all its components set to @p xyz.
+    constexpr explicit Vector3A(float_t xyz) noexcept;
+
+    /// @brief Constructs a Vector3A with its components set to the data pointed by @p data.
+    ///
+    /// This constructor assumes that @p data is a valid pointer pointing to at least 3 @c float_t values.
+    ///
+    /// @param data The data where the values for this vector's components are located.
+    constexpr explicit Vector3A(const float_t* data) noexcept;
+
+    /// @brief Constructs a Vector3A with set component values.
+    ///
+    /// @param x The value to set this vector's x components to.
+    /// @param y The value to set this vector's y components to.
+    /// @param z The value to set this vector's z components to.
+    constexpr Vector3A(float_t x, float_t y, float_t z) noexcept;
+
+    /// @brief Constructs a Vector3A with the same components as @p v.
+    constexpr explicit Vector3A(const Vector3& v) noexcept;
+
+    /// @brief Gets a pointer to the first component of this vector.
+    ///
+    /// @returns A pointer to the first component of this vector.
+    [[nodiscard]]
+    constexpr const float_t* Data() const noexcept;
+
+    /// @brief Gets a pointer to the first component of this vector.
+    ///
+    /// @returns A pointer to the first component of this vector.
+    [[nodiscard]]
+    constexpr float_t* Data() noexcept;
+
+    /// @brief Returns the length of the vector.
+    [[nodiscard]]
+    float_t Length() const noexcept;
+
+    /// @brief Returns a vector with the same direction as this one but with a length of @p newLength.
+    [[nodiscard]]
+    Vector3A Rescaled(float_t newLength) const noexcept;
+
+    /// @brief Returns the squared length of the vector.
+    [[nodiscard]]
+    constexpr float_t SquaredLength() const noexcept;
+
+    /// @brief Returns a normalized vector.
+    ///
+    /// @returns A vector with the same direction but a length of one.
+    [[nodiscard]]
+    Vector3A Normalized() const noexcept;
+
+    /// @brief Returns a normalized vector.
+    ///
+    /// @param result A vector to store the result which is one with the same direction but a length of one.
+    void Normalized(Vector3A* result) const noexcept;
+
+    /// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+    ///
+    /// @returns A vector with the same direction but a length of one.
+    [[nodiscard]]
+    Vector3A Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+    ///
+    /// @param result A vector to store the result which is one with the same direction but a length of one.
+    void Normalized(Vector3A* result, Calc::FastMathTag) const noexcept;
+
+    /// @brief Check whether all of this vector's components are infinite.
+    [[nodiscard]]
+    bool_t IsInfinity() const noexcept;
+
+    /// @brief Check whether all of this vector's components are NaN.
+    [[nodiscard]]
+    bool_t IsNaN() const noexcept;
+
+    /// @brief Retrieves this vector's component at index i.
+    ///
+    /// @param i The index of the component to get. It would be 0 for x, 1 for y, etc...
+    ///
+    /// @returns The value of the component at index i.
+    [[nodiscard]]
+    constexpr float_t operator[](size_t i) const;
+
+    /// @brief Retrieves this vector's component at index i.
+    ///
+    /// @param i The index of the component to get. It would be 0 for x, 1 for y, etc...
+    ///
+    /// @returns The value of the component at index i.
+    [[nodiscard]]
+    constexpr float_t& operator[](size_t i);
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t i) noexcept;
+
+    /// @brief Converts this Vector3A to a Vector3.
+    constexpr explicit operator Vector3() const noexcept;
+
+private:
+    /// @brief Pads this struct to 16 bytes. Its value is unspecified and ignored by every operation.
+    float_t m_Padding = 0.f;
+};
+
+static_assert(std::is_default_constructible_v<Vector3A>, "Class Vector3A must be default constructible.");
+static_assert(std::is_copy_constructible_v<Vector3A>, "Class Vector3A must be copy constructible.");
+static_assert(std::is_move_constructible_v<Vector3A>, "Class Vector3A must be move constructible.");
+static_assert(std::is_copy_assignable_v<Vector3A>, "Class Vector3A must be copy assignable.");
+static_assert(std::is_move_assignable_v<Vector3A>, "Class Vector3A must be move assignable.");
+static_assert(sizeof(Vector3A) == 16 && alignof(Vector3A) == 16, "Class Vector3A must be 16 bytes large and 16-byte aligned.");
+
+constexpr Vector3A::Vector3A(const float_t xyz) noexcept : x(xyz), y(xyz), z(xyz) {}
+
+constexpr Vector3A::Vector3A(const float_t* const data) noexcept : x(data[0]), y(data[1]), z(data[2]) {}
+
+constexpr Vector3A::Vector3A(const float_t x, const float_t y, const float_t z) noexcept : x(x), y(y), z(z) {}
+
+constexpr Vector3A::Vector3A(const Vector3& v) noexcept : x(v.x), y(v.y), z(v.z) {}
+
+constexpr Vector3A Vector3A::Zero() noexcept { return Vector3A(); }
+
+constexpr void Vector3A::Zero(Vector3A* result) noexcept { *result = Vector3A(); }
+
+constexpr Vector3A Vector3A::UnitX() noexcept { return Vector3A(1.f, 0.f, 0.f); }
+
+constexpr void Vector3A::UnitX(Vector3A* result) noexcept { *result = Vector3A(1.f, 0.f, 0.f); }
+
+constexpr Vector3A Vector3A::UnitY() noexcept { return Vector3A(0.f, 1.f, 0.f); }
+
+constexpr void Vector3A::UnitY(Vector3A* result) noexcept { *result = Vector3A(0.f, 1.f, 0.f); }
+
+constexpr Vector3A Vector3A::UnitZ() noexcept { return Vector3A(0.f, 0.f, 1.f); }
+
+constexpr void Vector3A::UnitZ(Vector3A* result) noexcept { *result = Vector3A(0.f, 0.f, 1.f); }
+
+constexpr Vector3A Vector3A::One() noexcept { return Vector3A(1.f); }
+
+constexpr void Vector3A::One(Vector3A* result) noexcept { *result = Vector3A(1.f); }
+
+constexpr float_t Vector3A::Dot(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return _mm_cvtss_f32(Simd::Dot3(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+constexpr Vector3A Vector3A::Cross(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(Simd::Cross3(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector3A(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+constexpr void Vector3A::Cross(const Vector3A& a, const Vector3A& b, Vector3A* result) noexcept { *result = Cross(a, b); }
+
+constexpr const float_t* Vector3A::Data() const noexcept { return &x; }
+
+constexpr float_t* Vector3A::Data() noexcept { return &x; }
+
+constexpr float_t Vector3A::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+constexpr float_t Vector3A::operator[](const size_t i) const
+{
+    if (i < 3) [[likely]]
+        return *(Data() + i);
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("Vector3A subscript out of range"));
+}
+
+constexpr float_t& Vector3A::operator[](const size_t i)
+{
+    if (i < 3) [[likely]]
+        return *(Data() + i);
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("Vector3A subscript out of range"));
+}
+
+constexpr float_t Vector3A::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr float_t& Vector3A::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
+constexpr Vector3A::operator Vector3() const noexcept { return Vector3(x, y, z); }
+
+/// @brief Adds two Vector3A together.
+[[nodiscard]]
+constexpr Vector3A operator+(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(_mm_add_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector3A(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+/// @brief Returns the opposite of a Vector3A.
+///
+/// This effectively means replacing all values of this Vector3A with their opposite.
+[[nodiscard]]
+constexpr Vector3A operator-(const Vector3A& a) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(Simd::Negate(Simd::Load(a)));
+#endif
+
+    return Vector3A(-a.x, -a.y, -a.z);
+}
+
+/// @brief Subtracts a Vector3A from another one.
+[[nodiscard]]
+constexpr Vector3A operator-(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(_mm_sub_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector3A(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+/// @brief Multiplies two Vector3A component-wise.
+[[nodiscard]]
+constexpr Vector3A operator*(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(_mm_mul_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector3A(a.x * b.x, a.y * b.y, a.z * b.z);
+}
+
+/// @brief Multiplies a Vector3A by a @p factor.
+[[nodiscard]]
+constexpr Vector3A operator*(const Vector3A& v, const float_t factor) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(_mm_mul_ps(Simd::Load(v), _mm_set1_ps(factor)));
+#endif
+
+    return Vector3A(v.x * factor, v.y * factor, v.z * factor);
+}
+
+/// @brief Multiplies a Vector3A by a @p factor.
+[[nodiscard]]
+constexpr Vector3A operator*(const float_t factor, const Vector3A& v) noexcept { return v * factor; }
+
+/// @brief Divides a Vector3A by another one.
+[[nodiscard]]
+constexpr Vector3A operator/(const Vector3A& a, const Vector3A& b) noexcept
+{
+#ifdef MATH_SIMD_SSE
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector3A>(_mm_div_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector3A(a.x / b.x, a.y / b.y, a.z / b.z);
+}
+
+/// @brief Divides a Vector3A by a @p factor.
+[[nodiscard]]
+constexpr Vector3A operator/(const Vector3A& v, const float_t factor) noexcept { return v * (1.f / factor); }
+
+/// @brief Adds two Vector3A according to @ref operator+(const Vector3A&, const Vector3A&), placing the result in @p a.
+constexpr Vector3A& operator+=(Vector3A& a, const Vector3A& b) noexcept { return a = a + b; }
+
+/// @brief Subtracts a Vector3A from another one according to @ref operator-(const Vector3A&, const Vector3A&), placing the result in @p a.
+constexpr Vector3A& operator-=(Vector3A& a, const Vector3A& b) noexcept { return a = a - b; }
+
+/// @brief Multiplies two Vector3A component-wise according to @ref operator*(const Vector3A&, const Vector3A&), placing the result in @p a.
+constexpr Vector3A& operator*=(Vector3A& a, const Vector3A& b) noexcept { return a = a * b; }
+
+/// @brief Multiplies a Vector3A by a @p factor according to @ref operator*(const Vector3A&, const float_t), placing the result in @p v.
+constexpr Vector3A& operator*=(Vector3A& v, const float_t factor) noexcept { return v = v * factor; }
+
+/// @brief Divides two Vector3A component-wise according to @ref operator/(const Vector3A&, const Vector3A&), placing the result in @p a.
+constexpr Vector3A& operator/=(Vector3A& a, const Vector3A& b) noexcept { return a = a / b; }
+
+/// @brief Divides a Vector3A by a @p factor according to @ref operator/(const Vector3A&, const float_t), placing the result in @p v.
+constexpr Vector3A& operator/=(Vector3A& v, const float_t factor) noexcept { return v = v / factor; }
+
+/// @brief Checks if two Vector3A are equal.
+[[nodiscard]]
+constexpr bool_t operator==(const Vector3A& a, const Vector3A& b) noexcept
+{
+    return a.x == b.x
+        && a.y == b.y
+        && a.z == b.z;
+}
+
+/// @brief Checks if two Vector3A are different.
+[[nodiscard]]
+constexpr bool_t operator!=(const Vector3A& a, const Vector3A& b) noexcept { return !(a == b); }
+
+/// @brief Streams a Vector3A into @p out, printing its values one by one on a single line.
+MATH_TOOLBOX std::ostream& operator<<(std::ostream& out, const Vector3A& v) noexcept;
+
+constexpr Vector3A Vector3A::Combine(const Vector3A& a, const Vector3A& b, const float_t aScale, const float_t bScale) noexcept { return a * aScale + b * bScale; }
+
+template <>
+struct std::formatter<Vector3A>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx);
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(Vector3A v, FmtContext& ctx) const;
+
+private:
+    std::string m_Format;
+};
+
+template <class ParseContext>
+constexpr typename ParseContext::iterator std::formatter<Vector3A, char_t>::parse(ParseContext& ctx)
+{
+    auto it = ctx.begin();
+    if (it == ctx.end())
+        return it;
+
+    while (*it != '}' && it != ctx.end())
+        m_Format += *it++;
+
+    return it;
+}
+
+template <class FmtContext>
+typename FmtContext::iterator std::formatter<Vector3A>::format(Vector3A v, FmtContext &ctx) const
+{
+    std::ostringstream out;
+
+    out << std::vformat("{:" + m_Format + "} ; {:" + m_Format + "} ; {:" + m_Format + '}', std::make_format_args(v.x, v.y, v.z));
+
+    return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+}
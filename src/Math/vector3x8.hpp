@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+#include "Math/calc.hpp"
+#include "Math/floatx8.hpp"
+#include "Math/simd.hpp"
+#include "Math/vector3.hpp"
+
+/// @file vector3x8.hpp
+/// @brief Defines the Vector3x8 struct.
+
+/// @brief The Vector3x8 struct represents 8 @ref Vector3 "Vector3s" processed together, one per lane.
+///
+/// Its components are stored as one Floatx8 each, e.g. as 3 AVX registers when @c MATH_SIMD_AVX is defined,
+/// so that the usual Vector3 operations apply to the 8 vectors at once. Use Load and Store to convert from and to arrays of @ref Vector3 "Vector3s".
+struct Vector3x8
+{
+    /// @brief The @c x components of the 8 vectors.
+    Floatx8 x;
+
+    /// @brief The @c y components of the 8 vectors.
+    Floatx8 y;
+
+    /// @brief The @c z components of the 8 vectors.
+    Floatx8 z;
+
+    /// @brief Loads the 8 @ref Vector3 "Vector3s" pointed by @p vectors.
+    [[nodiscard]]
+    static Vector3x8 Load(const Vector3* vectors) noexcept;
+
+    /// @brief Loads up to 8 @ref Vector3 "Vector3s" from @p vectors, the lanes past its end being set to zero.
+    [[nodiscard]]
+    static Vector3x8 Load(std::span<const Vector3> vectors) noexcept;
+
+    /// @brief Returns a · b, lane by lane.
+    [[nodiscard]]
+    static Floatx8 Dot(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+    /// @brief Returns a x b, lane by lane.
+    [[nodiscard]]
+    static Vector3x8 Cross(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+    /// @brief Returns, for each lane, the vector of @p ifTrue if the lane of @p mask is set, or the vector of @p ifFalse otherwise.
+    [[nodiscard]]
+    static Vector3x8 Select(const Maskx8& mask, const Vector3x8& ifTrue, const Vector3x8& ifFalse) noexcept;
+
+    /// @brief Constructs a Vector3x8 with all its components set to 0.
+    Vector3x8() = default;
+
+    /// @brief Constructs a Vector3x8 with all its lanes set to @p v.
+    Vector3x8(const Vector3& v) noexcept;
+
+    /// @brief Constructs a Vector3x8 from the components of its 8 vectors.
+    Vector3x8(const Floatx8& x, const Floatx8& y, const Floatx8& z) noexcept;
+
+    /// @brief Stores the 8 vectors of this Vector3x8 to @p vectors.
+    void Store(Vector3* vectors) const noexcept;
+
+    /// @brief Stores up to 8 vectors of this Vector3x8 to @p vectors, e.g. as many as @p vectors can hold.
+    void Store(std::span<Vector3> vectors) const noexcept;
+
+    /// @brief Returns the lengths of the 8 vectors.
+    [[nodiscard]]
+    Floatx8 Length() const noexcept;
+
+    /// @brief Returns the squared lengths of the 8 vectors.
+    [[nodiscard]]
+    Floatx8 SquaredLength() const noexcept;
+
+    /// @brief Returns the 8 vectors normalized, vectors with a length of zero staying zero.
+    [[nodiscard]]
+    Vector3x8 Normalized() const noexcept;
+
+    /// @brief Returns the 8 vectors normalized using @ref Floatx8::Rsqrt, vectors with a length of zero staying zero.
+    [[nodiscard]]
+    Vector3x8 Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Retrieves the vector of the lane at index @p lane.
+    [[nodiscard]]
+    Vector3 operator[](size_t lane) const;
+};
+
+/// @brief Returns the opposite of a Vector3x8.
+[[nodiscard]]
+inline Vector3x8 operator-(const Vector3x8& v) noexcept;
+
+/// @brief Adds two @ref Vector3x8 "Vector3x8s" lane by lane.
+[[nodiscard]]
+inline Vector3x8 operator+(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Subtracts two @ref Vector3x8 "Vector3x8s" lane by lane.
+[[nodiscard]]
+inline Vector3x8 operator-(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Multiplies two @ref Vector3x8 "Vector3x8s" component-wise, lane by lane.
+[[nodiscard]]
+inline Vector3x8 operator*(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Multiplies each vector of a Vector3x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector3x8 operator*(const Vector3x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Multiplies each vector of a Vector3x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector3x8 operator*(const Floatx8& factor, const Vector3x8& v) noexcept;
+
+/// @brief Divides two @ref Vector3x8 "Vector3x8s" component-wise, lane by lane.
+[[nodiscard]]
+inline Vector3x8 operator/(const Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Divides each vector of a Vector3x8 by the matching lane of @p factor.
+[[nodiscard]]
+inline Vector3x8 operator/(const Vector3x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Adds two @ref Vector3x8 "Vector3x8s" according to @ref operator+(const Vector3x8&, const Vector3x8&), placing the result in @p a.
+inline Vector3x8& operator+=(Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Subtracts two @ref Vector3x8 "Vector3x8s" according to @ref operator-(const Vector3x8&, const Vector3x8&), placing the result in @p a.
+inline Vector3x8& operator-=(Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Multiplies two @ref Vector3x8 "Vector3x8s" according to @ref operator*(const Vector3x8&, const Vector3x8&), placing the result in @p a.
+inline Vector3x8& operator*=(Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Multiplies a Vector3x8 by a @p factor according to @ref operator*(const Vector3x8&, const Floatx8&), placing the result in @p v.
+inline Vector3x8& operator*=(Vector3x8& v, const Floatx8& factor) noexcept;
+
+/// @brief Divides two @ref Vector3x8 "Vector3x8s" according to @ref operator/(const Vector3x8&, const Vector3x8&), placing the result in @p a.
+inline Vector3x8& operator/=(Vector3x8& a, const Vector3x8& b) noexcept;
+
+/// @brief Divides a Vector3x8 by a @p factor according to @ref operator/(const Vector3x8&, const Floatx8&), placing the result in @p v.
+inline Vector3x8& operator/=(Vector3x8& v, const Floatx8& factor) noexcept;
+
+namespace Calc
+{
+    /// @brief Clamps each component of each vector of @p vector between the matching components of @p min and @p max.
+    [[nodiscard]]
+    inline Vector3x8 Clamp(const Vector3x8& vector, const Vector3x8& min, const Vector3x8& max) noexcept;
+
+    /// @brief Linearly interpolates between @p value and @p target, lane by lane.
+    [[nodiscard]]
+    inline Vector3x8 Lerp(const Vector3x8& value, const Vector3x8& target, const Floatx8& time) noexcept;
+}
+
+inline Vector3x8 Vector3x8::Load(const Vector3* const vectors) noexcept
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float_t), "Vector3x8::Load expects Vector3 to be 3 packed float_t values");
+
+#ifdef MATH_SIMD_AVX
+    // The 24 values are loaded as 6 halves, each register holding the vectors i and i + 4 in its two 128-bit lanes,
+    // so that the in-lane shuffles below give the components of the vectors in order
+    const float_t* const data = vectors[0].Data();
+    const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data)), _mm_loadu_ps(data + 12), 1);
+    const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 4)), _mm_loadu_ps(data + 16), 1);
+    const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data + 8)), _mm_loadu_ps(data + 20), 1);
+
+    const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+    const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+    return Vector3x8(
+        Floatx8(_mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0))),
+        Floatx8(_mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0))),
+        Floatx8(_mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1)))
+    );
+#elif defined(MATH_SIMD_SSE)
+    // Same shuffles as the AVX version, on 4 vectors at a time
+    Vector3x8 result;
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        const float_t* const data = vectors[i].Data();
+        const __m128 m0 = _mm_loadu_ps(data);
+        const __m128 m1 = _mm_loadu_ps(data + 4);
+        const __m128 m2 = _mm_loadu_ps(data + 8);
+
+        const __m128 xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m128 yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1));
+
+        _mm_storeu_ps(result.x.value + i, _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0)));
+        _mm_storeu_ps(result.y.value + i, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm_storeu_ps(result.z.value + i, _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1)));
+    }
+    return result;
+#else
+    Vector3x8 result;
+    for (size_t i = 0; i < Floatx8::Size; i++)
+    {
+        result.x.value[i] = vectors[i].x;
+        result.y.value[i] = vectors[i].y;
+        result.z.value[i] = vectors[i].z;
+    }
+    return result;
+#endif
+}
+
+inline Vector3x8 Vector3x8::Load(const std::span<const Vector3> vectors) noexcept
+{
+    if (vectors.size() >= Floatx8::Size)
+        return Load(vectors.data());
+
+    Vector3 padded[Floatx8::Size];
+    std::ranges::copy(vectors, padded);
+    return Load(padded);
+}
+
+inline Floatx8 Vector3x8::Dot(const Vector3x8& a, const Vector3x8& b) noexcept
+{
+    return Floatx8::MultiplyAdd(a.z, b.z, Floatx8::MultiplyAdd(a.y, b.y, a.x * b.x));
+}
+
+inline Vector3x8 Vector3x8::Cross(const Vector3x8& a, const Vector3x8& b) noexcept
+{
+    return Vector3x8(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+inline Vector3x8 Vector3x8::Select(const Maskx8& mask, const Vector3x8& ifTrue, const Vector3x8& ifFalse) noexcept
+{
+    return Vector3x8(Floatx8::Select(mask, ifTrue.x, ifFalse.x), Floatx8::Select(mask, ifTrue.y, ifFalse.y), Floatx8::Select(mask, ifTrue.z, ifFalse.z));
+}
+
+inline Vector3x8::Vector3x8(const Vector3& v) noexcept : x(v.x), y(v.y), z(v.z) {}
+
+inline Vector3x8::Vector3x8(const Floatx8& x, const Floatx8& y, const Floatx8& z) noexcept : x(x), y(y), z(z) {}
+
+inline void Vector3x8::Store(Vector3* const vectors) const noexcept
+{
+#ifdef MATH_SIMD_AVX
+    // Inverse of the shuffles of Load
+    const __m256 xy = _mm256_shuffle_ps(x.value, y.value, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m256 yz = _mm256_shuffle_ps(y.value, z.value, _MM_SHUFFLE(3, 1, 3, 1));
+    const __m256 zx = _mm256_shuffle_ps(z.value, x.value, _MM_SHUFFLE(3, 1, 2, 0));
+
+    const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+    float_t* const data = vectors[0].Data();
+    _mm_storeu_ps(data, _mm256_castps256_ps128(m03));
+    _mm_storeu_ps(data + 4, _mm256_castps256_ps128(m14));
+    _mm_storeu_ps(data + 8, _mm256_castps256_ps128(m25));
+    _mm_storeu_ps(data + 12, _mm256_extractf128_ps(m03, 1));
+    _mm_storeu_ps(data + 16, _mm256_extractf128_ps(m14, 1));
+    _mm_storeu_ps(data + 20, _mm256_extractf128_ps(m25, 1));
+#elif defined(MATH_SIMD_SSE)
+    for (size_t i = 0; i < Floatx8::Size; i += 4)
+    {
+        const __m128 vx = _mm_loadu_ps(x.value + i);
+        const __m128 vy = _mm_loadu_ps(y.value + i);
+        const __m128 vz = _mm_loadu_ps(z.value + i);
+
+        const __m128 xy = _mm_shuffle_ps(vx, vy, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 yz = _mm_shuffle_ps(vy, vz, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 zx = _mm_shuffle_ps(vz, vx, _MM_SHUFFLE(3, 1, 2, 0));
+
+        float_t* const data = vectors[i].Data();
+        _mm_storeu_ps(data, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(data + 4, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm_storeu_ps(data + 8, _mm_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#else
+    for (size_t i = 0; i < Floatx8::Size; i++)
+        vectors[i] = Vector3(x.value[i], y.value[i], z.value[i]);
+#endif
+}
+
+inline void Vector3x8::Store(const std::span<Vector3> vectors) const noexcept
+{
+    if (vectors.size() >= Floatx8::Size)
+    {
+        Store(vectors.data());
+        return;
+    }
+
+    Vector3 padded[Floatx8::Size];
+    Store(padded);
+    std::copy_n(padded, vectors.size(), vectors.begin());
+}
+
+inline Floatx8 Vector3x8::Length() const noexcept { return Floatx8::Sqrt(SquaredLength()); }
+
+inline Floatx8 Vector3x8::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+inline Vector3x8 Vector3x8::Normalized() const noexcept
+{
+    const Floatx8 length = Length();
+    return Select(length > Calc::Zero, *this / length, Vector3x8());
+}
+
+inline Vector3x8 Vector3x8::Normalized(Calc::FastMathTag) const noexcept
+{
+    const Floatx8 squaredLength = SquaredLength();
+    return Select(squaredLength > SQ(Calc::Zero), *this * Floatx8::Rsqrt(squaredLength), Vector3x8());
+}
+
+inline Vector3 Vector3x8::operator[](const size_t lane) const
+{
+    if (lane >= Floatx8::Size) [[unlikely]]
+        MATH_THROW(std::out_of_range("Vector3x8 subscript out of range"));
+
+    return Vector3(x[lane], y[lane], z[lane]);
+}
+
+inline Vector3x8 operator-(const Vector3x8& v) noexcept { return Vector3x8(-v.x, -v.y, -v.z); }
+
+inline Vector3x8 operator+(const Vector3x8& a, const Vector3x8& b) noexcept { return Vector3x8(a.x + b.x, a.y + b.y, a.z + b.z); }
+
+inline Vector3x8 operator-(const Vector3x8& a, const Vector3x8& b) noexcept { return Vector3x8(a.x - b.x, a.y - b.y, a.z - b.z); }
+
+inline Vector3x8 operator*(const Vector3x8& a, const Vector3x8& b) noexcept { return Vector3x8(a.x * b.x, a.y * b.y, a.z * b.z); }
+
+inline Vector3x8 operator*(const Vector3x8& v, const Floatx8& factor) noexcept { return Vector3x8(v.x * factor, v.y * factor, v.z * factor); }
+
+inline Vector3x8 operator*(const Floatx8& factor, const Vector3x8& v) noexcept { return v * factor; }
+
+inline Vector3x8 operator/(const Vector3x8& a, const Vector3x8& b) noexcept { return Vector3x8(a.x / b.x, a.y / b.y, a.z / b.z); }
+
+inline Vector3x8 operator/(const Vector3x8& v, const Floatx8& factor) noexcept { return v * (1.f / factor); }
+
+inline Vector3x8& operator+=(Vector3x8& a, const Vector3x8& b) noexcept { return a = a + b; }
+
+inline Vector3x8& operator-=(Vector3x8& a, const Vector3x8& b) noexcept { return a = a - b; }
+
+inline Vector3x8& operator*=(Vector3x8& a, const Vector3x8& b) noexcept { return a = a * b; }
+
+inline Vector3x8& operator*=(Vector3x8& v, const Floatx8& factor) noexcept { return v = v * factor; }
+
+inline Vector3x8& operator/=(Vector3x8& a, const Vector3x8& b) noexcept { return a = a / b; }
+
+inline Vector3x8& operator/=(Vector3x8& v, const Floatx8& factor) noexcept { return v = v / factor; }
+
+inline Vector3x8 Calc::Clamp(const Vector3x8& vector, const Vector3x8& min, const Vector3x8& max) noexcept
+{
+    return Vector3x8(Clamp(vector.x, min.x, max.x), Clamp(vector.y, min.y, max.y), Clamp(vector.z, min.z, max.z));
+}
+
+inline Vector3x8 Calc::Lerp(const Vector3x8& value, const Vector3x8& target, const Floatx8& time) noexcept
+{
+    return Vector3x8(Lerp(value.x, target.x, time), Lerp(value.y, target.y, time), Lerp(value.z, target.z, time));
+}
@@ -1,30 +1,49 @@
 #include "Math/vector4.hpp"
 
 #include <format>
+#include <stdexcept>
 
 #include "Math/calc.hpp"
+#include "Math/dispatch.hpp"
 #include "Math/matrix.hpp"
 #include "Math/vector2.hpp"
 #include "Math/vector3.hpp"
 
-float Vector4::Length() const noexcept
+MATH_INLINE float Vector4::Length() const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	const __m128 v = Simd::Load(*this);
+	return _mm_cvtss_f32(_mm_sqrt_ss(Simd::Dot4(v, v)));
+#else
 	return std::sqrt(SquaredLength());
+#endif
 }
 
-Vector4 Vector4::Normalized() const noexcept
+MATH_INLINE Vector4 Vector4::Normalized() const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	const __m128 v = Simd::Load(*this);
+	const __m128 length = _mm_sqrt_ps(Simd::Dot4(v, v));
+	if (Calc::IsZero(_mm_cvtss_f32(length)))
+		return Zero();
+
+	return Simd::Store<Vector4>(_mm_div_ps(v, length));
+#else
 	const float length = Length();
 	if (Calc::IsZero(length))
 		return Zero();
 
-	__assume(length != 0.f);
+	MATH_ASSUME(length != 0.f);
 	const float invLength = 1.f / length;
 	return Vector4(x * invLength, y * invLength, z * invLength, w * invLength);
+#endif
 }
 
-void Vector4::Normalized(Vector4* result) const noexcept
+MATH_INLINE void Vector4::Normalized(Vector4* result) const noexcept
 {
+#ifdef MATH_SIMD_ALIGN
+	*result = Normalized();
+#else
 	const float length = Length();
 	if (Calc::IsZero(length))
 	{
@@ -32,12 +51,57 @@ void Vector4::Normalized(Vector4* result) const noexcept
 		return;
 	}
 
-	__assume(length != 0.f);
+	MATH_ASSUME(length != 0.f);
 	const float invLength = 1.f / length;
 	*result = Vector4(x * invLength, y * invLength, z * invLength, w * invLength);
+#endif
+}
+
+MATH_INLINE Vector4 Vector4::Normalized(Calc::FastMathTag) const noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+	const __m128 v = Simd::Load(*this);
+	const __m128 squaredLength = Simd::Dot4(v, v);
+	if (_mm_cvtss_f32(squaredLength) <= SQ(Calc::Zero))
+		return Zero();
+
+	return Simd::Store<Vector4>(_mm_mul_ps(v, Simd::Rsqrt(squaredLength)));
+#else
+	const float_t squaredLength = SquaredLength();
+	if (squaredLength <= SQ(Calc::Zero))
+		return Zero();
+
+	return *this * Calc::FastRsqrt(squaredLength);
+#endif
+}
+
+MATH_INLINE void Vector4::Normalized(Vector4* result, const Calc::FastMathTag tag) const noexcept
+{
+	*result = Normalized(tag);
+}
+
+MATH_INLINE void Vector4::Normalize(const std::span<const Vector4> vectors, const std::span<Vector4> results)
+{
+	static_assert(sizeof(Vector4) == 4 * sizeof(float_t), "Vector4 must be tightly packed to be used as an array of float_t");
+
+	if (results.size() < vectors.size())
+		MATH_THROW(std::invalid_argument("The output range must be at least as large as the vector range"));
+
+	if (vectors.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors4(vectors.front().Data(), results.front().Data(), vectors.size());
+}
+
+MATH_INLINE void Vector4::NormalizeInPlace(const std::span<Vector4> vectors) noexcept
+{
+	if (vectors.empty())
+		return;
+
+	Dispatch::GetKernels().normalizeVectors4(vectors.front().Data(), vectors.front().Data(), vectors.size());
 }
 
-bool Vector4::IsInfinity() const noexcept
+MATH_INLINE bool Vector4::IsInfinity() const noexcept
 {
 	return std::isinf(x)
 		&& std::isinf(y)
@@ -45,7 +109,7 @@ bool Vector4::IsInfinity() const noexcept
 		&& std::isinf(w);
 }
 
-bool Vector4::IsNaN() const noexcept
+MATH_INLINE bool Vector4::IsNaN() const noexcept
 {
 	return std::isnan(x)
 		&& std::isnan(y)
@@ -53,17 +117,17 @@ bool Vector4::IsNaN() const noexcept
 		&& std::isnan(w);
 }
 
-Vector4::operator Vector2() const noexcept
+MATH_INLINE Vector4::operator Vector2() const noexcept
 {
 	return Vector2(x, y);
 }
 
-Vector4::operator Vector3() const noexcept
+MATH_INLINE Vector4::operator Vector3() const noexcept
 {
 	return Vector3(x, y, z);
 }
 
-Vector4::operator Matrix() const noexcept
+MATH_INLINE Vector4::operator Matrix() const noexcept
 {
 	return Matrix(
 		x, 0, 0, 0,
@@ -73,7 +137,7 @@ Vector4::operator Matrix() const noexcept
 	);
 }
 
-std::ostream& operator<<(std::ostream& out, const Vector4& v) noexcept
+MATH_INLINE std::ostream& operator<<(std::ostream& out, const Vector4& v) noexcept
 {
 	return out << std::format("{{{:.3f} {:.3f} {:.3f} {:.3f}}}", v.x, v.y, v.z, v.w);
 }
@@ -4,17 +4,29 @@
 #include <sstream>
 
 #include <ostream>
+#include <span>
+#include <type_traits>
 
+#include "Math/simd.hpp"
 #include "Math/vector2.hpp"
 #include "Math/vector3.hpp"
 
 /// @file vector4.hpp
 /// @brief Defines the Vector4 struct.
 
-struct Matrix;
+template <size_t Rows, size_t Cols, typename T>
+struct MatrixT;
+using Matrix = MatrixT<4, 4, float_t>;
+
+namespace Calc { struct FastMathTag; }
 
 /// @brief The Vector4 struct represents either a four-dimensional vector or a point.
-struct MATH_TOOLBOX Vector4
+///
+/// When @c MATH_SIMD_ALIGN is defined, this struct is 16-byte aligned and most of its operations run on SIMD registers.
+///
+/// This is the four-dimensional float specialization of VectorT, which provides the other dimensions and value types.
+template <>
+struct MATH_TOOLBOX MATH_SIMD_ALIGNAS VectorT<4, float_t>
 {
     /// @brief The @c x component of this Vector4.
     float_t x = 0.f;
@@ -68,17 +80,17 @@ struct MATH_TOOLBOX Vector4
     static constexpr void One(Vector4* result) noexcept;
 
     /// @brief Constructs a Vector4 with everything set to @c 0.
-    constexpr Vector4() = default;
+    constexpr VectorT() = default;
 
     /// @brief Constructs a Vector4 with all its components set to @p xyzw.
-    constexpr explicit Vector4(float_t xyzw) noexcept;
+    constexpr explicit VectorT(float_t xyzw) noexcept;
 
     /// @brief Constructs a Vector2 with its components set to the data pointed by @p data.
     ///
     /// This constructor assumes that @p data is a valid pointer pointing to at least 2 @c float_t values.
     ///
     /// @param data The data where the values for this vector's components are located.
-    constexpr explicit Vector4(const float_t* data) noexcept;
+    constexpr explicit VectorT(const float_t* data) noexcept;
 
     /// @brief Constructs a Vector3 with set component values.
     ///
@@ -86,7 +98,7 @@ struct MATH_TOOLBOX Vector4
     /// @param y The value to set this vector's y components to.
     /// @param z The value to set this vector's z components to.
     /// @param w The value to set this vector's w components to.
-    constexpr Vector4(float_t x, float_t y, float_t z, float_t w) noexcept;
+    constexpr VectorT(float_t x, float_t y, float_t z, float_t w) noexcept;
 
     /// @brief Gets a pointer to the first component of this vector.
     ///
@@ -119,6 +131,32 @@ struct MATH_TOOLBOX Vector4
     /// @param result A vector to store the result which is one with the same direction but a length of one.
     void Normalized(Vector4* result) const noexcept;
 
+    /// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+    ///
+    /// @returns A vector with the same direction but a length of one.
+    [[nodiscard]]
+    Vector4 Normalized(Calc::FastMathTag) const noexcept;
+
+    /// @brief Returns a normalized vector, using @ref Calc::FastRsqrt.
+    ///
+    /// @param result A vector to store the result which is one with the same direction but a length of one.
+    void Normalized(Vector4* result, Calc::FastMathTag) const noexcept;
+
+    /// @brief Normalizes each of the given vectors, vectors with a length of zero staying zero.
+    ///
+    /// The vectors are normalized several at a time using the best instruction set of the CPU, see Dispatch::GetKernels.
+    /// They are multiplied by an approximate inverse square root refined with a Newton-Raphson step,
+    /// so the results can differ from Normalized() in the last bits.
+    ///
+    /// @param vectors The vectors to normalize.
+    /// @param results The output of the function. May be @p vectors.
+    ///
+    /// @throws std::invalid_argument If @p results is smaller than @p vectors.
+    static void Normalize(std::span<const Vector4> vectors, std::span<Vector4> results);
+
+    /// @brief Normalizes each of the given vectors in place, like @ref Normalize(std::span<const Vector4>, std::span<Vector4>).
+    static void NormalizeInPlace(std::span<Vector4> vectors) noexcept;
+
     /// @brief Check whether all of this vector's components are infinite.
     [[nodiscard]]
     bool_t IsInfinity() const noexcept;
@@ -147,6 +185,16 @@ struct MATH_TOOLBOX Vector4
     [[nodiscard]]
     constexpr float_t& operator[](size_t i);
 
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr float_t UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr float_t& UncheckedAt(size_t i) noexcept;
+
     /// @brief Converts this Vector4 to a Vector2.
     explicit operator Vector2() const noexcept;
 
@@ -163,11 +211,11 @@ static_assert(std::is_move_constructible_v<Vector4>, "Class Vector4 must be move
 static_assert(std::is_copy_assignable_v<Vector4>, "Class Vector4 must be copy assignable.");
 static_assert(std::is_move_assignable_v<Vector4>, "Class Vector4 must be move assignable.");
 
-constexpr Vector4::Vector4(const float_t xyzw) noexcept : x(xyzw), y(xyzw), z(xyzw), w(xyzw) {}
+constexpr Vector4::VectorT(const float_t xyzw) noexcept : x(xyzw), y(xyzw), z(xyzw), w(xyzw) {}
 
-constexpr Vector4::Vector4(const float_t* const data) noexcept : x(data[0]), y(data[1]), z(data[2]), w(data[3]) {}
+constexpr Vector4::VectorT(const float_t* const data) noexcept : x(data[0]), y(data[1]), z(data[2]), w(data[3]) {}
 
-constexpr Vector4::Vector4(const float_t x, const float_t y, const float_t z, const float_t w) noexcept : x(x), y(y), z(z), w(w) {}
+constexpr Vector4::VectorT(const float_t x, const float_t y, const float_t z, const float_t w) noexcept : x(x), y(y), z(z), w(w) {}
 
 constexpr Vector4 Vector4::Zero() noexcept { return Vector4(); }
 
@@ -197,16 +245,32 @@ constexpr const float_t* Vector4::Data() const noexcept { return &x; }
 
 constexpr float_t* Vector4::Data() noexcept { return &x; }
 
-constexpr float_t Vector4::SquaredLength() const noexcept { return SQ(x) + SQ(y) + SQ(z) + SQ(w); }
+constexpr float_t Vector4::SquaredLength() const noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return _mm_cvtss_f32(Simd::Dot4(Simd::Load(*this), Simd::Load(*this)));
+#endif
+
+    return SQ(x) + SQ(y) + SQ(z) + SQ(w);
+}
 
-constexpr float_t Vector4::Dot(const Vector4& a, const Vector4& b) noexcept {	return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+constexpr float_t Vector4::Dot(const Vector4& a, const Vector4& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return _mm_cvtss_f32(Simd::Dot4(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
 
 constexpr float_t Vector4::operator[](const size_t i) const
 {
     if (i < 4) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Vector4 subscript out of range");
+        MATH_THROW(std::out_of_range("Vector4 subscript out of range"));
 }
 
 constexpr float_t& Vector4::operator[](const size_t i)
@@ -214,30 +278,74 @@ constexpr float_t& Vector4::operator[](const size_t i)
     if (i < 4) [[likely]]
         return *(Data() + i);
     [[unlikely]]
-        throw std::out_of_range("Vector4 subscript out of range");
+        MATH_THROW(std::out_of_range("Vector4 subscript out of range"));
 }
 
+constexpr float_t Vector4::UncheckedAt(const size_t i) const noexcept { return *(Data() + i); }
+
+constexpr float_t& Vector4::UncheckedAt(const size_t i) noexcept { return *(Data() + i); }
+
 /// @brief Adds two Vector4 together.
 [[nodiscard]]
-constexpr Vector4 operator+(const Vector4& a, const Vector4& b) noexcept { return Vector4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+constexpr Vector4 operator+(const Vector4& a, const Vector4& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_add_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+}
 
 /// @brief Returns the opposite of a Vector4.
 ///
 /// This effectively means replacing all values of this Vector4 with their opposite.
 [[nodiscard]]
-constexpr Vector4 operator-(const Vector4& a) noexcept { return Vector4(-a.x, -a.y, -a.z, -a.w); }
+constexpr Vector4 operator-(const Vector4& a) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(Simd::Negate(Simd::Load(a)));
+#endif
+
+    return Vector4(-a.x, -a.y, -a.z, -a.w);
+}
 
 /// @brief Subtracts a Vector4 from another one.
 [[nodiscard]]
-constexpr Vector4 operator-(const Vector4& a, const Vector4& b) noexcept { return a + -b; }
+constexpr Vector4 operator-(const Vector4& a, const Vector4& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_sub_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return a + -b;
+}
 
 /// @brief Multiplies two Vector4 component-wise.
 [[nodiscard]]
-constexpr Vector4 operator*(const Vector4& a, const Vector4& b) noexcept { return Vector4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+constexpr Vector4 operator*(const Vector4& a, const Vector4& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_mul_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+}
 
 /// @brief Multiplies a Vector4 by a @p factor.
 [[nodiscard]]
-constexpr Vector4 operator*(const Vector4& v, const float_t factor) noexcept { return Vector4(v.x * factor, v.y * factor, v.z * factor, v.w * factor); }
+constexpr Vector4 operator*(const Vector4& v, const float_t factor) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_mul_ps(Simd::Load(v), _mm_set1_ps(factor)));
+#endif
+
+    return Vector4(v.x * factor, v.y * factor, v.z * factor, v.w * factor);
+}
 
 /// @brief Multiplies a Vector4 by a @p factor.
 [[nodiscard]]
@@ -245,11 +353,29 @@ constexpr Vector4 operator*(const float_t factor, const Vector4 v) noexcept { re
 
 /// @brief Divides a Vector4 by another one.
 [[nodiscard]]
-constexpr Vector4 operator/(const Vector4& a, const Vector4& b) noexcept { return Vector4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w); }
+constexpr Vector4 operator/(const Vector4& a, const Vector4& b) noexcept
+{
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_div_ps(Simd::Load(a), Simd::Load(b)));
+#endif
+
+    return Vector4(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+}
 
 /// @brief Divides a Vector4 by a @p factor.
 [[nodiscard]]
-constexpr Vector4 operator/(const Vector4& v, const float_t factor) noexcept { const float_t invFactor = 1.f / factor; return Vector4(v.x * invFactor, v.y * invFactor, v.z * invFactor, v.w * invFactor); }
+constexpr Vector4 operator/(const Vector4& v, const float_t factor) noexcept
+{
+    const float_t invFactor = 1.f / factor;
+
+#ifdef MATH_SIMD_ALIGN
+    if (!std::is_constant_evaluated())
+        return Simd::Store<Vector4>(_mm_mul_ps(Simd::Load(v), _mm_set1_ps(invFactor)));
+#endif
+
+    return Vector4(v.x * invFactor, v.y * invFactor, v.z * invFactor, v.w * invFactor);
+}
 
 /// @brief Adds two Vector4 according to @ref operator+(const Vector4&, const Vector4&), placing the result in @p a.
 constexpr Vector4& operator+=(Vector4& a, const Vector4& b) noexcept { return a = a + b; }
@@ -0,0 +1,621 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <format>
+#include <sstream>
+#include <stdexcept>
+
+#include <ostream>
+#include <type_traits>
+
+#include "Math/core.hpp"
+#include "Math/simd.hpp"
+
+/// @file vectort.hpp
+/// @brief Defines the VectorT template, of which Vector2, Vector3, Vector4 and Vector2i are specializations.
+
+template <size_t N, typename T>
+struct VectorT;
+
+// Vector2, Vector3, Vector4 and Vector2i are explicit specializations of VectorT, defined in their own header
+template <>
+struct VectorT<2, float_t>;
+
+template <>
+struct VectorT<3, float_t>;
+
+template <>
+struct VectorT<4, float_t>;
+
+template <>
+struct VectorT<2, int32_t>;
+
+using Vector2 = VectorT<2, float_t>;
+using Vector3 = VectorT<3, float_t>;
+using Vector4 = VectorT<4, float_t>;
+using Vector2i = VectorT<2, int32_t>;
+
+/// @brief A three-dimensional integer vector, e.g. voxel coordinates.
+using Vector3i = VectorT<3, int32_t>;
+
+/// @brief A four-dimensional integer vector.
+using Vector4i = VectorT<4, int32_t>;
+
+/// @brief A two-dimensional double vector.
+using Vector2d = VectorT<2, double_t>;
+
+/// @brief A three-dimensional double vector, e.g. a world position that needs more precision than a Vector3.
+using Vector3d = VectorT<3, double_t>;
+
+/// @brief A four-dimensional double vector.
+using Vector4d = VectorT<4, double_t>;
+
+/// @private
+/// @brief The named components of a VectorT.
+template <size_t N, typename T>
+struct VectorComponents;
+
+/// @private
+template <typename T>
+struct VectorComponents<2, T>
+{
+    /// @brief The @c x component of this vector.
+    T x = 0;
+    /// @brief The @c y component of this vector.
+    T y = 0;
+};
+
+/// @private
+template <typename T>
+struct VectorComponents<3, T>
+{
+    /// @brief The @c x component of this vector.
+    T x = 0;
+    /// @brief The @c y component of this vector.
+    T y = 0;
+    /// @brief The @c z component of this vector.
+    T z = 0;
+};
+
+/// @private
+template <typename T>
+struct VectorComponents<4, T>
+{
+    /// @brief The @c x component of this vector.
+    T x = 0;
+    /// @brief The @c y component of this vector.
+    T y = 0;
+    /// @brief The @c z component of this vector.
+    T z = 0;
+    /// @brief The @c w component of this vector.
+    T w = 0;
+};
+
+/// @brief The VectorT struct represents either an @p N -dimensional vector of @p T values or a point.
+///
+/// The float vectors and the two-dimensional integer vector are the Vector2, Vector3, Vector4 and Vector2i specializations.
+/// Every other dimension and value type, like Vector3i or Vector3d, uses this generic implementation,
+/// whose element-wise operations run on SIMD registers for @c int32_t and @c double_t values when @c MATH_SIMD_SSE is defined.
+template <size_t N, typename T>
+struct VectorT : VectorComponents<N, T>
+{
+    static_assert(N >= 2 && N <= 4, "A VectorT must have 2, 3 or 4 components");
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool_t>, "The components of a VectorT must be numbers");
+
+    /// @brief The type returned by Length(), e.g. @c float_t for integer vectors.
+    using LengthType = std::conditional_t<std::is_floating_point_v<T>, T, float_t>;
+
+    /// @brief Equivalent to calling the default constructor.
+    [[nodiscard]]
+    static constexpr VectorT Zero() noexcept;
+
+    /// @brief Returns a VectorT with all its components set to @c 1.
+    [[nodiscard]]
+    static constexpr VectorT One() noexcept;
+
+    /// @brief Returns a VectorT with @c x @c = @c 1 and its other components set to @c 0.
+    [[nodiscard]]
+    static constexpr VectorT UnitX() noexcept;
+
+    /// @brief Returns a VectorT with @c y @c = @c 1 and its other components set to @c 0.
+    [[nodiscard]]
+    static constexpr VectorT UnitY() noexcept;
+
+    /// @brief Returns a VectorT with @c z @c = @c 1 and its other components set to @c 0.
+    [[nodiscard]]
+    static constexpr VectorT UnitZ() noexcept requires (N >= 3);
+
+    /// @brief Returns a VectorT with @c w @c = @c 1 and its other components set to @c 0.
+    [[nodiscard]]
+    static constexpr VectorT UnitW() noexcept requires (N == 4);
+
+    /// @brief Returns a · b.
+    [[nodiscard]]
+    static constexpr T Dot(const VectorT& a, const VectorT& b) noexcept;
+
+    /// @brief Returns a x b.
+    [[nodiscard]]
+    static constexpr VectorT Cross(const VectorT& a, const VectorT& b) noexcept requires (N == 3);
+
+    /// @brief Returns the minimum of each component of @p a and @p b.
+    [[nodiscard]]
+    static constexpr VectorT Min(const VectorT& a, const VectorT& b) noexcept;
+
+    /// @brief Returns the maximum of each component of @p a and @p b.
+    [[nodiscard]]
+    static constexpr VectorT Max(const VectorT& a, const VectorT& b) noexcept;
+
+    /// @brief Constructs a VectorT with all its components set to 0.
+    constexpr VectorT() = default;
+
+    /// @brief Constructs a VectorT with all its components set to @p value.
+    constexpr explicit VectorT(T value) noexcept;
+
+    /// @brief Constructs a VectorT with its components set to the data pointed by @p data.
+    ///
+    /// This constructor assumes that @p data is a valid pointer pointing to at least @p N @p T values.
+    ///
+    /// @param data The data where the values for this vector's components are located.
+    constexpr explicit VectorT(const T* data) noexcept;
+
+    /// @brief Constructs a VectorT with set component values.
+    template <std::convertible_to<T>... Args>
+        requires (sizeof...(Args) == N)
+    constexpr VectorT(Args... values) noexcept; // NOLINT(google-explicit-constructor)
+
+    /// @brief Converts a VectorT of the same dimension to this value type, e.g. a Vector3 to a Vector3d.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    constexpr explicit VectorT(const VectorT<N, U>& other) noexcept;
+
+    /// @brief Gets a pointer to the first component of this vector.
+    ///
+    /// @returns A pointer to the first component of this vector.
+    [[nodiscard]]
+    constexpr const T* Data() const noexcept;
+
+    /// @brief Gets a pointer to the first component of this vector.
+    ///
+    /// @returns A pointer to the first component of this vector.
+    [[nodiscard]]
+    constexpr T* Data() noexcept;
+
+    /// @brief Returns the length of the vector.
+    [[nodiscard]]
+    LengthType Length() const noexcept;
+
+    /// @brief Returns the squared length of the vector.
+    [[nodiscard]]
+    constexpr T SquaredLength() const noexcept;
+
+    /// @brief Returns a normalized vector.
+    ///
+    /// @returns A vector with the same direction but a length of one, or a null vector if this one is null.
+    [[nodiscard]]
+    VectorT Normalized() const noexcept requires std::floating_point<T>;
+
+    /// @brief Retrieves this vector's component at index i.
+    ///
+    /// @param i The index of the component to get. It would be 0 for x, 1 for y, etc...
+    ///
+    /// @returns The value of the component at index i.
+    [[nodiscard]]
+    constexpr T operator[](size_t i) const;
+
+    /// @brief Retrieves this vector's component at index i.
+    ///
+    /// @param i The index of the component to get. It would be 0 for x, 1 for y, etc...
+    ///
+    /// @returns The value of the component at index i.
+    [[nodiscard]]
+    constexpr T& operator[](size_t i);
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    ///
+    /// It never throws, which lets it be used in hot loops and when @c MATH_NO_EXCEPTIONS is defined.
+    [[nodiscard]]
+    constexpr T UncheckedAt(size_t i) const noexcept;
+
+    /// @brief Retrieves this vector's component at index @p i like operator[], but without checking that it is in range.
+    [[nodiscard]]
+    constexpr T& UncheckedAt(size_t i) noexcept;
+
+    /// @brief Converts this VectorT to a VectorT of the same dimension holding another value type, e.g. a Vector3d to a Vector3.
+    template <typename U>
+        requires (!std::same_as<T, U>)
+    [[nodiscard]]
+    constexpr explicit operator VectorT<N, U>() const noexcept;
+};
+
+/// @private
+/// @brief Returns the components of any VectorT, including the Vector2, Vector3, Vector4 and Vector2i specializations.
+///
+/// Unlike @c Data(), this can be used in constant expressions for every specialization.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr std::array<T, N> GetVectorComponents(const VectorT<N, T>& v) noexcept
+{
+    return std::bit_cast<std::array<T, N>>(v);
+}
+
+/// @private
+/// @brief Creates any VectorT from its components, including the Vector2, Vector3, Vector4 and Vector2i specializations.
+template <typename VectorType, typename T, size_t N>
+[[nodiscard]]
+constexpr VectorType MakeVector(const std::array<T, N>& components) noexcept
+{
+    return std::bit_cast<VectorType>(components);
+}
+
+/// @private
+/// @brief The element-wise operations of VectorT.
+enum class LanewiseOperation : uint8_t
+{
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Min,
+    Max
+};
+
+/// @private
+/// @brief Applies @p Operation to each pair of components of @p a and @p b,
+/// using SIMD registers at run-time when the type of their components allows it.
+template <LanewiseOperation Operation, size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> ApplyLanewise(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+    std::array<T, N> result = GetVectorComponents(a);
+    const std::array<T, N> other = GetVectorComponents(b);
+
+#ifdef MATH_SIMD_SSE
+    // Integer divisions don't have a SIMD instruction
+    if constexpr (Simd::HasLanes<T, N> && (Operation != LanewiseOperation::Divide || std::floating_point<T>))
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto lhs = Simd::LoadLanes<N>(result.data());
+            const auto rhs = Simd::LoadLanes<N>(other.data());
+
+            if constexpr (Operation == LanewiseOperation::Add)
+                Simd::StoreLanes<N>(Simd::Add(lhs, rhs), result.data());
+            else if constexpr (Operation == LanewiseOperation::Subtract)
+                Simd::StoreLanes<N>(Simd::Subtract(lhs, rhs), result.data());
+            else if constexpr (Operation == LanewiseOperation::Multiply)
+                Simd::StoreLanes<N>(Simd::Multiply(lhs, rhs), result.data());
+            else if constexpr (Operation == LanewiseOperation::Divide)
+                Simd::StoreLanes<N>(Simd::Divide(lhs, rhs), result.data());
+            else if constexpr (Operation == LanewiseOperation::Min)
+                Simd::StoreLanes<N>(Simd::Min(lhs, rhs), result.data());
+            else
+                Simd::StoreLanes<N>(Simd::Max(lhs, rhs), result.data());
+
+            return MakeVector<VectorT<N, T>>(result);
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if constexpr (Operation == LanewiseOperation::Add)
+            result[i] += other[i];
+        else if constexpr (Operation == LanewiseOperation::Subtract)
+            result[i] -= other[i];
+        else if constexpr (Operation == LanewiseOperation::Multiply)
+            result[i] *= other[i];
+        else if constexpr (Operation == LanewiseOperation::Divide)
+            result[i] /= other[i];
+        else if constexpr (Operation == LanewiseOperation::Min)
+            result[i] = result[i] < other[i] ? result[i] : other[i];
+        else
+            result[i] = result[i] > other[i] ? result[i] : other[i];
+    }
+    return MakeVector<VectorT<N, T>>(result);
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::Zero() noexcept { return VectorT(); }
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::One() noexcept { return VectorT(static_cast<T>(1)); }
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::UnitX() noexcept
+{
+    VectorT result;
+    result.x = 1;
+    return result;
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::UnitY() noexcept
+{
+    VectorT result;
+    result.y = 1;
+    return result;
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::UnitZ() noexcept requires (N >= 3)
+{
+    VectorT result;
+    result.z = 1;
+    return result;
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::UnitW() noexcept requires (N == 4)
+{
+    VectorT result;
+    result.w = 1;
+    return result;
+}
+
+template <size_t N, typename T>
+constexpr T VectorT<N, T>::Dot(const VectorT& a, const VectorT& b) noexcept
+{
+    const std::array<T, N> lhs = GetVectorComponents(a);
+    const std::array<T, N> rhs = GetVectorComponents(b);
+
+    T result = 0;
+    for (size_t i = 0; i < N; i++)
+        result += lhs[i] * rhs[i];
+    return result;
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::Cross(const VectorT& a, const VectorT& b) noexcept requires (N == 3)
+{
+    return VectorT(
+        a.y * b.z - a.z * b.y,
+        a.z * b.x - a.x * b.z,
+        a.x * b.y - a.y * b.x
+    );
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::Min(const VectorT& a, const VectorT& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Min>(a, b);
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T> VectorT<N, T>::Max(const VectorT& a, const VectorT& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Max>(a, b);
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T>::VectorT(const T value) noexcept
+{
+    std::array<T, N> components;
+    components.fill(value);
+    *this = MakeVector<VectorT>(components);
+}
+
+template <size_t N, typename T>
+constexpr VectorT<N, T>::VectorT(const T* const data) noexcept
+{
+    std::array<T, N> components;
+    std::copy_n(data, N, components.begin());
+    *this = MakeVector<VectorT>(components);
+}
+
+template <size_t N, typename T>
+template <std::convertible_to<T>... Args>
+    requires (sizeof...(Args) == N)
+constexpr VectorT<N, T>::VectorT(Args... values) noexcept
+    : VectorComponents<N, T> { static_cast<T>(values)... }
+{
+}
+
+template <size_t N, typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr VectorT<N, T>::VectorT(const VectorT<N, U>& other) noexcept
+{
+    const std::array<U, N> otherComponents = GetVectorComponents(other);
+    std::array<T, N> components;
+    for (size_t i = 0; i < N; i++)
+        components[i] = static_cast<T>(otherComponents[i]);
+    *this = MakeVector<VectorT>(components);
+}
+
+template <size_t N, typename T>
+constexpr const T* VectorT<N, T>::Data() const noexcept { return &this->x; }
+
+template <size_t N, typename T>
+constexpr T* VectorT<N, T>::Data() noexcept { return &this->x; }
+
+template <size_t N, typename T>
+typename VectorT<N, T>::LengthType VectorT<N, T>::Length() const noexcept
+{
+    return std::sqrt(static_cast<LengthType>(SquaredLength()));
+}
+
+template <size_t N, typename T>
+constexpr T VectorT<N, T>::SquaredLength() const noexcept { return Dot(*this, *this); }
+
+template <size_t N, typename T>
+VectorT<N, T> VectorT<N, T>::Normalized() const noexcept requires std::floating_point<T>
+{
+    const T length = Length();
+    if (length == 0)
+        return Zero();
+
+    return *this * (1 / length);
+}
+
+template <size_t N, typename T>
+constexpr T VectorT<N, T>::operator[](const size_t i) const
+{
+    if (i < N) [[likely]]
+        return GetVectorComponents(*this)[i];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("VectorT subscript out of range"));
+}
+
+template <size_t N, typename T>
+constexpr T& VectorT<N, T>::operator[](const size_t i)
+{
+    if (i < N) [[likely]]
+        return Data()[i];
+
+    [[unlikely]]
+    MATH_THROW(std::out_of_range("VectorT subscript out of range"));
+}
+
+template <size_t N, typename T>
+constexpr T VectorT<N, T>::UncheckedAt(const size_t i) const noexcept { return GetVectorComponents(*this)[i]; }
+
+template <size_t N, typename T>
+constexpr T& VectorT<N, T>::UncheckedAt(const size_t i) noexcept { return Data()[i]; }
+
+template <size_t N, typename T>
+template <typename U>
+    requires (!std::same_as<T, U>)
+constexpr VectorT<N, T>::operator VectorT<N, U>() const noexcept
+{
+    const std::array<T, N> components = GetVectorComponents(*this);
+    std::array<U, N> result;
+    for (size_t i = 0; i < N; i++)
+        result[i] = static_cast<U>(components[i]);
+    return MakeVector<VectorT<N, U>>(result);
+}
+
+// The operators below also accept Vector2, Vector3, Vector4 and Vector2i, whose own operators take precedence.
+
+/// @brief Adds two vectors component by component.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator+(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Add>(a, b);
+}
+
+/// @brief Subtracts two vectors component by component.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator-(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Subtract>(a, b);
+}
+
+/// @brief Returns the opposite of a vector.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator-(const VectorT<N, T>& v) noexcept { return VectorT<N, T>() - v; }
+
+/// @brief Multiplies two vectors component by component.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator*(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Multiply>(a, b);
+}
+
+/// @brief Multiplies all the components of a vector by a @p factor.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator*(const VectorT<N, T>& v, const std::type_identity_t<T> factor) noexcept { return v * VectorT<N, T>(factor); }
+
+/// @brief Multiplies all the components of a vector by a @p factor.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator*(const std::type_identity_t<T> factor, const VectorT<N, T>& v) noexcept { return v * factor; }
+
+/// @brief Divides two vectors component by component.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator/(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept
+{
+    return ApplyLanewise<LanewiseOperation::Divide>(a, b);
+}
+
+/// @brief Divides all the components of a vector by a @p factor.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr VectorT<N, T> operator/(const VectorT<N, T>& v, const std::type_identity_t<T> factor) noexcept { return v / VectorT<N, T>(factor); }
+
+/// @brief Adds two vectors according to @ref operator+(const VectorT<N, T>&, const VectorT<N, T>&), placing the result in @p a.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator+=(VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return a = a + b; }
+
+/// @brief Subtracts two vectors according to @ref operator-(const VectorT<N, T>&, const VectorT<N, T>&), placing the result in @p a.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator-=(VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return a = a - b; }
+
+/// @brief Multiplies two vectors according to @ref operator*(const VectorT<N, T>&, const VectorT<N, T>&), placing the result in @p a.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator*=(VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return a = a * b; }
+
+/// @brief Multiplies a vector by a @p factor, placing the result in @p v.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator*=(VectorT<N, T>& v, const std::type_identity_t<T> factor) noexcept { return v = v * factor; }
+
+/// @brief Divides two vectors according to @ref operator/(const VectorT<N, T>&, const VectorT<N, T>&), placing the result in @p a.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator/=(VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return a = a / b; }
+
+/// @brief Divides a vector by a @p factor, placing the result in @p v.
+template <size_t N, typename T>
+constexpr VectorT<N, T>& operator/=(VectorT<N, T>& v, const std::type_identity_t<T> factor) noexcept { return v = v / factor; }
+
+/// @brief Checks if two vectors are equal.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr bool_t operator==(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return GetVectorComponents(a) == GetVectorComponents(b); }
+
+/// @brief Checks if two vectors are different.
+template <size_t N, typename T>
+[[nodiscard]]
+constexpr bool_t operator!=(const VectorT<N, T>& a, const VectorT<N, T>& b) noexcept { return !(a == b); }
+
+/// @brief Streams a vector into @p out, printing its components one by one.
+template <size_t N, typename T>
+std::ostream& operator<<(std::ostream& out, const VectorT<N, T>& v)
+{
+    const std::array<T, N> components = GetVectorComponents(v);
+    for (size_t i = 0; i < N; i++)
+        out << (i == 0 ? "" : " ; ") << components[i];
+    return out;
+}
+
+template <size_t N, typename T>
+struct std::formatter<VectorT<N, T>>
+{
+    template <class ParseContext>
+    constexpr typename ParseContext::iterator parse(ParseContext& ctx)
+    {
+        auto it = ctx.begin();
+        if (it == ctx.end())
+            return it;
+
+        while (*it != '}' && it != ctx.end())
+            m_Format += *it++;
+
+        return it;
+    }
+
+    template <class FmtContext>
+    typename FmtContext::iterator format(const VectorT<N, T>& v, FmtContext& ctx) const
+    {
+        std::ostringstream out;
+
+        const std::string componentFormat = "{:" + m_Format + '}';
+        const std::array<T, N> components = GetVectorComponents(v);
+        for (size_t i = 0; i < N; i++)
+            out << (i == 0 ? "" : " ; ") << std::vformat(componentFormat, std::make_format_args(components[i]));
+
+        return std::ranges::copy(std::move(out).str(), ctx.out()).out;
+    }
+
+private:
+    std::string m_Format;
+};